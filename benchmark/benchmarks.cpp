@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmarks.hpp"
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+int main(int argc, char **argv) {
+    using namespace mlsdk::vgflib;
+
+    const std::vector<std::pair<std::string, std::function<void(size_t)>>> allBenchmarks{
+        {"parallel_finish", benchmarks::ParallelFinishBenchmark},
+        {"write_to_file", benchmarks::WriteToFileBenchmark},
+        {"lazy_verification", benchmarks::LazyVerificationBenchmark},
+        {"parallel_verification", benchmarks::ParallelVerificationBenchmark},
+        {"decoder_views", benchmarks::DecoderViewsBenchmark},
+        {"c_batch_getters", benchmarks::CBatchGettersBenchmark},
+        {"name_index", benchmarks::NameIndexBenchmark},
+        {"resource_index", benchmarks::ResourceIndexBenchmark},
+        {"segment_graph", benchmarks::SegmentGraphBenchmark},
+        {"memory_map", benchmarks::MemoryMapBenchmark},
+        {"load_constants", benchmarks::LoadConstantsBenchmark},
+    };
+
+    // Usage: vgf_benchmarks [repetitions] [benchmark...]
+    const size_t repetitions = argc > 1 ? static_cast<size_t>(std::max(1L, std::strtol(argv[1], nullptr, 10))) : 5;
+    for (const auto &[name, benchmark] : allBenchmarks) {
+        bool selected = argc <= 2;
+        for (int i = 2; i < argc; ++i) {
+            selected = selected || name == argv[i];
+        }
+        if (selected) {
+            std::cout << "Running " << name << std::endl;
+            benchmark(repetitions);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace mlsdk::vgflib::benchmarks {
+
+using Clock = std::chrono::steady_clock;
+
+/// Median of the given sample durations in milliseconds
+inline double MedianMilliseconds(std::vector<Clock::duration> samples) {
+    std::sort(samples.begin(), samples.end());
+    const auto median = samples[samples.size() / 2];
+    return std::chrono::duration<double, std::milli>(median).count();
+}
+
+inline void Report(const std::string &name, double milliseconds) {
+    std::cout << name << ": " << milliseconds << " ms" << std::endl;
+}
+
+inline void ReportSpeedup(const std::string &name, double baselineMilliseconds, double milliseconds) {
+    std::cout << name << " speedup: " << baselineMilliseconds / milliseconds << "x" << std::endl;
+}
+
+// Encoder - serial and parallel Finish on a synthetic chain of segments
+void ParallelFinishBenchmark(size_t repetitions);
+
+// Encoder - WriteTo through an std::ofstream and positional WriteToFile of 1 GiB of constants
+void WriteToFileBenchmark(size_t repetitions);
+
+// Decoder - full and lazy verification when opening a model with a long chain of segments
+void LazyVerificationBenchmark(size_t repetitions);
+
+// Decoder - serial and parallel verification of the sections when opening a model with a long chain of segments
+void ParallelVerificationBenchmark(size_t repetitions);
+
+// Decoder - walk of every descriptor binding slot through the virtual decoder and the inline view
+void DecoderViewsBenchmark(size_t repetitions);
+
+// Decoder - walk of every descriptor binding slot through the C API, one call per field and with the batch getters
+void CBatchGettersBenchmark(size_t repetitions);
+
+// Decoder - lookup of segments by name with a linear scan and with the name index
+void NameIndexBenchmark(size_t repetitions);
+
+// Decoder - lookup of the segments reading a resource with a scan of the segments and with the resource index
+void ResourceIndexBenchmark(size_t repetitions);
+
+// Decoder - build of the segment dependency graph of chains of 25k and 100k segments
+void SegmentGraphBenchmark(size_t repetitions);
+
+// Loader - first pass over every page of a 256 MiB file mapped with the default options and with populate
+void MemoryMapBenchmark(size_t repetitions);
+
+// Loader - copy of 256 MiB of constants into staging buffers from a cold page cache, from a mapped file and with
+// positional reads, one constant at a time and batched on a thread pool or io_uring
+void LoadConstantsBenchmark(size_t repetitions);
+
+} // namespace mlsdk::vgflib::benchmarks
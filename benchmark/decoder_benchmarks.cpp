@@ -0,0 +1,419 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmarks.hpp"
+
+#include <vgf/decoder.h>
+#include <vgf/decoder.hpp>
+#include <vgf/decoder_views.hpp>
+#include <vgf/encoder.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mlsdk::vgflib::benchmarks {
+
+namespace {
+
+constexpr uint16_t VK_HEADER_VERSION = 0;
+constexpr uint32_t NUM_SEGMENTS = 100000;
+// Each segment of the chain has a descriptor set of two binding slots
+constexpr uint32_t NUM_VIEW_SEGMENTS = 25000;
+constexpr uint32_t NUM_NAME_LOOKUPS = 1000;
+
+/// Encode a chain of numSegments segments, each reading the previous intermediate and writing the next one
+std::vector<uint8_t> EncodeSegmentChain(uint32_t numSegments = NUM_SEGMENTS) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(VK_HEADER_VERSION);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "chain_module", "main");
+
+    std::vector<BindingSlotRef> bindings;
+    bindings.reserve(numSegments + 1);
+    for (uint32_t i = 0; i <= numSegments; ++i) {
+        ResourceRef resource = encoder->AddIntermediateResource(DescriptorType{}, FormatType{}, {1, 64, 64, 16}, {});
+        bindings.push_back(encoder->AddBindingSlot(i % 2, resource));
+    }
+    for (uint32_t i = 0; i < numSegments; ++i) {
+        DescriptorSetInfoRef descriptor = encoder->AddDescriptorSetInfo({bindings[i], bindings[i + 1]});
+        encoder->AddSegmentInfo(module, "segment_" + std::to_string(i), {descriptor}, {bindings[i]},
+                                {bindings[i + 1]});
+    }
+    encoder->AddModelSequenceInputsOutputs({bindings.front()}, {"input"}, {bindings.back()}, {"output"});
+    encoder->Finish();
+
+    // Copy into a vector so the sections are suitably aligned for decoding
+    std::stringstream output;
+    encoder->WriteTo(output);
+    const std::string encoded = output.str();
+    return {encoded.begin(), encoded.end()};
+}
+
+Clock::duration TimeOpen(const std::vector<uint8_t> &data, const VgfModelOptions &options) {
+    const auto start = Clock::now();
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.data(), data.size(), options);
+    // Touch a single segment, as a runtime executing the first dispatch would
+    if (model == nullptr || model->getModelSequenceTableDecoder().getSegmentName(0).empty()) {
+        std::cerr << "Failed to decode the segment chain" << std::endl;
+    }
+    return Clock::now() - start;
+}
+
+/// Sum the bindings and resource indexes of every descriptor binding slot through the virtual decoder
+uint64_t WalkBindings(const ModelSequenceTableDecoder &decoder) {
+    uint64_t sum = 0;
+    for (uint32_t segmentIdx = 0; segmentIdx < decoder.modelSequenceTableSize(); ++segmentIdx) {
+        for (uint32_t descIdx = 0; descIdx < decoder.getSegmentDescriptorSetInfosSize(segmentIdx); ++descIdx) {
+            BindingSlotArrayHandle handle = decoder.getDescriptorBindingSlotsHandle(segmentIdx, descIdx);
+            for (uint32_t slotIdx = 0; slotIdx < decoder.getBindingsSize(handle); ++slotIdx) {
+                sum += decoder.getBindingSlotBinding(handle, slotIdx) + decoder.getBindingSlotMrtIndex(handle, slotIdx);
+            }
+        }
+    }
+    return sum;
+}
+
+/// Sum the bindings and resource indexes of every descriptor binding slot through the inline view
+uint64_t WalkBindings(const ModelSequenceView &view) {
+    uint64_t sum = 0;
+    for (uint32_t segmentIdx = 0; segmentIdx < view.size(); ++segmentIdx) {
+        const SegmentView segment = view.segment(segmentIdx);
+        for (uint32_t descIdx = 0; descIdx < segment.descriptorSetInfosSize(); ++descIdx) {
+            const BindingSlotsView slots = segment.descriptorBindingSlots(descIdx);
+            for (uint32_t slotIdx = 0; slotIdx < slots.size(); ++slotIdx) {
+                sum += slots.binding(slotIdx) + slots.mrtIndex(slotIdx);
+            }
+        }
+    }
+    return sum;
+}
+
+template <typename Decoder> Clock::duration TimeWalk(const Decoder &decoder, uint64_t &sum) {
+    const auto start = Clock::now();
+    sum = WalkBindings(decoder);
+    return Clock::now() - start;
+}
+
+/// Sum the summary fields and the descriptor binding slots of every segment with one C call per field
+uint64_t WalkBindingsPerField(mlsdk_decoder_model_sequence_decoder *decoder) {
+    uint64_t sum = 0;
+    const size_t numSegments = mlsdk_decoder_get_model_sequence_table_size(decoder);
+    for (uint32_t segmentIdx = 0; segmentIdx < numSegments; ++segmentIdx) {
+        mlsdk_decoder_dispatch_shape shape;
+        mlsdk_decoder_model_sequence_get_segment_dispatch_shape(decoder, segmentIdx, &shape);
+        mlsdk_decoder_constant_indexes constants;
+        mlsdk_decoder_model_sequence_get_segment_constant_indexes(decoder, segmentIdx, &constants);
+        sum += static_cast<uint64_t>(mlsdk_decoder_model_sequence_get_segment_type(decoder, segmentIdx)) +
+               mlsdk_decoder_model_sequence_get_segment_module_index(decoder, segmentIdx) + shape.data[0] +
+               constants.size +
+               mlsdk_decoder_binding_slot_size(
+                   decoder, mlsdk_decoder_model_sequence_get_segment_input_binding_slot(decoder, segmentIdx)) +
+               mlsdk_decoder_binding_slot_size(
+                   decoder, mlsdk_decoder_model_sequence_get_segment_output_binding_slot(decoder, segmentIdx)) +
+               mlsdk_decoder_get_push_constant_ranges_size(
+                   decoder, mlsdk_decoder_model_sequence_get_segment_push_constant_range(decoder, segmentIdx));
+        const size_t numDescs = mlsdk_decoder_model_sequence_get_segment_descriptorset_info_size(decoder, segmentIdx);
+        for (uint32_t descIdx = 0; descIdx < numDescs; ++descIdx) {
+            mlsdk_decoder_binding_slots_handle handle =
+                mlsdk_decoder_model_sequence_get_segment_descriptor_binding_slot(decoder, segmentIdx, descIdx);
+            const size_t numSlots = mlsdk_decoder_binding_slot_size(decoder, handle);
+            for (uint32_t slotIdx = 0; slotIdx < numSlots; ++slotIdx) {
+                sum += mlsdk_decoder_binding_slot_binding_id(decoder, handle, slotIdx) +
+                       mlsdk_decoder_binding_slot_mrt_index(decoder, handle, slotIdx);
+            }
+        }
+    }
+    return sum;
+}
+
+/// Sum the summary fields and the descriptor binding slots of every segment with the C batch getters
+uint64_t WalkBindingsBatched(mlsdk_decoder_model_sequence_decoder *decoder) {
+    uint64_t sum = 0;
+    std::vector<mlsdk_decoder_segment_summary> summaries(mlsdk_decoder_get_model_sequence_table_size(decoder));
+    mlsdk_decoder_model_sequence_get_segment_summaries(decoder, summaries.data(), summaries.size());
+    std::vector<mlsdk_decoder_binding_slot_info> slots;
+    for (uint32_t segmentIdx = 0; segmentIdx < summaries.size(); ++segmentIdx) {
+        const mlsdk_decoder_segment_summary &summary = summaries[segmentIdx];
+        sum += static_cast<uint64_t>(summary.type) + summary.module_index + summary.dispatch_shape.data[0] +
+               summary.num_constants + summary.num_inputs + summary.num_outputs + summary.num_push_constant_ranges;
+        for (uint32_t descIdx = 0; descIdx < summary.num_descriptor_set_infos; ++descIdx) {
+            mlsdk_decoder_binding_slots_handle handle =
+                mlsdk_decoder_model_sequence_get_segment_descriptor_binding_slot(decoder, segmentIdx, descIdx);
+            slots.resize(mlsdk_decoder_binding_slot_size(decoder, handle));
+            mlsdk_decoder_binding_slot_get_infos(decoder, handle, slots.data(), slots.size());
+            for (const mlsdk_decoder_binding_slot_info &slot : slots) {
+                sum += slot.binding + slot.mrt_index;
+            }
+        }
+    }
+    return sum;
+}
+
+template <typename Walk> Clock::duration TimeCWalk(Walk walk, mlsdk_decoder_model_sequence_decoder *decoder,
+                                                   uint64_t &sum) {
+    const auto start = Clock::now();
+    sum = walk(decoder);
+    return Clock::now() - start;
+}
+
+/// Find segments by name with a linear scan, as done without a name index
+std::optional<uint32_t> FindSegmentByScan(const ModelSequenceTableDecoder &decoder, std::string_view name) {
+    for (uint32_t segmentIdx = 0; segmentIdx < decoder.modelSequenceTableSize(); ++segmentIdx) {
+        if (decoder.getSegmentName(segmentIdx) == name) {
+            return segmentIdx;
+        }
+    }
+    return std::nullopt;
+}
+
+/// Find the first segment reading a resource with a scan of the segment inputs, as done without a resource index
+std::optional<uint32_t> FindConsumerByScan(const ModelSequenceTableDecoder &decoder, uint32_t mrtIdx) {
+    for (uint32_t segmentIdx = 0; segmentIdx < decoder.modelSequenceTableSize(); ++segmentIdx) {
+        BindingSlotArrayHandle handle = decoder.getSegmentInputBindingSlotsHandle(segmentIdx);
+        for (uint32_t slotIdx = 0; slotIdx < decoder.getBindingsSize(handle); ++slotIdx) {
+            if (decoder.getBindingSlotMrtIndex(handle, slotIdx) == mrtIdx) {
+                return segmentIdx;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename Key, typename Find>
+Clock::duration TimeLookups(const std::vector<Key> &keys, Find find, uint64_t &sum) {
+    const auto start = Clock::now();
+    for (const Key &key : keys) {
+        sum += find(key).value_or(0);
+    }
+    return Clock::now() - start;
+}
+
+} // namespace
+
+void DecoderViewsBenchmark(size_t repetitions) {
+    const std::vector<uint8_t> data = EncodeSegmentChain(NUM_VIEW_SEGMENTS);
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.data(), data.size());
+    if (model == nullptr) {
+        std::cerr << "Failed to decode the segment chain" << std::endl;
+        return;
+    }
+    const HeaderDecoder &header = model->getHeaderDecoder();
+    const std::optional<ModelSequenceView> view = CreateModelSequenceView(
+        data.data() + header.GetModelSequenceTableOffset(), header.GetModelSequenceTableSize());
+    if (!view.has_value()) {
+        std::cerr << "Failed to create the model sequence view" << std::endl;
+        return;
+    }
+
+    std::vector<Clock::duration> decoderSamples;
+    std::vector<Clock::duration> viewSamples;
+    for (size_t i = 0; i < repetitions; ++i) {
+        uint64_t decoderSum = 0;
+        uint64_t viewSum = 0;
+        decoderSamples.push_back(TimeWalk(model->getModelSequenceTableDecoder(), decoderSum));
+        viewSamples.push_back(TimeWalk(*view, viewSum));
+        if (decoderSum != viewSum) {
+            std::cerr << "Decoder and view disagree on the binding slots" << std::endl;
+        }
+    }
+
+    const double decoderMs = MedianMilliseconds(decoderSamples);
+    const double viewMs = MedianMilliseconds(viewSamples);
+    Report("Virtual decoder walk of 50k binding slots", decoderMs);
+    Report("Inline view walk of 50k binding slots", viewMs);
+    ReportSpeedup("Inline view walk", decoderMs, viewMs);
+}
+
+void CBatchGettersBenchmark(size_t repetitions) {
+    const std::vector<uint8_t> data = EncodeSegmentChain(NUM_VIEW_SEGMENTS);
+    std::vector<uint8_t> headerDecoderMemory(mlsdk_decoder_header_decoder_mem_reqs());
+    mlsdk_decoder_header_decoder *headerDecoder = mlsdk_decoder_create_header_decoder(
+        data.data(), mlsdk_decoder_header_size(), data.size(), headerDecoderMemory.data());
+    mlsdk_decoder_vgf_section_info section;
+    mlsdk_decoder_get_header_section_info(headerDecoder, mlsdk_decoder_section_model_sequence, &section);
+    std::vector<uint8_t> decoderMemory(mlsdk_decoder_model_sequence_decoder_mem_reqs());
+    mlsdk_decoder_model_sequence_decoder *decoder =
+        mlsdk_decoder_create_model_sequence_decoder(data.data() + section.offset, section.size, decoderMemory.data());
+    if (decoder == nullptr) {
+        std::cerr << "Failed to decode the segment chain" << std::endl;
+        return;
+    }
+
+    std::vector<Clock::duration> perFieldSamples;
+    std::vector<Clock::duration> batchedSamples;
+    for (size_t i = 0; i < repetitions; ++i) {
+        uint64_t perFieldSum = 0;
+        uint64_t batchedSum = 0;
+        perFieldSamples.push_back(TimeCWalk(WalkBindingsPerField, decoder, perFieldSum));
+        batchedSamples.push_back(TimeCWalk(WalkBindingsBatched, decoder, batchedSum));
+        if (perFieldSum != batchedSum) {
+            std::cerr << "Per-field and batch getters disagree on the binding slots" << std::endl;
+        }
+    }
+
+    const double perFieldMs = MedianMilliseconds(perFieldSamples);
+    const double batchedMs = MedianMilliseconds(batchedSamples);
+    Report("C per-field walk of 50k binding slots", perFieldMs);
+    Report("C batch getter walk of 50k binding slots", batchedMs);
+    ReportSpeedup("C batch getter walk", perFieldMs, batchedMs);
+}
+
+void NameIndexBenchmark(size_t repetitions) {
+    const std::vector<uint8_t> data = EncodeSegmentChain(NUM_VIEW_SEGMENTS);
+    VgfModelOptions options;
+    options.buildNameIndex = true;
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.data(), data.size(), options);
+    if (model == nullptr) {
+        std::cerr << "Failed to decode the segment chain" << std::endl;
+        return;
+    }
+    const ModelSequenceTableDecoder &decoder = model->getModelSequenceTableDecoder();
+    const NameIndex &index = *model->getNameIndex();
+
+    // Names spread over the whole chain, as a serving layer resolving tensors on every request would look up
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < NUM_NAME_LOOKUPS; ++i) {
+        names.push_back("segment_" + std::to_string((i * 7919) % NUM_VIEW_SEGMENTS));
+    }
+
+    std::vector<Clock::duration> scanSamples;
+    std::vector<Clock::duration> indexSamples;
+    for (size_t i = 0; i < repetitions; ++i) {
+        uint64_t scanSum = 0;
+        uint64_t indexSum = 0;
+        scanSamples.push_back(
+            TimeLookups(names, [&](const std::string &name) { return FindSegmentByScan(decoder, name); }, scanSum));
+        indexSamples.push_back(
+            TimeLookups(names, [&](const std::string &name) { return index.findSegmentByName(name); }, indexSum));
+        if (scanSum != indexSum) {
+            std::cerr << "Linear scan and name index disagree on the segments" << std::endl;
+        }
+    }
+
+    const double scanMs = MedianMilliseconds(scanSamples);
+    const double indexMs = MedianMilliseconds(indexSamples);
+    Report("Linear scan of 1k segment names", scanMs);
+    Report("Name index lookup of 1k segment names", indexMs);
+    ReportSpeedup("Name index lookup", scanMs, indexMs);
+}
+
+void ResourceIndexBenchmark(size_t repetitions) {
+    const std::vector<uint8_t> data = EncodeSegmentChain(NUM_VIEW_SEGMENTS);
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.data(), data.size());
+    if (model == nullptr) {
+        std::cerr << "Failed to decode the segment chain" << std::endl;
+        return;
+    }
+    const ModelSequenceTableDecoder &decoder = model->getModelSequenceTableDecoder();
+
+    // Resources spread over the whole chain, as a runtime planning buffer lifetimes would look up
+    std::vector<uint32_t> mrtIndexes;
+    for (uint32_t i = 0; i < NUM_NAME_LOOKUPS; ++i) {
+        mrtIndexes.push_back((i * 7919) % NUM_VIEW_SEGMENTS);
+    }
+
+    std::vector<Clock::duration> scanSamples;
+    std::vector<Clock::duration> buildSamples;
+    std::vector<Clock::duration> indexSamples;
+    for (size_t i = 0; i < repetitions; ++i) {
+        uint64_t scanSum = 0;
+        uint64_t indexSum = 0;
+        scanSamples.push_back(
+            TimeLookups(mrtIndexes, [&](uint32_t mrtIdx) { return FindConsumerByScan(decoder, mrtIdx); }, scanSum));
+
+        const auto start = Clock::now();
+        std::unique_ptr<ResourceIndex> index = CreateResourceIndex(decoder, model->getModelResourceTableDecoder(),
+                                                                   model->getConstantDecoder());
+        buildSamples.push_back(Clock::now() - start);
+        indexSamples.push_back(TimeLookups(
+            mrtIndexes,
+            [&](uint32_t mrtIdx) -> std::optional<uint32_t> {
+                const DataView<uint32_t> consumers = index->getConsumerSegments(mrtIdx);
+                return consumers.empty() ? std::nullopt : std::optional<uint32_t>(*consumers.begin());
+            },
+            indexSum));
+        if (scanSum != indexSum) {
+            std::cerr << "Segment scan and resource index disagree on the consumers" << std::endl;
+        }
+    }
+
+    const double scanMs = MedianMilliseconds(scanSamples);
+    const double buildMs = MedianMilliseconds(buildSamples);
+    const double indexMs = MedianMilliseconds(indexSamples);
+    Report("Segment scan for the consumers of 1k resources", scanMs);
+    Report("Resource index build over 25k segments", buildMs);
+    Report("Resource index lookup of the consumers of 1k resources", indexMs);
+    ReportSpeedup("Resource index build and lookup", scanMs, buildMs + indexMs);
+}
+
+void SegmentGraphBenchmark(size_t repetitions) {
+    // Build the graph of chains of increasing length, a linear build keeps the time per segment constant
+    for (const uint32_t numSegments : {NUM_VIEW_SEGMENTS, NUM_SEGMENTS}) {
+        const std::vector<uint8_t> data = EncodeSegmentChain(numSegments);
+        std::unique_ptr<VgfModel> model = CreateVgfModel(data.data(), data.size());
+        if (model == nullptr) {
+            std::cerr << "Failed to decode the segment chain" << std::endl;
+            return;
+        }
+
+        std::vector<Clock::duration> samples;
+        for (size_t i = 0; i < repetitions; ++i) {
+            const auto start = Clock::now();
+            std::unique_ptr<SegmentGraph> graph = CreateSegmentGraph(model->getModelSequenceTableDecoder());
+            samples.push_back(Clock::now() - start);
+            if (graph->getCriticalPath().size() != numSegments) {
+                std::cerr << "The critical path of the chain does not cover every segment" << std::endl;
+            }
+        }
+
+        const double buildMs = MedianMilliseconds(samples);
+        const std::string segments = std::to_string(numSegments / 1000) + "k";
+        Report("Segment graph build over " + segments + " segments", buildMs);
+        Report("Segment graph build per 1k segments over " + segments + " segments", buildMs * 1000.0 / numSegments);
+    }
+}
+
+void LazyVerificationBenchmark(size_t repetitions) {
+    const std::vector<uint8_t> data = EncodeSegmentChain();
+
+    std::vector<Clock::duration> fullSamples;
+    std::vector<Clock::duration> lazySamples;
+    VgfModelOptions lazy;
+    lazy.mode = VerificationMode::LAZY;
+    for (size_t i = 0; i < repetitions; ++i) {
+        fullSamples.push_back(TimeOpen(data, VgfModelOptions{}));
+        lazySamples.push_back(TimeOpen(data, lazy));
+    }
+
+    const double fullMs = MedianMilliseconds(fullSamples);
+    const double lazyMs = MedianMilliseconds(lazySamples);
+    Report("Full verification open", fullMs);
+    Report("Lazy verification open", lazyMs);
+    ReportSpeedup("Lazy verification open", fullMs, lazyMs);
+}
+
+void ParallelVerificationBenchmark(size_t repetitions) {
+    const std::vector<uint8_t> data = EncodeSegmentChain();
+
+    std::vector<Clock::duration> serialSamples;
+    std::vector<Clock::duration> parallelSamples;
+    VgfModelOptions parallel;
+    parallel.parallelVerification = true;
+    for (size_t i = 0; i < repetitions; ++i) {
+        serialSamples.push_back(TimeOpen(data, VgfModelOptions{}));
+        parallelSamples.push_back(TimeOpen(data, parallel));
+    }
+
+    const double serialMs = MedianMilliseconds(serialSamples);
+    const double parallelMs = MedianMilliseconds(parallelSamples);
+    Report("Serial verification open", serialMs);
+    Report("Parallel verification open", parallelMs);
+    ReportSpeedup("Parallel verification open", serialMs, parallelMs);
+}
+
+} // namespace mlsdk::vgflib::benchmarks
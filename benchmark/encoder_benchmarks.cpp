@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmarks.hpp"
+
+#include <vgf/encoder.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace mlsdk::vgflib::benchmarks {
+
+namespace {
+
+constexpr uint16_t VK_HEADER_VERSION = 0;
+constexpr uint32_t NUM_SEGMENTS = 100000;
+constexpr uint32_t NUM_CONSTANTS = 16;
+constexpr size_t CONSTANT_SIZE = 64 * 1024 * 1024;
+
+/// Encode a chain of NUM_SEGMENTS segments, each reading the previous intermediate and writing the next one
+std::unique_ptr<Encoder> CreateSegmentChain(bool parallelFinish) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(VK_HEADER_VERSION);
+    encoder->SetParallelFinish(parallelFinish);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "chain_module", "main");
+
+    std::vector<BindingSlotRef> bindings;
+    bindings.reserve(NUM_SEGMENTS + 1);
+    for (uint32_t i = 0; i <= NUM_SEGMENTS; ++i) {
+        ResourceRef resource = encoder->AddIntermediateResource(DescriptorType{}, FormatType{}, {1, 64, 64, 16}, {});
+        bindings.push_back(encoder->AddBindingSlot(i % 2, resource));
+    }
+    for (uint32_t i = 0; i < NUM_SEGMENTS; ++i) {
+        DescriptorSetInfoRef descriptor = encoder->AddDescriptorSetInfo({bindings[i], bindings[i + 1]});
+        encoder->AddSegmentInfo(module, "segment_" + std::to_string(i), {descriptor}, {bindings[i]},
+                                {bindings[i + 1]});
+    }
+    encoder->AddModelSequenceInputsOutputs({bindings.front()}, {"input"}, {bindings.back()}, {"output"});
+    return encoder;
+}
+
+std::string TimeFinish(bool parallelFinish, std::vector<Clock::duration> &samples) {
+    std::unique_ptr<Encoder> encoder = CreateSegmentChain(parallelFinish);
+    const auto start = Clock::now();
+    encoder->Finish();
+    samples.push_back(Clock::now() - start);
+
+    std::stringstream output;
+    encoder->WriteTo(output);
+    return output.str();
+}
+
+/// Encode NUM_CONSTANTS distinct constants of CONSTANT_SIZE bytes each
+std::unique_ptr<Encoder> CreateLargeConstants(const std::vector<uint8_t> &constant) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(VK_HEADER_VERSION);
+    for (uint32_t i = 0; i < NUM_CONSTANTS; ++i) {
+        // Offset into the buffer so the payloads are not deduplicated
+        encoder->AddBorrowedConstant({i}, constant.data() + i, CONSTANT_SIZE);
+    }
+    encoder->Finish();
+    return encoder;
+}
+
+} // namespace
+
+void WriteToFileBenchmark(size_t repetitions) {
+    std::vector<uint8_t> constant(CONSTANT_SIZE + NUM_CONSTANTS);
+    for (size_t i = 0; i < constant.size(); ++i) {
+        constant[i] = static_cast<uint8_t>(i * 31);
+    }
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "vgf_write_benchmark.vgf";
+
+    std::vector<Clock::duration> streamSamples;
+    std::vector<Clock::duration> positionalSamples;
+    for (size_t i = 0; i < repetitions; ++i) {
+        std::unique_ptr<Encoder> encoder = CreateLargeConstants(constant);
+        auto start = Clock::now();
+        {
+            std::ofstream output(path, std::ios::binary | std::ios::trunc);
+            encoder->WriteTo(output);
+            output.flush();
+        }
+        streamSamples.push_back(Clock::now() - start);
+
+        encoder = CreateLargeConstants(constant);
+        start = Clock::now();
+        encoder->WriteToFile(path.string());
+        positionalSamples.push_back(Clock::now() - start);
+    }
+    std::filesystem::remove(path);
+
+    const double streamMs = MedianMilliseconds(streamSamples);
+    const double positionalMs = MedianMilliseconds(positionalSamples);
+    const std::string size = std::to_string(NUM_CONSTANTS * (CONSTANT_SIZE >> 20)) + " MiB";
+    Report("WriteTo ofstream, " + size, streamMs);
+    Report("WriteToFile, " + size + " (includes fsync)", positionalMs);
+    ReportSpeedup("WriteToFile", streamMs, positionalMs);
+}
+
+void ParallelFinishBenchmark(size_t repetitions) {
+    std::vector<Clock::duration> serialSamples;
+    std::vector<Clock::duration> parallelSamples;
+    for (size_t i = 0; i < repetitions; ++i) {
+        const std::string serial = TimeFinish(false, serialSamples);
+        const std::string parallel = TimeFinish(true, parallelSamples);
+        if (serial != parallel) {
+            std::cerr << "Parallel Finish output differs from serial Finish output" << std::endl;
+            return;
+        }
+    }
+
+    const double serialMs = MedianMilliseconds(serialSamples);
+    const double parallelMs = MedianMilliseconds(parallelSamples);
+    Report("Finish serial, " + std::to_string(NUM_SEGMENTS) + " segments", serialMs);
+    Report("Finish parallel, " + std::to_string(NUM_SEGMENTS) + " segments", parallelMs);
+    ReportSpeedup("Finish parallel", serialMs, parallelMs);
+}
+
+} // namespace mlsdk::vgflib::benchmarks
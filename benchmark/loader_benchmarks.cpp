@@ -0,0 +1,219 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmarks.hpp"
+
+#include <vgf-utils/memory_map.hpp>
+#include <vgf/decoder.hpp>
+#include <vgf/encoder.hpp>
+#include <vgf/loader.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+namespace mlsdk::vgflib::benchmarks {
+
+namespace {
+
+constexpr size_t MAPPED_FILE_SIZE = 256 * 1024 * 1024;
+constexpr size_t PAGE_STRIDE = 4096;
+constexpr uint32_t NUM_LOADED_CONSTANTS = 1024;
+constexpr size_t LOADED_CONSTANT_SIZE = 256 * 1024;
+
+/// Sum one byte of every page, as a first inference reading the whole constants section would
+uint64_t TouchPages(const MemoryMap &mapped) {
+    const auto *bytes = static_cast<const uint8_t *>(mapped.ptr());
+    uint64_t sum = 0;
+    for (size_t offset = 0; offset < mapped.size(); offset += PAGE_STRIDE) {
+        sum += bytes[offset];
+    }
+    return sum;
+}
+
+/// Drops the cached pages of the file, so that the next pass reads it from storage
+bool DropPageCache(const std::filesystem::path &path) {
+#ifdef _WIN32
+    (void)path;
+    return false;
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    const bool dropped = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+    close(fd);
+    return dropped;
+#endif
+}
+
+/// Times one pass copying every constant of the file into its staging buffer, starting from a cold page cache
+void TimeLoad(const std::filesystem::path &path, const std::function<bool()> &load,
+              std::vector<Clock::duration> &samples, bool &valid) {
+    DropPageCache(path);
+    const auto start = Clock::now();
+    valid = load() && valid;
+    samples.push_back(Clock::now() - start);
+}
+
+} // namespace
+
+void MemoryMapBenchmark(size_t repetitions) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "vgf_memory_map_benchmark.bin";
+    {
+        std::vector<char> chunk(1024 * 1024, 1);
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        for (size_t written = 0; written < MAPPED_FILE_SIZE; written += chunk.size()) {
+            output.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        }
+    }
+
+    std::vector<Clock::duration> defaultSamples;
+    std::vector<Clock::duration> populateMapSamples;
+    std::vector<Clock::duration> populateSamples;
+    MemoryMapOptions populate;
+    populate.populate = true;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < repetitions; ++i) {
+        {
+            MemoryMap mapped(path.string());
+            const auto start = Clock::now();
+            sum += TouchPages(mapped);
+            defaultSamples.push_back(Clock::now() - start);
+        }
+        {
+            auto start = Clock::now();
+            MemoryMap mapped(path.string(), populate);
+            populateMapSamples.push_back(Clock::now() - start);
+            start = Clock::now();
+            sum += TouchPages(mapped);
+            populateSamples.push_back(Clock::now() - start);
+        }
+    }
+    std::filesystem::remove(path);
+    if (sum != 2 * repetitions * (MAPPED_FILE_SIZE / PAGE_STRIDE)) {
+        std::cerr << "Mapped file content differs from the written content" << std::endl;
+        return;
+    }
+
+    const double defaultMs = MedianMilliseconds(defaultSamples);
+    const double populateMs = MedianMilliseconds(populateSamples);
+    const std::string size = std::to_string(MAPPED_FILE_SIZE >> 20) + " MiB";
+    Report("First pass over default mapping, " + size, defaultMs);
+    Report("Populated mapping, " + size, MedianMilliseconds(populateMapSamples));
+    Report("First pass over populated mapping, " + size, populateMs);
+    ReportSpeedup("First pass over populated mapping", defaultMs, populateMs);
+}
+
+void LoadConstantsBenchmark(size_t repetitions) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "vgf_load_constants_benchmark.vgf";
+    std::vector<uint8_t> payload(LOADED_CONSTANT_SIZE + NUM_LOADED_CONSTANTS);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i * 31);
+    }
+    {
+        std::unique_ptr<Encoder> encoder = CreateEncoder(0);
+        for (uint32_t i = 0; i < NUM_LOADED_CONSTANTS; ++i) {
+            // Offset into the buffer so the payloads are not deduplicated
+            encoder->AddBorrowedConstant({i}, payload.data() + i, LOADED_CONSTANT_SIZE);
+        }
+        encoder->Finish();
+        encoder->WriteToFile(path.string());
+    }
+
+    // Staging buffers of all the constants, as a runtime would upload them from
+    std::vector<uint8_t> staging(NUM_LOADED_CONSTANTS * LOADED_CONSTANT_SIZE, 0);
+    const auto stagingOf = [&](uint32_t idx) { return staging.data() + idx * LOADED_CONSTANT_SIZE; };
+    const auto checkStaging = [&] {
+        return std::memcmp(stagingOf(NUM_LOADED_CONSTANTS - 1), payload.data() + NUM_LOADED_CONSTANTS - 1,
+                           LOADED_CONSTANT_SIZE) == 0;
+    };
+
+    const auto loadMapped = [&] {
+        MemoryMap mapped(path.string());
+        std::unique_ptr<VgfModel> model = CreateVgfModel(mapped.ptr(), mapped.size());
+        if (model == nullptr) {
+            return false;
+        }
+        for (uint32_t idx = 0; idx < NUM_LOADED_CONSTANTS; ++idx) {
+            const DataView<uint8_t> constant = model->getConstantDecoder().getConstant(idx);
+            std::memcpy(stagingOf(idx), constant.begin(), constant.size());
+        }
+        return checkStaging();
+    };
+    const auto loadConstants = [&](const LoadConstantsOptions *options) {
+        std::unique_ptr<RangeReader> reader = CreateFileRangeReader(path.string());
+        std::unique_ptr<VgfLoader> loader = reader == nullptr ? nullptr : CreateVgfLoader(*reader);
+        if (loader == nullptr) {
+            return false;
+        }
+        if (options == nullptr) {
+            for (uint32_t idx = 0; idx < NUM_LOADED_CONSTANTS; ++idx) {
+                if (!loader->readConstant(idx, stagingOf(idx), LOADED_CONSTANT_SIZE)) {
+                    return false;
+                }
+            }
+            return checkStaging();
+        }
+        std::vector<ConstantLoadRequest> requests;
+        for (uint32_t idx = 0; idx < NUM_LOADED_CONSTANTS; ++idx) {
+            requests.push_back({idx, stagingOf(idx), LOADED_CONSTANT_SIZE});
+        }
+        return LoadConstants(*loader, requests, [](size_t, bool) {}, *options) && checkStaging();
+    };
+
+    LoadConstantsOptions threadPool;
+    threadPool.backend = LoadBackend::THREAD_POOL;
+    LoadConstantsOptions ioUring;
+    ioUring.backend = LoadBackend::IO_URING;
+    const bool withIoUring = IsIoUringSupported();
+
+    std::vector<Clock::duration> mappedSamples;
+    std::vector<Clock::duration> readSamples;
+    std::vector<Clock::duration> threadPoolSamples;
+    std::vector<Clock::duration> ioUringSamples;
+    bool valid = true;
+    for (size_t i = 0; i < repetitions; ++i) {
+        TimeLoad(path, loadMapped, mappedSamples, valid);
+        TimeLoad(path, [&] { return loadConstants(nullptr); }, readSamples, valid);
+        TimeLoad(path, [&] { return loadConstants(&threadPool); }, threadPoolSamples, valid);
+        if (withIoUring) {
+            TimeLoad(path, [&] { return loadConstants(&ioUring); }, ioUringSamples, valid);
+        }
+    }
+    const bool cold = DropPageCache(path);
+    std::filesystem::remove(path);
+    if (!valid) {
+        std::cerr << "Loaded constants differ from the encoded constants" << std::endl;
+        return;
+    }
+
+    const double mappedMs = MedianMilliseconds(mappedSamples);
+    const double threadPoolMs = MedianMilliseconds(threadPoolSamples);
+    const std::string size = std::to_string(NUM_LOADED_CONSTANTS) + " x " +
+                             std::to_string(LOADED_CONSTANT_SIZE >> 10) + " KiB constants" +
+                             (cold ? ", cold page cache" : ", page cache could not be dropped");
+    Report("Copy from mapped file, " + size, mappedMs);
+    Report("readConstant per constant, " + size, MedianMilliseconds(readSamples));
+    Report("LoadConstants thread pool, " + size, threadPoolMs);
+    ReportSpeedup("LoadConstants thread pool", mappedMs, threadPoolMs);
+    if (withIoUring) {
+        const double ioUringMs = MedianMilliseconds(ioUringSamples);
+        Report("LoadConstants io_uring, " + size, ioUringMs);
+        ReportSpeedup("LoadConstants io_uring", mappedMs, ioUringMs);
+    }
+}
+
+} // namespace mlsdk::vgflib::benchmarks
@@ -50,6 +50,11 @@ typedef struct mlsdk_decoder_push_constants_range_decoder_s *mlsdk_decoder_push_
 typedef struct mlsdk_decoder_model_sequence_decoder_s *mlsdk_decoder_model_sequence_decoder;
 typedef struct mlsdk_decoder_model_resource_table_decoder_s *mlsdk_decoder_model_resource_table_decoder;
 typedef struct mlsdk_decoder_constant_table_decoder_s *mlsdk_decoder_constant_table_decoder;
+typedef struct mlsdk_decoder_model_s *mlsdk_decoder_model;
+typedef struct mlsdk_decoder_loader_s *mlsdk_decoder_loader;
+typedef struct mlsdk_decoder_name_index_s *mlsdk_decoder_name_index;
+typedef struct mlsdk_decoder_resource_index_s *mlsdk_decoder_resource_index;
+typedef struct mlsdk_decoder_segment_graph_s *mlsdk_decoder_segment_graph;
 typedef struct mlsdk_decoder_names_handle_s const *mlsdk_decoder_names_handle;
 typedef struct mlsdk_decoder_sampler_config_handle_s const *mlsdk_decoder_sampler_config_handle;
 
@@ -75,6 +80,16 @@ typedef enum {
     mlsdk_decoder_section_constants = 3,
 } mlsdk_decoder_section;
 
+/**
+ * @brief Result of a section checksum check
+ */
+typedef enum {
+    mlsdk_decoder_integrity_valid = 0,        ///< the checksum matches the section contents
+    mlsdk_decoder_integrity_corrupted = 1,    ///< the checksum does not match, the section is torn or corrupted
+    mlsdk_decoder_integrity_no_checksums = 2, ///< the file was encoded without section checksums
+    mlsdk_decoder_integrity_invalid_file = 3, ///< the header is invalid or a section lies outside of the file
+} mlsdk_decoder_integrity_status;
+
 /**
  * @brief Type for VkDescriptorType enum
  *
@@ -179,6 +194,79 @@ typedef struct {
     size_t size;
 } mlsdk_decoder_tensor_dimensions;
 
+/**
+ * @brief The index list view
+ */
+typedef struct {
+    const uint32_t *data;
+    size_t size;
+} mlsdk_decoder_index_list;
+
+/**
+ * @brief Byte size and layout traits of a tensor filled by mlsdk_decoder_model_resource_table_get_tensor_layout
+ */
+typedef struct {
+    uint64_t element_count;    ///< number of elements, the product of the shape
+    uint64_t element_size;     ///< size in bytes of an element of the format
+    uint64_t packed_byte_size; ///< size in bytes of the elements without padding
+    uint64_t span_byte_size;   ///< size in bytes from the first element to the end of the last element
+    bool contiguous;           ///< true when the strides describe the packed row-major layout
+} mlsdk_decoder_tensor_layout;
+
+/**
+ * @brief Placement of an intermediate resource filled by mlsdk_decoder_plan_intermediate_memory
+ */
+typedef struct {
+    uint32_t mrt_index;     ///< index of the intermediate in the model resource table
+    uint64_t offset;        ///< offset in bytes of the storage in the arena
+    uint64_t size;          ///< size in bytes of the storage, shared by every intermediate of an alias group
+    uint32_t first_segment; ///< first segment referring to the storage
+    uint32_t last_segment;  ///< last segment referring to the storage
+} mlsdk_decoder_intermediate_allocation;
+
+/**
+ * @brief Hit and miss counters of the verification cache
+ */
+typedef struct {
+    uint64_t hits;   ///< sections whose verification was skipped
+    uint64_t misses; ///< sections that were verified because their digest was not cached
+} mlsdk_decoder_verification_cache_stats;
+
+/**
+ * @brief Packed copy of a binding slot filled by mlsdk_decoder_binding_slot_get_infos
+ */
+typedef struct {
+    uint32_t binding;   ///< binding id of the slot
+    uint32_t mrt_index; ///< index of the slot resource in the model resource table
+} mlsdk_decoder_binding_slot_info;
+
+/**
+ * @brief Packed copy of a model resource table entry filled by mlsdk_decoder_model_resource_table_get_entry_infos
+ */
+typedef struct {
+    mlsdk_vk_format vk_format;                ///< format of the resource
+    mlsdk_decoder_mrt_category category;      ///< category of the resource
+    mlsdk_vk_descriptor_type descriptor_type; ///< descriptor type, valid when has_descriptor_type is true
+    mlsdk_alias_group_id alias_group_id;      ///< alias group id, valid when has_alias_group_id is true
+    uint32_t rank;                            ///< number of dimensions of the tensor shape
+    bool has_descriptor_type;                 ///< true when the entry has a descriptor type
+    bool has_alias_group_id;                  ///< true when the entry shares storage with peer MRT resources
+} mlsdk_decoder_mrt_entry_info;
+
+/**
+ * @brief Packed summary of a segment filled by mlsdk_decoder_model_sequence_get_segment_summaries
+ */
+typedef struct {
+    mlsdk_decoder_module_type type;              ///< type of the segment
+    uint32_t module_index;                       ///< index of the segment module in the module table
+    uint32_t num_descriptor_set_infos;           ///< number of descriptor set infos
+    uint32_t num_inputs;                         ///< number of input binding slots
+    uint32_t num_outputs;                        ///< number of output binding slots
+    uint32_t num_constants;                      ///< number of constant indexes
+    uint32_t num_push_constant_ranges;           ///< number of push constant ranges
+    mlsdk_decoder_dispatch_shape dispatch_shape; ///< dispatch shape, zeroes when not present
+} mlsdk_decoder_segment_summary;
+
 /**
  * @brief Gets the library version
  *
@@ -278,6 +366,26 @@ MLSDKAPI void mlsdk_decoder_get_header_section_info(const mlsdk_decoder_header_d
                                                     mlsdk_decoder_section sectionName,
                                                     mlsdk_decoder_vgf_section_info *section);
 
+/**
+ * @brief Checks the CRC32C checksum of one section of a VGF file held in memory against the header
+ *
+ * @param data The pointer to the start of the VGF data
+ * @param size The total size in bytes of the full VGF file
+ * @param sectionName Section to check
+ * @return The integrity status of the section
+ */
+MLSDKAPI mlsdk_decoder_integrity_status mlsdk_decoder_check_section_integrity(const void *data, uint64_t size,
+                                                                              mlsdk_decoder_section sectionName);
+
+/**
+ * @brief Checks the CRC32C checksums of all the sections of a VGF file held in memory against the header
+ *
+ * @param data The pointer to the start of the VGF data
+ * @param size The total size in bytes of the full VGF file
+ * @return mlsdk_decoder_integrity_valid if every section matches, otherwise the first failing status
+ */
+MLSDKAPI mlsdk_decoder_integrity_status mlsdk_decoder_check_integrity(const void *data, uint64_t size);
+
 /**
  * @brief Returns the memory requirements in bytes to allocate memory for creating the module table decoder
  * @return The size in bytes of the memory needed to create the module table decoder
@@ -484,6 +592,19 @@ mlsdk_decoder_binding_slot_binding_id(const mlsdk_decoder_model_sequence_decoder
 MLSDKAPI uint32_t mlsdk_decoder_binding_slot_mrt_index(const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder,
                                                        mlsdk_decoder_binding_slots_handle handle, uint32_t slotIdx);
 
+/**
+ * @brief Copies the binding id and mrt index of every binding slot of a handle in a single call
+ *
+ * @param modelSequenceDecoder The pointer to the model sequence decoder
+ * @param handle The handle to the binding slots array
+ * @param infos Caller-provided array receiving the binding slots
+ * @param capacity Number of elements available in infos
+ * @return Number of binding slots written, i.e. the smaller of capacity and mlsdk_decoder_binding_slot_size
+ */
+MLSDKAPI size_t mlsdk_decoder_binding_slot_get_infos(const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder,
+                                                     mlsdk_decoder_binding_slots_handle handle,
+                                                     mlsdk_decoder_binding_slot_info *infos, size_t capacity);
+
 /**********************************************************************************************************************/
 
 /**
@@ -747,6 +868,19 @@ MLSDKAPI size_t mlsdk_decoder_model_sequence_get_names_size(
 MLSDKAPI const char *
 mlsdk_decoder_model_sequence_get_name(const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder,
                                       mlsdk_decoder_names_handle handle, uint32_t nameIdx);
+
+/**
+ * @brief Copies a summary of every segment of the model sequence in a single call
+ *
+ * @param modelSequenceDecoder The pointer to the model sequence decoder
+ * @param summaries Caller-provided array receiving the segment summaries
+ * @param capacity Number of elements available in summaries
+ * @return Number of segments written, i.e. the smaller of capacity and mlsdk_decoder_get_model_sequence_table_size
+ */
+MLSDKAPI size_t
+mlsdk_decoder_model_sequence_get_segment_summaries(const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder,
+                                                   mlsdk_decoder_segment_summary *summaries, size_t capacity);
+
 /**
  * @brief Returns the memory requirements in bytes to allocate memory for creating the model resource table decoder
  * @return The size in bytes of the memory needed to create the model resource table decoder
@@ -840,6 +974,31 @@ MLSDKAPI void mlsdk_decoder_model_resource_table_get_tensor_strides(
     const mlsdk_decoder_model_resource_table_decoder *modelResourceTableDecoder, uint32_t mrtIdx,
     mlsdk_decoder_tensor_dimensions *dimensions);
 
+/**
+ * @brief Gets the byte size and layout traits of the idx-entry in the model resource table
+ *
+ * @param modelResourceTableDecoder The pointer to the model resource table decoder
+ * @param mrtIdx The index for the entry in the model resource table
+ * @param layout The pointer to the layout of the model resource table entry
+ * @return true on success, false when the entry has an unshaped or negative dimension, a negative stride, strides not
+ *         matching the shape rank, a format of unknown size, or a size overflowing 64 bits
+ */
+MLSDKAPI bool mlsdk_decoder_model_resource_table_get_tensor_layout(
+    const mlsdk_decoder_model_resource_table_decoder *modelResourceTableDecoder, uint32_t mrtIdx,
+    mlsdk_decoder_tensor_layout *layout);
+
+/**
+ * @brief Copies the scalar properties of every model resource table entry in a single call
+ *
+ * @param modelResourceTableDecoder The pointer to the model resource table decoder
+ * @param infos Caller-provided array receiving the entries
+ * @param capacity Number of elements available in infos
+ * @return Number of entries written, i.e. the smaller of capacity and the number of entries in the table
+ */
+MLSDKAPI size_t mlsdk_decoder_model_resource_table_get_entry_infos(
+    const mlsdk_decoder_model_resource_table_decoder *modelResourceTableDecoder, mlsdk_decoder_mrt_entry_info *infos,
+    size_t capacity);
+
 /**
  * @brief Returns a sampler-config handle for sampled-image resources
  *
@@ -966,6 +1125,28 @@ MLSDKAPI bool mlsdk_decoder_constant_table_is_sparse(const mlsdk_decoder_constan
 MLSDKAPI int64_t mlsdk_decoder_constant_table_get_sparsity_dimension(
     const mlsdk_decoder_constant_table_decoder *constantDecoder, uint32_t constidx);
 
+/**
+ * @brief Returns the file offset alignment the encoder guaranteed for the constant
+ *
+ * @param constantDecoder The pointer to the constant table decoder
+ * @param constidx The index for the entry in the constant table
+ * @return The alignment in bytes, or 0 if the index is invalid
+ */
+MLSDKAPI uint64_t mlsdk_decoder_constant_table_get_alignment(
+    const mlsdk_decoder_constant_table_decoder *constantDecoder, uint32_t constidx);
+
+/**
+ * @brief Returns true if the file offset of the constant is a multiple of the given alignment
+ *
+ * @param constantDecoder The pointer to the constant table decoder
+ * @param constidx The index for the entry in the constant table
+ * @param sectionOffset The file offset of the constants section
+ * @param alignment The required alignment in bytes
+ * @return true if the constant can be used in place with the given alignment or false otherwise
+ */
+MLSDKAPI bool mlsdk_decoder_constant_table_is_aligned(const mlsdk_decoder_constant_table_decoder *constantDecoder,
+                                                      uint32_t constidx, uint64_t sectionOffset, uint64_t alignment);
+
 /**
  * @brief Returns the number of entries in the constant table
  *
@@ -975,6 +1156,496 @@ MLSDKAPI int64_t mlsdk_decoder_constant_table_get_sparsity_dimension(
 MLSDKAPI size_t
 mlsdk_decoder_get_constant_table_num_entries(const mlsdk_decoder_constant_table_decoder *constantDecoder);
 
+/**
+ * @brief Called with the chunks of a constant in order
+ *
+ * @param userData The user data passed along with the callback
+ * @param offset The offset of the chunk from the start of the constant
+ * @param data The bytes of the chunk, only valid during the call
+ * @param size The size in bytes of the chunk
+ * @return false to stop the iteration
+ */
+typedef bool (*mlsdk_decoder_constant_chunk_callback)(void *userData, uint64_t offset, const uint8_t *data,
+                                                      size_t size);
+
+/**
+ * @brief Passes a constant to a callback in chunks of at most chunkSize bytes
+ *
+ * The chunks point into the constant table data, so nothing is copied or allocated.
+ *
+ * @param constantDecoder The pointer to the constant table decoder
+ * @param constidx The index for the entry in the constant table
+ * @param chunkSize The maximum size in bytes of a chunk
+ * @param callback The callback receiving the chunks
+ * @param userData The user data passed to the callback
+ * @return false if constidx is invalid, chunkSize is 0 or the callback stopped the iteration
+ */
+MLSDKAPI bool mlsdk_decoder_constant_table_for_each_chunk(const mlsdk_decoder_constant_table_decoder *constantDecoder,
+                                                          uint32_t constidx, uint64_t chunkSize,
+                                                          mlsdk_decoder_constant_chunk_callback callback,
+                                                          void *userData);
+
+/**********************************************************************************************************************/
+
+/**
+ * @brief Returns the memory requirements in bytes to allocate memory for creating the model, including all of its
+ * section decoders
+ * @return The size in bytes of the memory needed to create the model
+ */
+MLSDKAPI size_t mlsdk_decoder_model_mem_reqs();
+
+/**
+ * @brief Creates the model decoding the header and all the sections of a VGF file held in memory
+ *
+ * The header and every section are validated once. The file contents must outlive the model.
+ *
+ * @param data The pointer to the start of the VGF data
+ * @param size The total size in bytes of the full VGF file
+ * @param modelMemory Memory allocated to be used to create the model
+ * @return The pointer to the newly created model (nullptr if the file is invalid)
+ */
+MLSDKAPI mlsdk_decoder_model *mlsdk_decoder_create_model(const void *data, uint64_t size, void *modelMemory);
+
+/**
+ * @brief Returns the header decoder of the model
+ *
+ * @param model The pointer to the model
+ * @return The pointer to the header decoder, owned by the model
+ */
+MLSDKAPI const mlsdk_decoder_header_decoder *mlsdk_decoder_model_get_header_decoder(const mlsdk_decoder_model *model);
+
+/**
+ * @brief Returns the module table decoder of the model
+ *
+ * @param model The pointer to the model
+ * @return The pointer to the module table decoder, owned by the model
+ */
+MLSDKAPI const mlsdk_decoder_module_table_decoder *
+mlsdk_decoder_model_get_module_table_decoder(const mlsdk_decoder_model *model);
+
+/**
+ * @brief Returns the model sequence decoder of the model
+ *
+ * @param model The pointer to the model
+ * @return The pointer to the model sequence decoder, owned by the model
+ */
+MLSDKAPI const mlsdk_decoder_model_sequence_decoder *
+mlsdk_decoder_model_get_model_sequence_decoder(const mlsdk_decoder_model *model);
+
+/**
+ * @brief Returns the model resource table decoder of the model
+ *
+ * @param model The pointer to the model
+ * @return The pointer to the model resource table decoder, owned by the model
+ */
+MLSDKAPI const mlsdk_decoder_model_resource_table_decoder *
+mlsdk_decoder_model_get_model_resource_table_decoder(const mlsdk_decoder_model *model);
+
+/**
+ * @brief Returns the constant table decoder of the model
+ *
+ * @param model The pointer to the model
+ * @return The pointer to the constant table decoder, owned by the model
+ */
+MLSDKAPI const mlsdk_decoder_constant_table_decoder *
+mlsdk_decoder_model_get_constant_table_decoder(const mlsdk_decoder_model *model);
+
+/**********************************************************************************************************************/
+
+/**
+ * @brief Creates a loader reading a VGF file with positional reads, without mapping it
+ *
+ * The header, the module, model sequence and model resource table sections and the metadata of the constants are read
+ * when the loader is created. The data of the constants is only read on request.
+ *
+ * @param path The path of the VGF file
+ * @return The pointer to the loader (nullptr if the file cannot be read or is invalid). Destroy with
+ * mlsdk_decoder_destroy_loader.
+ */
+MLSDKAPI mlsdk_decoder_loader *mlsdk_decoder_create_file_loader(const char *path);
+
+/**
+ * @brief Destroys a loader created by mlsdk_decoder_create_file_loader, closing its file
+ *
+ * @param loader The pointer to the loader
+ */
+MLSDKAPI void mlsdk_decoder_destroy_loader(mlsdk_decoder_loader *loader);
+
+/**
+ * @brief Returns the header decoder of the loader
+ *
+ * @param loader The pointer to the loader
+ * @return The pointer to the header decoder, owned by the loader
+ */
+MLSDKAPI const mlsdk_decoder_header_decoder *
+mlsdk_decoder_loader_get_header_decoder(const mlsdk_decoder_loader *loader);
+
+/**
+ * @brief Returns the module table decoder of the loader
+ *
+ * @param loader The pointer to the loader
+ * @return The pointer to the module table decoder, owned by the loader
+ */
+MLSDKAPI const mlsdk_decoder_module_table_decoder *
+mlsdk_decoder_loader_get_module_table_decoder(const mlsdk_decoder_loader *loader);
+
+/**
+ * @brief Returns the model sequence decoder of the loader
+ *
+ * @param loader The pointer to the loader
+ * @return The pointer to the model sequence decoder, owned by the loader
+ */
+MLSDKAPI const mlsdk_decoder_model_sequence_decoder *
+mlsdk_decoder_loader_get_model_sequence_decoder(const mlsdk_decoder_loader *loader);
+
+/**
+ * @brief Returns the model resource table decoder of the loader
+ *
+ * @param loader The pointer to the loader
+ * @return The pointer to the model resource table decoder, owned by the loader
+ */
+MLSDKAPI const mlsdk_decoder_model_resource_table_decoder *
+mlsdk_decoder_loader_get_model_resource_table_decoder(const mlsdk_decoder_loader *loader);
+
+/**
+ * @brief Returns the number of constants of the loaded file
+ *
+ * @param loader The pointer to the loader
+ * @return The number of constants
+ */
+MLSDKAPI size_t mlsdk_decoder_loader_get_num_constants(const mlsdk_decoder_loader *loader);
+
+/**
+ * @brief Returns the model resource table index of a constant
+ *
+ * @param loader The pointer to the loader
+ * @param constidx The index of the constant
+ * @return The MRT index of the constant (CONSTANT_INVALID_MRT_INDEX if constidx is invalid)
+ */
+MLSDKAPI uint32_t mlsdk_decoder_loader_get_constant_mrt_index(const mlsdk_decoder_loader *loader, uint32_t constidx);
+
+/**
+ * @brief Returns the size in bytes of a constant
+ *
+ * @param loader The pointer to the loader
+ * @param constidx The index of the constant
+ * @return The size in bytes of the constant (0 if constidx is invalid)
+ */
+MLSDKAPI uint64_t mlsdk_decoder_loader_get_constant_size(const mlsdk_decoder_loader *loader, uint32_t constidx);
+
+/**
+ * @brief Reads a constant into a buffer of the caller
+ *
+ * @param loader The pointer to the loader
+ * @param constidx The index of the constant
+ * @param dst The destination buffer
+ * @param capacity The size in bytes of the destination buffer
+ * @return false if constidx is invalid, the buffer is too small or the read failed
+ */
+MLSDKAPI bool mlsdk_decoder_loader_read_constant(const mlsdk_decoder_loader *loader, uint32_t constidx, void *dst,
+                                                 uint64_t capacity);
+
+/**
+ * @brief Reads a constant in chunks into a staging buffer of the caller, passing each chunk to a callback
+ *
+ * Only one chunk of at most stagingSize bytes is held in memory at a time, whatever the size of the constant. The
+ * chunks point into the staging buffer, which the next chunk overwrites.
+ *
+ * @param loader The pointer to the loader
+ * @param constidx The index of the constant
+ * @param staging The staging buffer
+ * @param stagingSize The size in bytes of the staging buffer
+ * @param callback The callback receiving the chunks
+ * @param userData The user data passed to the callback
+ * @return false if constidx is invalid, the staging buffer is empty, a read failed or the callback stopped the
+ * iteration
+ */
+MLSDKAPI bool mlsdk_decoder_loader_for_each_constant_chunk(const mlsdk_decoder_loader *loader, uint32_t constidx,
+                                                           void *staging, uint64_t stagingSize,
+                                                           mlsdk_decoder_constant_chunk_callback callback,
+                                                           void *userData);
+
+/**********************************************************************************************************************/
+
+/**
+ * @brief Returns the memory requirements in bytes to allocate memory for creating the name index of the decoders
+ *
+ * @param moduleTableDecoder The pointer to the module table decoder
+ * @param modelSequenceDecoder The pointer to the model sequence decoder
+ * @return The size in bytes of the memory needed to create the name index
+ */
+MLSDKAPI size_t mlsdk_decoder_name_index_mem_reqs(const mlsdk_decoder_module_table_decoder *moduleTableDecoder,
+                                                  const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder);
+
+/**
+ * @brief Create a hash index of the names of the model inputs, outputs, modules and segments
+ *
+ * The decoders must outlive the index.
+ *
+ * @param moduleTableDecoder The pointer to the module table decoder
+ * @param modelSequenceDecoder The pointer to the model sequence decoder
+ * @param nameIndexMemory Memory of at least mlsdk_decoder_name_index_mem_reqs bytes to create the index into
+ * @return The pointer to the newly created name index
+ */
+MLSDKAPI mlsdk_decoder_name_index *
+mlsdk_decoder_create_name_index(const mlsdk_decoder_module_table_decoder *moduleTableDecoder,
+                                const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder,
+                                void *nameIndexMemory);
+
+/**
+ * @brief Finds the model sequence input with the given name
+ *
+ * @param nameIndex The pointer to the name index
+ * @param name Null-terminated name of the input
+ * @param idx The pointer to receive the index of the input in the model sequence input names
+ * @return true if an input has that name, false otherwise
+ */
+MLSDKAPI bool mlsdk_decoder_name_index_find_input_by_name(const mlsdk_decoder_name_index *nameIndex, const char *name,
+                                                          uint32_t *idx);
+
+/**
+ * @brief Finds the model sequence output with the given name
+ *
+ * @param nameIndex The pointer to the name index
+ * @param name Null-terminated name of the output
+ * @param idx The pointer to receive the index of the output in the model sequence output names
+ * @return true if an output has that name, false otherwise
+ */
+MLSDKAPI bool mlsdk_decoder_name_index_find_output_by_name(const mlsdk_decoder_name_index *nameIndex, const char *name,
+                                                           uint32_t *idx);
+
+/**
+ * @brief Finds the module with the given name
+ *
+ * @param nameIndex The pointer to the name index
+ * @param name Null-terminated name of the module
+ * @param idx The pointer to receive the index of the module in the module table
+ * @return true if a module has that name, false otherwise
+ */
+MLSDKAPI bool mlsdk_decoder_name_index_find_module_by_name(const mlsdk_decoder_name_index *nameIndex, const char *name,
+                                                           uint32_t *idx);
+
+/**
+ * @brief Finds the segment with the given name
+ *
+ * @param nameIndex The pointer to the name index
+ * @param name Null-terminated name of the segment
+ * @param idx The pointer to receive the index of the segment in the model sequence
+ * @return true if a segment has that name, false otherwise
+ */
+MLSDKAPI bool mlsdk_decoder_name_index_find_segment_by_name(const mlsdk_decoder_name_index *nameIndex,
+                                                            const char *name, uint32_t *idx);
+
+/**********************************************************************************************************************/
+
+/**
+ * @brief Create the reverse indexes of the model resource table entries
+ *
+ * The index owns its data, so the decoders may be destroyed once it is created.
+ *
+ * @param modelSequenceDecoder The pointer to the model sequence decoder
+ * @param modelResourceTableDecoder The pointer to the model resource table decoder
+ * @param constantDecoder The pointer to the constant table decoder
+ * @return The pointer to the resource index. Destroy with mlsdk_decoder_destroy_resource_index.
+ */
+MLSDKAPI mlsdk_decoder_resource_index *
+mlsdk_decoder_create_resource_index(const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder,
+                                    const mlsdk_decoder_model_resource_table_decoder *modelResourceTableDecoder,
+                                    const mlsdk_decoder_constant_table_decoder *constantDecoder);
+
+/**
+ * @brief Destroys a resource index created by mlsdk_decoder_create_resource_index
+ *
+ * @param resourceIndex The pointer to the resource index
+ */
+MLSDKAPI void mlsdk_decoder_destroy_resource_index(mlsdk_decoder_resource_index *resourceIndex);
+
+/**
+ * @brief Gets the constants holding the data of a model resource table entry
+ *
+ * @param resourceIndex The pointer to the resource index
+ * @param mrtIdx The index for the entry in the model resource table
+ * @param constants The pointer to the list receiving the constant indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_resource_index_get_constants(const mlsdk_decoder_resource_index *resourceIndex,
+                                                         uint32_t mrtIdx, mlsdk_decoder_index_list *constants);
+
+/**
+ * @brief Gets the segments listing a model resource table entry among their outputs
+ *
+ * @param resourceIndex The pointer to the resource index
+ * @param mrtIdx The index for the entry in the model resource table
+ * @param segments The pointer to the list receiving the segment indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_resource_index_get_producer_segments(const mlsdk_decoder_resource_index *resourceIndex,
+                                                                 uint32_t mrtIdx, mlsdk_decoder_index_list *segments);
+
+/**
+ * @brief Gets the segments listing a model resource table entry among their inputs
+ *
+ * @param resourceIndex The pointer to the resource index
+ * @param mrtIdx The index for the entry in the model resource table
+ * @param segments The pointer to the list receiving the segment indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_resource_index_get_consumer_segments(const mlsdk_decoder_resource_index *resourceIndex,
+                                                                 uint32_t mrtIdx, mlsdk_decoder_index_list *segments);
+
+/**
+ * @brief Gets the segments binding a model resource table entry in one of their descriptor sets
+ *
+ * @param resourceIndex The pointer to the resource index
+ * @param mrtIdx The index for the entry in the model resource table
+ * @param segments The pointer to the list receiving the segment indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_resource_index_get_binding_segments(const mlsdk_decoder_resource_index *resourceIndex,
+                                                                uint32_t mrtIdx, mlsdk_decoder_index_list *segments);
+
+/**
+ * @brief Gets the alias group ids used by the model resource table
+ *
+ * @param resourceIndex The pointer to the resource index
+ * @param aliasGroupIds The pointer to the list receiving the alias group ids, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_resource_index_get_alias_group_ids(const mlsdk_decoder_resource_index *resourceIndex,
+                                                               mlsdk_decoder_index_list *aliasGroupIds);
+
+/**
+ * @brief Gets the model resource table entries sharing storage through an alias group
+ *
+ * @param resourceIndex The pointer to the resource index
+ * @param aliasGroupId The id of the alias group
+ * @param members The pointer to the list receiving the entry indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_resource_index_get_alias_group_members(const mlsdk_decoder_resource_index *resourceIndex,
+                                                                   mlsdk_alias_group_id aliasGroupId,
+                                                                   mlsdk_decoder_index_list *members);
+
+/**********************************************************************************************************************/
+
+/**
+ * @brief Create the dependency graph of the segments of a model sequence
+ *
+ * The graph owns its data, so the decoder may be destroyed once it is created.
+ *
+ * @param modelSequenceDecoder The pointer to the model sequence decoder
+ * @return The pointer to the segment graph. Destroy with mlsdk_decoder_destroy_segment_graph.
+ */
+MLSDKAPI mlsdk_decoder_segment_graph *
+mlsdk_decoder_create_segment_graph(const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder);
+
+/**
+ * @brief Destroys a segment graph created by mlsdk_decoder_create_segment_graph
+ *
+ * @param segmentGraph The pointer to the segment graph
+ */
+MLSDKAPI void mlsdk_decoder_destroy_segment_graph(mlsdk_decoder_segment_graph *segmentGraph);
+
+/**
+ * @brief Gets the segments that must complete before a segment starts
+ *
+ * @param segmentGraph The pointer to the segment graph
+ * @param segmentIdx The index for the segment in the model sequence
+ * @param segments The pointer to the list receiving the segment indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_segment_graph_get_predecessors(const mlsdk_decoder_segment_graph *segmentGraph,
+                                                           uint32_t segmentIdx, mlsdk_decoder_index_list *segments);
+
+/**
+ * @brief Gets the segments that must wait for a segment to complete
+ *
+ * @param segmentGraph The pointer to the segment graph
+ * @param segmentIdx The index for the segment in the model sequence
+ * @param segments The pointer to the list receiving the segment indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_segment_graph_get_successors(const mlsdk_decoder_segment_graph *segmentGraph,
+                                                         uint32_t segmentIdx, mlsdk_decoder_index_list *segments);
+
+/**
+ * @brief Returns the topological level of a segment, one more than the highest level of its predecessors
+ *
+ * @param segmentGraph The pointer to the segment graph
+ * @param segmentIdx The index for the segment in the model sequence
+ * @return The level of the segment
+ */
+MLSDKAPI uint32_t mlsdk_decoder_segment_graph_get_level(const mlsdk_decoder_segment_graph *segmentGraph,
+                                                        uint32_t segmentIdx);
+
+/**
+ * @brief Returns the number of topological levels, which is the length of the critical path
+ *
+ * @param segmentGraph The pointer to the segment graph
+ * @return The number of levels
+ */
+MLSDKAPI size_t mlsdk_decoder_segment_graph_get_num_levels(const mlsdk_decoder_segment_graph *segmentGraph);
+
+/**
+ * @brief Gets the segments of a topological level, which can all be in flight together
+ *
+ * @param segmentGraph The pointer to the segment graph
+ * @param level The level, lower than mlsdk_decoder_segment_graph_get_num_levels
+ * @param segments The pointer to the list receiving the segment indexes, in increasing order
+ */
+MLSDKAPI void mlsdk_decoder_segment_graph_get_level_segments(const mlsdk_decoder_segment_graph *segmentGraph,
+                                                             uint32_t level, mlsdk_decoder_index_list *segments);
+
+/**
+ * @brief Gets a longest chain of dependent segments
+ *
+ * @param segmentGraph The pointer to the segment graph
+ * @param segments The pointer to the list receiving the segment indexes, in execution order
+ */
+MLSDKAPI void mlsdk_decoder_segment_graph_get_critical_path(const mlsdk_decoder_segment_graph *segmentGraph,
+                                                            mlsdk_decoder_index_list *segments);
+
+/**********************************************************************************************************************/
+
+/**
+ * @brief Assigns every intermediate resource referred to by a segment an offset in a single arena
+ *
+ * Intermediates whose lifetimes do not overlap reuse the same bytes and intermediates sharing an alias group share
+ * their storage. The number of allocations is at most the number of model resource table entries.
+ *
+ * @param modelSequenceDecoder The pointer to the model sequence decoder
+ * @param modelResourceTableDecoder The pointer to the model resource table decoder
+ * @param alignment Alignment in bytes of every offset and size in the arena, must be a power of two
+ * @param allocations The array receiving the allocations in increasing MRT index order, may be null if capacity is 0
+ * @param capacity The number of elements in allocations
+ * @param numAllocations The pointer to receive the number of allocations in the plan
+ * @param peakBytes The pointer to receive the size in bytes of the arena
+ * @return false if an intermediate has no static byte size or the alignment is invalid
+ */
+MLSDKAPI bool
+mlsdk_decoder_plan_intermediate_memory(const mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder,
+                                       const mlsdk_decoder_model_resource_table_decoder *modelResourceTableDecoder,
+                                       uint64_t alignment, mlsdk_decoder_intermediate_allocation *allocations,
+                                       size_t capacity, size_t *numAllocations, uint64_t *peakBytes);
+
+/**********************************************************************************************************************/
+
+/**
+ * @brief Configures the process-wide verification cache
+ *
+ * While enabled, the section decoders skip the verification of sections whose digest matches a section verified
+ * before. The digest is not cryptographic, so the cache must only be enabled for trusted files.
+ *
+ * @param enabled Whether sections are looked up in and recorded into the cache
+ * @param sidecarPath Optional file persisting the digests across processes (nullptr to keep them in memory only)
+ * @return false if the sidecar file could not be read or created
+ */
+MLSDKAPI bool mlsdk_decoder_configure_verification_cache(bool enabled, const char *sidecarPath);
+
+/**
+ * @brief Drops every digest recorded in the verification cache, including those in the sidecar file
+ */
+MLSDKAPI void mlsdk_decoder_invalidate_verification_cache();
+
+/**
+ * @brief Gets the hit and miss counters of the verification cache
+ *
+ * @param stats The pointer to the struct to write the counters to
+ */
+MLSDKAPI void mlsdk_decoder_get_verification_cache_stats(mlsdk_decoder_verification_cache_stats *stats);
+
 /**@}*/
 
 #ifdef __cplusplus
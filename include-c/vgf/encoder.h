@@ -157,6 +157,20 @@ typedef struct {
  */
 MLSDKAPI mlsdk_encoder *mlsdk_encoder_create(mlsdk_encoder_vk_header_version vkHeaderVersion);
 
+/**
+ * @brief Creates a VGF encoder that streams constant data to a file as it is added.
+ *
+ * The file is completed by mlsdk_encoder_close; mlsdk_encoder_write_to_file is not supported.
+ *
+ * @param vkHeaderVersion Value of VK_HEADER_VERSION used when encoding the VGF.
+ * @param path Output file path. The file is truncated.
+ * @param constantCountHint Number of constants to reserve metadata room for. Exceeding it moves the streamed data
+ *                          once when closing.
+ * @return Encoder handle, or nullptr if the file cannot be opened. Destroy with mlsdk_encoder_destroy.
+ */
+MLSDKAPI mlsdk_encoder *mlsdk_encoder_create_streaming(mlsdk_encoder_vk_header_version vkHeaderVersion,
+                                                       const char *path, uint64_t constantCountHint);
+
 /**
  * @brief Destroys a VGF encoder.
  *
@@ -344,6 +358,17 @@ MLSDKAPI void mlsdk_encoder_add_sampler_config(mlsdk_encoder *encoder, mlsdk_enc
 MLSDKAPI void mlsdk_encoder_set_alias_group(mlsdk_encoder *encoder, mlsdk_encoder_resource_ref resource,
                                             mlsdk_encoder_alias_group_id aliasGroupId);
 
+/**
+ * @brief Sets the file offset alignment of the constants added afterwards.
+ *
+ * Alignments above 8 bytes are recorded in the constants section.
+ *
+ * @param encoder Encoder handle.
+ * @param alignment Power of two alignment in bytes. Values below 8 use the default 8-byte alignment. Other values are
+ * rejected with an error and leave the alignment unchanged.
+ */
+MLSDKAPI void mlsdk_encoder_set_constant_alignment(mlsdk_encoder *encoder, uint64_t alignment);
+
 /**
  * @brief Adds constant bytes for a constant resource.
  *
@@ -358,6 +383,33 @@ MLSDKAPI mlsdk_encoder_constant_ref mlsdk_encoder_add_constant(mlsdk_encoder *en
                                                                mlsdk_encoder_resource_ref resource, const void *data,
                                                                size_t sizeInBytes, int64_t sparsityDimension);
 
+/**
+ * @brief Callback invoked when the encoder no longer references borrowed constant data.
+ *
+ * @param userData User pointer passed to mlsdk_encoder_add_borrowed_constant.
+ */
+typedef void (*mlsdk_encoder_release_callback)(void *userData);
+
+/**
+ * @brief Adds constant bytes for a constant resource without copying them into the encoder.
+ *
+ * The data must stay valid and unchanged until the encoder is written or destroyed. Payload padding is produced
+ * at write time.
+ *
+ * @param encoder Encoder handle.
+ * @param resource Reference to a constant resource in the model resource table.
+ * @param data Pointer to constant data bytes.
+ * @param sizeInBytes Size of constant data in bytes.
+ * @param sparsityDimension Sparse dimension, or MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION for non-sparse constants.
+ * @param release Optional callback invoked once the data is no longer referenced. May be nullptr.
+ * @param userData User pointer passed to release.
+ * @return Reference to the added constant.
+ */
+MLSDKAPI mlsdk_encoder_constant_ref
+mlsdk_encoder_add_borrowed_constant(mlsdk_encoder *encoder, mlsdk_encoder_resource_ref resource, const void *data,
+                                    size_t sizeInBytes, int64_t sparsityDimension,
+                                    mlsdk_encoder_release_callback release, void *userData);
+
 /**
  * @brief Adds a binding slot associated with a model resource table entry.
  *
@@ -441,6 +493,26 @@ mlsdk_encoder_add_model_sequence_inputs_outputs(mlsdk_encoder *encoder, const ml
                                                 const mlsdk_encoder_binding_slot_ref *outputs, size_t numOutputs,
                                                 const char **outputNames, size_t numOutputNames);
 
+/**
+ * @brief Sets whether the encoder builds the module, model resource and model sequence sections on separate threads.
+ *
+ * The encoded output is identical to a serial finish.
+ *
+ * @param encoder Encoder handle.
+ * @param enable True to finish the sections in parallel.
+ */
+MLSDKAPI void mlsdk_encoder_set_parallel_finish(mlsdk_encoder *encoder, bool enable);
+
+/**
+ * @brief Sets whether the encoder stores the CRC32C of each section in the header of the written file.
+ *
+ * Streaming encoders must enable checksums before adding constants.
+ *
+ * @param encoder Encoder handle.
+ * @param enable True to write section checksums.
+ */
+MLSDKAPI void mlsdk_encoder_set_section_checksums(mlsdk_encoder *encoder, bool enable);
+
 /**
  * @brief Finishes encoding after all VGF contents have been added.
  *
@@ -448,15 +520,60 @@ mlsdk_encoder_add_model_sequence_inputs_outputs(mlsdk_encoder *encoder, const ml
  */
 MLSDKAPI void mlsdk_encoder_finish(mlsdk_encoder *encoder);
 
+/**
+ * @brief Returns the exact size in bytes of the encoded VGF file.
+ *
+ * @param encoder Finished, non-streaming encoder handle.
+ * @return Size in bytes, or 0 on error.
+ */
+MLSDKAPI uint64_t mlsdk_encoder_get_encoded_size(mlsdk_encoder *encoder);
+
+/**
+ * @brief Writes a finished VGF encoder directly into a caller-owned buffer.
+ *
+ * The constant data is released as it is written, so an encoder can only be written once.
+ *
+ * @param encoder Finished, non-streaming encoder handle.
+ * @param dst Destination buffer.
+ * @param capacity Size of the destination buffer in bytes, at least mlsdk_encoder_get_encoded_size().
+ * @return true on success, false otherwise.
+ */
+MLSDKAPI bool mlsdk_encoder_write_to_memory(mlsdk_encoder *encoder, void *dst, size_t capacity);
+
 /**
  * @brief Writes a finished VGF encoder to a file.
  *
+ * The constant data is released as it is written, so an encoder can only be written once.
+ *
  * @param encoder Encoder handle.
  * @param path Output file path.
  * @return true when writing succeeded, false otherwise.
  */
 MLSDKAPI bool mlsdk_encoder_write_to_file(mlsdk_encoder *encoder, const char *path);
 
+/**
+ * @brief Writes a finished VGF encoder to a file from several threads, then syncs the file.
+ *
+ * The file is preallocated to its final size and the sections and constant payloads are written at their final
+ * offsets with positional writes, which suits large models on fast storage. The file is synced to storage before
+ * returning, unlike mlsdk_encoder_write_to_file. The constant data is released as it is written, so an encoder can
+ * only be written once.
+ *
+ * @param encoder Encoder handle.
+ * @param path Output file path.
+ * @param numThreads Maximum number of writer threads, 0 to use the hardware concurrency.
+ * @return true when writing succeeded, false otherwise.
+ */
+MLSDKAPI bool mlsdk_encoder_write_to_file_parallel(mlsdk_encoder *encoder, const char *path, uint32_t numThreads);
+
+/**
+ * @brief Completes the output file of a finished streaming VGF encoder.
+ *
+ * @param encoder Encoder handle returned by mlsdk_encoder_create_streaming.
+ * @return true when writing succeeded, false otherwise.
+ */
+MLSDKAPI bool mlsdk_encoder_close(mlsdk_encoder *encoder);
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -59,6 +59,9 @@ typedef void (*mlsdk_logging_callback)(mlsdk_logging_log_level logLevel, const c
 /**
  * @brief Enables logging functionality
  *
+ * The callback is never called concurrently. It may log again, call into the library or change the callback from the
+ * thread it is called on, but it must not wait for another thread that logs.
+ *
  * @param callback Callback that should be used for processing the log messages
  */
 MLSDKAPI void mlsdk_logging_enable(mlsdk_logging_callback callback);
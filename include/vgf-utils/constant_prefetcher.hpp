@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "vgf-utils/memory_map.hpp"
+#include "vgf/decoder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mlsdk::vgfutils {
+
+/// Byte range of a mapped file
+struct MappedRange {
+    size_t offset = 0;
+    size_t size = 0;
+};
+
+/**
+ * @brief Streams the constants of a mapped VGF file through memory in segment order
+ *
+ * The byte ranges of the constants of every segment are resolved once, with the ranges of constants stored next to
+ * each other merged. A runtime running the segments in order prefetches the constants of the segments ahead of the
+ * current one and evicts the constants of each segment once it ran, so that the resident set of a large model stays
+ * bounded by the lookahead instead of growing to the whole constants section.
+ */
+class ConstantPrefetcher {
+  public:
+    /**
+     * @param mapped Mapping of the whole VGF file, which must outlive the prefetcher
+     * @param modelSequenceTable Decoder of the Model Sequence Table section of the mapped file
+     * @param constants Decoder of the Constants section of the mapped file
+     * @throw std::runtime_error when a constant of a segment is not within the mapped file
+     */
+    ConstantPrefetcher(const MemoryMap &mapped, const vgflib::ModelSequenceTableDecoder &modelSequenceTable,
+                       const vgflib::ConstantDecoder &constants);
+
+    /// Number of segments of the model
+    uint32_t size() const { return static_cast<uint32_t>(prefetchRows_.size() - 1); }
+
+    /**
+     * @brief Returns the merged byte ranges of the constants of segment 'segmentIdx'
+     *
+     * @return An empty view when segmentIdx is out of range
+     */
+    vgflib::DataView<MappedRange> getSegmentRanges(uint32_t segmentIdx) const;
+
+    /**
+     * @brief Returns the byte ranges that are not used by any segment after 'segmentIdx'
+     *
+     * The ranges hold the constants whose last use is segment 'segmentIdx', shrunk to whole pages so that evicting them
+     * does not drop pages shared with constants still to be used.
+     *
+     * @return An empty view when segmentIdx is out of range
+     */
+    vgflib::DataView<MappedRange> getEvictionRanges(uint32_t segmentIdx) const;
+
+    /**
+     * @brief Asks the kernel to start reading the constants of segments [segmentIdx, segmentIdx + numSegments)
+     *
+     * @return false when advising any of the ranges failed
+     */
+    bool prefetch(uint32_t segmentIdx, uint32_t numSegments = 1) const;
+
+    /**
+     * @brief Releases the constants that are not used by any segment after 'segmentIdx'
+     *
+     * @param segmentIdx Segment that completed
+     * @param advice MemoryMapAdvice::COLD to let the kernel reclaim the pages first under memory pressure, or
+     * MemoryMapAdvice::DONTNEED to drop them immediately
+     * @return false when advising any of the ranges failed
+     */
+    bool evict(uint32_t segmentIdx, MemoryMapAdvice advice = MemoryMapAdvice::DONTNEED) const;
+
+  private:
+    const MemoryMap &mapped_;
+    // Ranges of segment i are ranges[rows[i], rows[i + 1])
+    std::vector<MappedRange> prefetchRanges_;
+    std::vector<uint32_t> prefetchRows_;
+    std::vector<MappedRange> evictionRanges_;
+    std::vector<uint32_t> evictionRows_;
+};
+
+} // namespace mlsdk::vgfutils
@@ -4,11 +4,47 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
 
+namespace mlsdk::vgflib {
+class HeaderDecoder;
+} // namespace mlsdk::vgflib
+
+/// Expected access pattern of a range of a MemoryMap, forwarded to the kernel as a hint
+enum class MemoryMapAdvice {
+    /// No special treatment
+    NORMAL,
+    /// Pages are read in increasing order, so read ahead aggressively and drop them once read
+    SEQUENTIAL,
+    /// Pages are read in no particular order, so do not read ahead
+    RANDOM,
+    /// Pages are needed soon, so start reading them now
+    WILLNEED,
+    /// Back the range with huge pages where the kernel supports it for file mappings
+    HUGEPAGE,
+    /// Pages are not needed for a while, so reclaim them before other pages under memory pressure
+    COLD,
+    /// Pages are not needed for a while, so drop them now. The mapping is read only, so they are read back from the
+    /// file on their next access.
+    DONTNEED,
+};
+
+struct MemoryMapOptions {
+    /// Fault in every page of the file when it is mapped, so that later reads do not page fault
+    bool populate = false;
+    /// Map the page cache pages of the file directly instead of a private copy-on-write mapping. The mapping is read
+    /// only in both cases, so this only matters to platforms accounting private mappings against the process.
+    bool shared = false;
+    /// Advice applied to the whole file once it is mapped
+    MemoryMapAdvice advice = MemoryMapAdvice::NORMAL;
+    /// Lock the whole file in memory once it is mapped, subject to the memory lock limit of the process
+    bool lock = false;
+};
+
 class MemoryMap {
   public:
-    explicit MemoryMap(const std::string &filename);
+    explicit MemoryMap(const std::string &filename, const MemoryMapOptions &options = {});
     MemoryMap(const MemoryMap &) = delete;
     MemoryMap &operator=(const MemoryMap &) = delete;
     MemoryMap(const MemoryMap &&) = delete;
@@ -19,7 +55,35 @@ class MemoryMap {
     const void *ptr(size_t offset = 0) const;
     size_t size() const { return size_; }
 
+    /// Size of the pages that advise, lock and unlock widen their ranges to
+    static size_t pageSize();
+
+    /**
+     * @brief Gives the kernel the expected access pattern of a range of the file
+     *
+     * The range is widened to page boundaries and clamped to the file.
+     *
+     * @return false when the range starts beyond the file or the platform does not support the advice
+     */
+    bool advise(size_t offset, size_t size, MemoryMapAdvice advice) const;
+
+    /**
+     * @brief Locks a range of the file in memory, faulting in its pages
+     *
+     * The range is widened to page boundaries and clamped to the file.
+     *
+     * @return false when the range starts beyond the file or the memory lock limit of the process is exceeded
+     */
+    bool lock(size_t offset, size_t size) const;
+
+    /**
+     * @brief Unlocks a range locked by lock()
+     */
+    bool unlock(size_t offset, size_t size) const;
+
   private:
+    void unmap();
+
 #ifdef _WIN32
     void *hFile_;
     void *hMap_;
@@ -29,3 +93,18 @@ class MemoryMap {
     void *addr_;
     size_t size_;
 };
+
+/**
+ * @brief Advises the sections of a mapped VGF file as given by its header
+ *
+ * Loaders typically read the module, model sequence and model resource tables once at load time and stream or upload
+ * the constants section, so each can be given its own access pattern.
+ *
+ * @param mapped Mapping of the whole VGF file
+ * @param header Decoder of the header of the mapped file
+ * @param tablesAdvice Advice for the module, model sequence and model resource table sections
+ * @param constantsAdvice Advice for the constants section
+ * @return false when advising any of the non-empty sections failed
+ */
+bool AdviseVgfSections(const MemoryMap &mapped, const mlsdk::vgflib::HeaderDecoder &header,
+                       MemoryMapAdvice tablesAdvice, MemoryMapAdvice constantsAdvice);
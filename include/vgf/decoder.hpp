@@ -8,8 +8,10 @@
 #include <cassert>
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -56,6 +58,18 @@ template <typename T> class DataView {
  * @{
  */
 
+/**
+ * @brief How a FlatBuffers section is verified when its decoder is created
+ */
+enum class VerificationMode {
+    /// Verify the whole section up front
+    FULL,
+    /// Verify the root table and the entry vectors up front, and each module, segment or resource entry on its first
+    /// access. An entry failing verification is reported once through the logger and then reads as an entry without
+    /// fields, so the accessors return their default values.
+    LAZY,
+};
+
 class HeaderDecoder {
   public:
     virtual ~HeaderDecoder() = default;
@@ -172,6 +186,51 @@ std::unique_ptr<HeaderDecoder> CreateHeaderDecoder(const void *data, uint64_t he
  */
 HeaderDecoder *CreateHeaderDecoderInPlace(const void *data, uint64_t headerSize, uint64_t fileSize, void *decoderMem);
 
+/**
+ * @brief Sections of a VGF file
+ */
+enum class SectionName {
+    MODULES,
+    MODEL_SEQUENCE,
+    RESOURCES,
+    CONSTANTS,
+};
+
+/**
+ * @brief Result of a section checksum check
+ */
+enum class IntegrityStatus {
+    /// The checksum matches the section contents
+    VALID,
+    /// The checksum does not match, the section is torn or corrupted
+    CORRUPTED,
+    /// The file was encoded without section checksums
+    NO_CHECKSUMS,
+    /// The header is invalid or a section lies outside of the file
+    INVALID_FILE,
+};
+
+/**
+ * @brief Checks the CRC32C checksum of one section of a VGF file held in memory against the header
+ *
+ * This only detects accidental corruption, for example a torn download, and runs at close to memory bandwidth. It
+ * does not replace the structural verification done by the section decoders.
+ *
+ * @param data Pointer to the start of the VGF buffer (file contents)
+ * @param size Total size in bytes of the VGF buffer
+ * @param section Section to check
+ */
+IntegrityStatus CheckSectionIntegrity(const void *data, uint64_t size, SectionName section);
+
+/**
+ * @brief Checks the CRC32C checksums of all the sections of a VGF file held in memory against the header
+ *
+ * @param data Pointer to the start of the VGF buffer (file contents)
+ * @param size Total size in bytes of the VGF buffer
+ * @return VALID if every section matches, otherwise the first failing status
+ */
+IntegrityStatus CheckIntegrity(const void *data, uint64_t size);
+
 // ModuleTableDecoder
 class ModuleTableDecoder {
   public:
@@ -315,8 +374,10 @@ size_t ModuleTableDecoderSize();
  *
  * @param data Pointer to Module Table section data
  * @param size Size in bytes of the section
+ * @param mode Verification of the section, LAZY defers the verification of each module to its first access
  */
-std::unique_ptr<ModuleTableDecoder> CreateModuleTableDecoder(const void *data, uint64_t size);
+std::unique_ptr<ModuleTableDecoder> CreateModuleTableDecoder(const void *data, uint64_t size,
+                                                             VerificationMode mode = VerificationMode::FULL);
 
 /**
  * @brief Constructs a Module Table decoder in-place using pre-allocated memory (returns nullptr if the section is
@@ -332,6 +393,22 @@ ModuleTableDecoder *CreateModuleTableDecoderInPlace(const void *data, uint64_t s
 struct SamplerConfigHandle_s {};
 using SamplerConfigHandle = const SamplerConfigHandle_s *;
 
+/**
+ * @brief Sizes and layout of the tensor of an MRT entry
+ */
+struct TensorLayout {
+    /// Number of elements, the product of the shape
+    uint64_t elementCount = 0;
+    /// Size in bytes of an element, the texel block size of the format
+    uint64_t elementSize = 0;
+    /// Size in bytes of the elements stored without padding
+    uint64_t packedByteSize = 0;
+    /// Size in bytes from the first element to the end of the last one, following the strides
+    uint64_t spanByteSize = 0;
+    /// True when the strides are absent or describe a packed row-major layout, so the span is the packed size
+    bool contiguous = false;
+};
+
 class ModelResourceTableDecoder {
   public:
     virtual ~ModelResourceTableDecoder() = default;
@@ -383,6 +460,18 @@ class ModelResourceTableDecoder {
      */
     virtual DataView<int64_t> getTensorStride(uint32_t id) const = 0;
 
+    /**
+     * @brief Returns the sizes and layout of the tensor of the MRT entry 'id'
+     *
+     * Computed for every entry when the decoder is created by CreateModelResourceTableDecoder, or by a VgfModel
+     * created by CreateVgfModel, in VerificationMode::FULL. Other decoders compute it from the entry on each call.
+     *
+     * @param id
+     * @return std::nullopt when 'id' is out of range, or the tensor has an unshaped dimension, a format of unknown
+     * block size, strides not matching its rank, a negative stride, or sizes beyond 64 bits
+     */
+    virtual std::optional<TensorLayout> getTensorLayout(uint32_t id) const = 0;
+
     /**
      * @brief Returns a handle to the sampler config for MRT entry 'id'
      *
@@ -438,8 +527,10 @@ size_t ModelResourceTableDecoderSize();
  *
  * @param data Pointer to Model Resource Table section data
  * @param size Size in bytes of the section
+ * @param mode Verification of the section, LAZY defers the verification of each entry to its first access
  */
-std::unique_ptr<ModelResourceTableDecoder> CreateModelResourceTableDecoder(const void *data, uint64_t size);
+std::unique_ptr<ModelResourceTableDecoder>
+CreateModelResourceTableDecoder(const void *data, uint64_t size, VerificationMode mode = VerificationMode::FULL);
 
 /**
  * @brief Constructs a Model Resource Table decoder in-place using pre-allocated memory (returns nullptr if the section
@@ -488,6 +579,24 @@ class ConstantDecoder {
      * @param idx Index of the constant
      */
     virtual DataView<uint8_t> getConstant(uint32_t idx) const = 0;
+
+    /**
+     * @brief Returns the file offset alignment the encoder guaranteed for constant 'idx' (0 if idx is invalid)
+     *
+     * @param idx Index of the constant
+     */
+    virtual uint64_t getConstantAlignment(uint32_t idx) const = 0;
+
+    /**
+     * @brief Returns true if the file offset of constant 'idx' is a multiple of 'alignment'
+     *
+     * Use it to check whether a constant can be imported in place from a mapped or directly read file.
+     *
+     * @param idx Index of the constant
+     * @param sectionOffset File offset of the Constants section, as reported by the header
+     * @param alignment Required alignment in bytes
+     */
+    virtual bool isConstantAligned(uint32_t idx, uint64_t sectionOffset, uint64_t alignment) const = 0;
 };
 
 /**
@@ -514,6 +623,29 @@ std::unique_ptr<ConstantDecoder> CreateConstantDecoder(const void *data, uint64_
  */
 ConstantDecoder *CreateConstantDecoderInPlace(const void *data, uint64_t size, void *decoderMem);
 
+/**
+ * @brief Called with the chunks of a constant in order, returns false to stop the iteration
+ *
+ * @param offset Offset of the chunk from the start of the constant
+ * @param chunk Bytes of the chunk, only valid during the call
+ */
+using ConstantChunkCallback = std::function<bool(uint64_t offset, DataView<uint8_t> chunk)>;
+
+/**
+ * @brief Passes constant 'idx' to a callback in chunks of at most 'chunkSize' bytes
+ *
+ * The chunks are views of the section data, so nothing is copied or allocated. When the section is part of a mapped
+ * file, the pages of each chunk are only read when the callback accesses them.
+ *
+ * @param constants Decoder of the Constants section
+ * @param idx Index of the constant
+ * @param chunkSize Maximum size in bytes of a chunk
+ * @param callback Callback receiving the chunks
+ * @return False if idx is invalid, chunkSize is 0 or the callback stopped the iteration
+ */
+bool ForEachConstantChunk(const ConstantDecoder &constants, uint32_t idx, uint64_t chunkSize,
+                          const ConstantChunkCallback &callback);
+
 // Binding Slot Array Handle
 struct BindingSlotArrayHandle_s {};
 using BindingSlotArrayHandle = const BindingSlotArrayHandle_s *;
@@ -737,8 +869,10 @@ size_t ModelSequenceTableDecoderSize();
  *
  * @param data Pointer to Model Sequence Table section data
  * @param size Size in bytes of the section
+ * @param mode Verification of the section, LAZY defers the verification of each segment to its first access
  */
-std::unique_ptr<ModelSequenceTableDecoder> CreateModelSequenceTableDecoder(const void *data, uint64_t size);
+std::unique_ptr<ModelSequenceTableDecoder>
+CreateModelSequenceTableDecoder(const void *data, uint64_t size, VerificationMode mode = VerificationMode::FULL);
 
 /**
  * @brief Constructs a Model Sequence Table decoder in-place using pre-allocated memory (returns nullptr if the section
@@ -750,5 +884,403 @@ std::unique_ptr<ModelSequenceTableDecoder> CreateModelSequenceTableDecoder(const
  */
 ModelSequenceTableDecoder *CreateModelSequenceTableDecoderInPlace(const void *data, uint64_t size, void *decoderMem);
 
+// Name Index
+class NameIndex {
+  public:
+    virtual ~NameIndex() = default;
+
+    /**
+     * @brief Returns the index of the model sequence input with the given name
+     *
+     * @param name Name of the input
+     * @return Index of the first input with that name, or nullopt if there is none
+     */
+    virtual std::optional<uint32_t> findInputByName(std::string_view name) const = 0;
+
+    /**
+     * @brief Returns the index of the model sequence output with the given name
+     *
+     * @param name Name of the output
+     * @return Index of the first output with that name, or nullopt if there is none
+     */
+    virtual std::optional<uint32_t> findOutputByName(std::string_view name) const = 0;
+
+    /**
+     * @brief Returns the index in the module table of the module with the given name
+     *
+     * @param name Name of the module
+     * @return Index of the first module with that name, or nullopt if there is none
+     */
+    virtual std::optional<uint32_t> findModuleByName(std::string_view name) const = 0;
+
+    /**
+     * @brief Returns the index in the model sequence of the segment with the given name
+     *
+     * @param name Name of the segment
+     * @return Index of the first segment with that name, or nullopt if there is none
+     */
+    virtual std::optional<uint32_t> findSegmentByName(std::string_view name) const = 0;
+};
+
+/**
+ * @brief Returns the size in memory of the name index of the given decoders
+ *
+ * @param moduleTable Decoder of the Module Table section
+ * @param modelSequenceTable Decoder of the Model Sequence Table section
+ */
+size_t NameIndexSize(const ModuleTableDecoder &moduleTable, const ModelSequenceTableDecoder &modelSequenceTable);
+
+/**
+ * @brief Constructs a hash index of the names of the model inputs, outputs, modules and segments
+ *
+ * The names are read once to build the index. Lookups then hash the name and compare it with the matching entries
+ * only. The decoders must outlive the index.
+ *
+ * @param moduleTable Decoder of the Module Table section
+ * @param modelSequenceTable Decoder of the Model Sequence Table section
+ */
+std::unique_ptr<NameIndex> CreateNameIndex(const ModuleTableDecoder &moduleTable,
+                                           const ModelSequenceTableDecoder &modelSequenceTable);
+
+/**
+ * @brief Constructs a name index in-place using pre-allocated memory
+ *
+ * @param moduleTable Decoder of the Module Table section
+ * @param modelSequenceTable Decoder of the Model Sequence Table section
+ * @param indexMem Memory of at least NameIndexSize() bytes to place the index into
+ */
+NameIndex *CreateNameIndexInPlace(const ModuleTableDecoder &moduleTable,
+                                  const ModelSequenceTableDecoder &modelSequenceTable, void *indexMem);
+
+// Resource Index
+class ResourceIndex {
+  public:
+    virtual ~ResourceIndex() = default;
+
+    /**
+     * @brief Returns the constants holding the data of a model resource table entry
+     *
+     * @param mrtIdx The index for the entry in the model resource table
+     * @return Indexes of the constants in increasing order, empty if the entry has no constant
+     */
+    virtual DataView<uint32_t> getConstants(uint32_t mrtIdx) const = 0;
+
+    /**
+     * @brief Returns the segments listing a model resource table entry among their outputs
+     *
+     * @param mrtIdx The index for the entry in the model resource table
+     * @return Indexes of the segments in increasing order
+     */
+    virtual DataView<uint32_t> getProducerSegments(uint32_t mrtIdx) const = 0;
+
+    /**
+     * @brief Returns the segments listing a model resource table entry among their inputs
+     *
+     * @param mrtIdx The index for the entry in the model resource table
+     * @return Indexes of the segments in increasing order
+     */
+    virtual DataView<uint32_t> getConsumerSegments(uint32_t mrtIdx) const = 0;
+
+    /**
+     * @brief Returns the segments binding a model resource table entry in one of their descriptor sets
+     *
+     * @param mrtIdx The index for the entry in the model resource table
+     * @return Indexes of the segments in increasing order
+     */
+    virtual DataView<uint32_t> getBindingSegments(uint32_t mrtIdx) const = 0;
+
+    /**
+     * @brief Returns the alias group ids used by the model resource table, in increasing order
+     */
+    virtual DataView<AliasGroupId> getAliasGroupIds() const = 0;
+
+    /**
+     * @brief Returns the model resource table entries sharing storage through an alias group
+     *
+     * @param aliasGroupId The id of the alias group
+     * @return Indexes of the entries in the model resource table in increasing order, empty for an unused id
+     */
+    virtual DataView<uint32_t> getAliasGroupMembers(AliasGroupId aliasGroupId) const = 0;
+};
+
+/**
+ * @brief Constructs the reverse indexes of the model resource table entries
+ *
+ * The segments, resources and constants are read once, and each relation is stored as compressed sparse rows. Indexes
+ * referring past the end of the model resource table are ignored. The decoders may be destroyed once the index is
+ * created.
+ *
+ * @param modelSequenceTable Decoder of the Model Sequence Table section
+ * @param modelResourceTable Decoder of the Model Resource Table section
+ * @param constants Decoder of the Constants section
+ */
+std::unique_ptr<ResourceIndex> CreateResourceIndex(const ModelSequenceTableDecoder &modelSequenceTable,
+                                                   const ModelResourceTableDecoder &modelResourceTable,
+                                                   const ConstantDecoder &constants);
+
+// Segment Graph
+class SegmentGraph {
+  public:
+    virtual ~SegmentGraph() = default;
+
+    /**
+     * @brief Returns the number of segments in the graph
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * @brief Returns the segments that must complete before a segment starts
+     *
+     * @param segmentIdx The index for the segment in the model sequence
+     * @return Indexes of the segments in increasing order, empty for an unknown index
+     */
+    virtual DataView<uint32_t> getPredecessors(uint32_t segmentIdx) const = 0;
+
+    /**
+     * @brief Returns the segments that must wait for a segment to complete
+     *
+     * @param segmentIdx The index for the segment in the model sequence
+     * @return Indexes of the segments in increasing order, empty for an unknown index
+     */
+    virtual DataView<uint32_t> getSuccessors(uint32_t segmentIdx) const = 0;
+
+    /**
+     * @brief Returns the topological level of a segment, one more than the highest level of its predecessors
+     *
+     * @param segmentIdx The index for the segment in the model sequence
+     */
+    virtual uint32_t getLevel(uint32_t segmentIdx) const = 0;
+
+    /**
+     * @brief Returns the number of topological levels, which is the length of the critical path
+     */
+    virtual size_t getNumLevels() const = 0;
+
+    /**
+     * @brief Returns the segments of a topological level, which can all be in flight together
+     *
+     * @param level The level, lower than getNumLevels
+     * @return Indexes of the segments in increasing order, empty for an unknown level
+     */
+    virtual DataView<uint32_t> getLevelSegments(uint32_t level) const = 0;
+
+    /**
+     * @brief Returns a longest chain of dependent segments, in execution order
+     */
+    virtual DataView<uint32_t> getCriticalPath() const = 0;
+};
+
+/**
+ * @brief Constructs the dependency graph of the segments of a model sequence
+ *
+ * The segments are visited once in model sequence order. A segment reads the resources of its input binding slots and
+ * writes the resources of its output binding slots. Resources bound only through its descriptor sets are assumed to
+ * be both read and written. A segment depends on the last earlier segment writing a resource it accesses, and a
+ * segment writing a resource also depends on the segments reading it since that write. Segments only reading the same
+ * resources are independent. The decoder may be destroyed once the graph is created.
+ *
+ * @param modelSequenceTable Decoder of the Model Sequence Table section
+ */
+std::unique_ptr<SegmentGraph> CreateSegmentGraph(const ModelSequenceTableDecoder &modelSequenceTable);
+
+// Memory Planner
+
+/**
+ * @brief Options of PlanIntermediateMemory
+ */
+struct MemoryPlanOptions {
+    /// Alignment in bytes of every offset and size in the arena, must be a power of two
+    uint64_t alignment = 256;
+};
+
+/**
+ * @brief Placement of an intermediate resource in the arena
+ */
+struct IntermediateAllocation {
+    /// Index of the intermediate in the model resource table
+    uint32_t mrtIndex = 0;
+    /// Offset in bytes of the storage in the arena
+    uint64_t offset = 0;
+    /// Size in bytes of the storage, shared by every intermediate of an alias group
+    uint64_t size = 0;
+    /// First segment referring to the storage
+    uint32_t firstSegment = 0;
+    /// Last segment referring to the storage
+    uint32_t lastSegment = 0;
+};
+
+/**
+ * @brief Intermediate memory plan computed by PlanIntermediateMemory
+ */
+struct MemoryPlan {
+    /// Placements of the intermediates referred to by a segment, in increasing MRT index order
+    std::vector<IntermediateAllocation> allocations;
+    /// Size in bytes of the arena holding every intermediate
+    uint64_t peakBytes = 0;
+    /// Size in bytes the intermediates would take without reusing memory
+    uint64_t totalBytes = 0;
+};
+
+/**
+ * @brief Assigns every intermediate resource an offset in a single arena
+ *
+ * The storage of an intermediate is live from the first to the last segment referring to it through its inputs,
+ * outputs or descriptor sets. Intermediates sharing an alias group share their storage, which is live as long as any
+ * of them and as large as the largest one. The storages are placed from the largest to the smallest, each at the
+ * lowest-waste gap left by the storages whose lifetimes overlap its own, so that storages that are never live at the
+ * same time reuse the same bytes. Intermediates not referred to by any segment are not placed.
+ *
+ * The size of an intermediate is the span of its tensor, see ModelResourceTableDecoder::getTensorLayout.
+ *
+ * @param modelSequenceTable Decoder of the Model Sequence Table section
+ * @param modelResourceTable Decoder of the Model Resource Table section
+ * @param options Planner options
+ * @return The plan, or std::nullopt when an intermediate has an unshaped dimension or a format of unknown size
+ */
+std::optional<MemoryPlan> PlanIntermediateMemory(const ModelSequenceTableDecoder &modelSequenceTable,
+                                                 const ModelResourceTableDecoder &modelResourceTable,
+                                                 const MemoryPlanOptions &options = {});
+
+// VGF Model
+class VgfModel {
+  public:
+    virtual ~VgfModel() = default;
+
+    /**
+     * @brief Returns the decoder of the file header
+     */
+    virtual const HeaderDecoder &getHeaderDecoder() const = 0;
+
+    /**
+     * @brief Returns the decoder of the Module Table section
+     */
+    virtual const ModuleTableDecoder &getModuleTableDecoder() const = 0;
+
+    /**
+     * @brief Returns the decoder of the Model Sequence Table section
+     */
+    virtual const ModelSequenceTableDecoder &getModelSequenceTableDecoder() const = 0;
+
+    /**
+     * @brief Returns the decoder of the Model Resource Table section
+     */
+    virtual const ModelResourceTableDecoder &getModelResourceTableDecoder() const = 0;
+
+    /**
+     * @brief Returns the decoder of the Constants section
+     */
+    virtual const ConstantDecoder &getConstantDecoder() const = 0;
+
+    /**
+     * @brief Returns the name index built when the model was created with VgfModelOptions::buildNameIndex
+     *
+     * @return Pointer to the index owned by the model, or nullptr if it was not built
+     */
+    virtual const NameIndex *getNameIndex() const = 0;
+};
+
+/**
+ * @brief Returns the size of VGF model in memory, including all of its section decoders
+ *
+ */
+size_t VgfModelSize();
+
+/**
+ * @brief Constructs a VGF model decoding all the sections of a VGF file held in memory (returns nullptr if the file
+ * is invalid)
+ *
+ * The header and every section are validated once, and all the decoders are held in a single allocation. The file
+ * contents must outlive the model. A file mapped with MemoryMap can be passed as (mapped.ptr(), mapped.size()).
+ *
+ * @param data Pointer to the start of the VGF buffer (file contents)
+ * @param size Total size in bytes of the VGF buffer
+ * @param mode Verification of the FlatBuffers sections, LAZY defers the verification of each entry to its first access
+ */
+std::unique_ptr<VgfModel> CreateVgfModel(const void *data, uint64_t size,
+                                         VerificationMode mode = VerificationMode::FULL);
+
+/**
+ * @brief Runs every task and returns once all of them have completed, for example on a thread pool of the caller
+ */
+using VerificationExecutor = std::function<void(const std::vector<std::function<void()>> &tasks)>;
+
+/**
+ * @brief Options of CreateVgfModel
+ */
+struct VgfModelOptions {
+    /// Verification of the FlatBuffers sections
+    VerificationMode mode = VerificationMode::FULL;
+    /// Verify the module table, model sequence table, model resource table and constants sections concurrently
+    bool parallelVerification = false;
+    /// Executor of the verification tasks, empty to run them on threads started by the library. Only used with
+    /// parallelVerification.
+    VerificationExecutor executor;
+    /// Build a NameIndex of the model inputs, outputs, modules and segments once the sections are verified
+    bool buildNameIndex = false;
+};
+
+/**
+ * @brief Constructs a VGF model decoding all the sections of a VGF file held in memory (returns nullptr if the file
+ * is invalid)
+ *
+ * @param data Pointer to the start of the VGF buffer (file contents)
+ * @param size Total size in bytes of the VGF buffer
+ * @param options Verification options
+ */
+std::unique_ptr<VgfModel> CreateVgfModel(const void *data, uint64_t size, const VgfModelOptions &options);
+
+/**
+ * @brief Constructs a VGF model in-place using pre-allocated memory (returns nullptr if the file is invalid)
+ *
+ * @param data Pointer to the start of the VGF buffer (file contents)
+ * @param size Total size in bytes of the VGF buffer
+ * @param modelMem Memory of at least VgfModelSize() bytes to place the model into
+ */
+VgfModel *CreateVgfModelInPlace(const void *data, uint64_t size, void *modelMem);
+
+/**
+ * @brief Options of the process-wide verification cache
+ */
+struct VerificationCacheOptions {
+    /// Skip the full verification of sections whose digest matches a section that was verified before
+    bool enabled = false;
+    /// File persisting the digests across processes, for example next to the model. Empty to keep them in memory only
+    std::string sidecarPath;
+};
+
+/**
+ * @brief Counters of the verification cache since it was last configured
+ */
+struct VerificationCacheStats {
+    /// Sections whose verification was skipped
+    uint64_t hits = 0;
+    /// Sections that were verified because their digest was not cached
+    uint64_t misses = 0;
+};
+
+/**
+ * @brief Configures the verification cache used by the section decoders
+ *
+ * While enabled, every section passing full verification has its digest recorded. Creating a decoder over a section
+ * with a recorded digest then skips the FlatBuffers verifier walk and the constant metadata checks. The digest is a
+ * fast 64-bit hash, not a cryptographic one, so the cache must only be enabled for trusted files. A sidecar file must
+ * be protected as well as the models themselves. Configuring the cache drops the digests held in memory and resets
+ * the counters.
+ *
+ * @param options Cache options
+ * @return False if the sidecar file could not be read or created, the cache then keeps its digests in memory only
+ */
+bool ConfigureVerificationCache(const VerificationCacheOptions &options);
+
+/**
+ * @brief Drops every recorded digest, including those in the sidecar file
+ */
+void InvalidateVerificationCache();
+
+/**
+ * @brief Returns the hit and miss counters of the verification cache
+ */
+VerificationCacheStats GetVerificationCacheStats();
+
 /**@}*/
 } // namespace mlsdk::vgflib
@@ -0,0 +1,637 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+#include "decoder.hpp"
+#include "types.hpp"
+
+namespace mlsdk::vgflib {
+
+namespace detail {
+
+// Byte offsets of the fields in the FlatBuffers vtables of the VGF schema, checked against the generated code
+constexpr uint16_t MODULE_TABLE_MODULES = 4;
+constexpr uint16_t MODULE_TYPE = 4;
+constexpr uint16_t MODULE_NAME = 6;
+constexpr uint16_t MODULE_ENTRY_POINT = 8;
+constexpr uint16_t MODULE_CODE_TYPE = 10;
+constexpr uint16_t MODULE_CODE = 12;
+constexpr uint16_t SPIRV_WORDS = 4;
+constexpr uint16_t SHADER_CODE = 4;
+
+constexpr uint16_t MODEL_SEQUENCE_SEGMENTS = 4;
+constexpr uint16_t MODEL_SEQUENCE_INPUTS = 6;
+constexpr uint16_t MODEL_SEQUENCE_OUTPUTS = 8;
+constexpr uint16_t MODEL_SEQUENCE_INPUT_NAMES = 10;
+constexpr uint16_t MODEL_SEQUENCE_OUTPUT_NAMES = 12;
+constexpr uint16_t SEGMENT_TYPE = 4;
+constexpr uint16_t SEGMENT_NAME = 6;
+constexpr uint16_t SEGMENT_MODULE_INDEX = 8;
+constexpr uint16_t SEGMENT_SET_INFOS = 10;
+constexpr uint16_t SEGMENT_INPUTS = 12;
+constexpr uint16_t SEGMENT_OUTPUTS = 14;
+constexpr uint16_t SEGMENT_CONSTANTS = 16;
+constexpr uint16_t SEGMENT_DISPATCH_SHAPE = 18;
+constexpr uint16_t SEGMENT_PUSH_CONSTANT_RANGES = 20;
+constexpr uint16_t DESCRIPTOR_SET_INFO_BINDINGS = 4;
+constexpr uint16_t DESCRIPTOR_SET_INFO_SET_INDEX = 6;
+constexpr uint16_t BINDING_SLOT_BINDING = 4;
+constexpr uint16_t BINDING_SLOT_MRT_INDEX = 6;
+constexpr uint16_t PUSH_CONSTANT_RANGE_STAGE_FLAGS = 4;
+constexpr uint16_t PUSH_CONSTANT_RANGE_OFFSET = 6;
+constexpr uint16_t PUSH_CONSTANT_RANGE_SIZE = 8;
+
+constexpr uint16_t MODEL_RESOURCE_TABLE_ENTRIES = 4;
+constexpr uint16_t RESOURCE_DESCRIPTOR_TYPE = 4;
+constexpr uint16_t RESOURCE_FORMAT = 6;
+constexpr uint16_t RESOURCE_CATEGORY = 8;
+constexpr uint16_t RESOURCE_DESCRIPTION = 10;
+constexpr uint16_t RESOURCE_EXTRA_CONFIG_TYPE = 12;
+constexpr uint16_t RESOURCE_EXTRA_CONFIG = 14;
+constexpr uint16_t RESOURCE_ALIAS_GROUP_ID = 16;
+constexpr uint16_t DESCRIPTION_SHAPE = 4;
+constexpr uint16_t DESCRIPTION_STRIDES = 6;
+constexpr uint16_t SAMPLER_CONFIG_MIN_FILTER = 4;
+constexpr uint16_t SAMPLER_CONFIG_MAG_FILTER = 6;
+constexpr uint16_t SAMPLER_CONFIG_ADDRESS_MODE_U = 8;
+constexpr uint16_t SAMPLER_CONFIG_ADDRESS_MODE_V = 10;
+constexpr uint16_t SAMPLER_CONFIG_BORDER_COLOR = 12;
+
+// Union and enum values of the VGF schema
+constexpr uint8_t MODULE_CODE_SPIRV = 1;
+constexpr uint8_t MODULE_CODE_GLSL = 2;
+constexpr uint8_t MODULE_CODE_HLSL = 3;
+constexpr uint8_t EXTRA_CONFIG_SAMPLER_CONFIG = 1;
+constexpr uint8_t MODULE_TYPE_GRAPH = 1;
+constexpr uint8_t RESOURCE_CATEGORY_MAX = 3;
+constexpr uint32_t NULL_DESCRIPTOR_TYPE = 0xFFFFFFFF;
+constexpr uint32_t UNSET_SET_INDEX = 0xFFFFFFFF;
+
+template <typename T> inline T ReadScalar(const uint8_t *ptr) noexcept {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+inline const uint8_t *FollowOffset(const uint8_t *ptr) noexcept { return ptr + ReadScalar<uint32_t>(ptr); }
+
+/// Table of a verified FlatBuffers buffer, read without the FlatBuffers library
+class FlatTable final {
+  public:
+    constexpr FlatTable() noexcept = default;
+    explicit constexpr FlatTable(const uint8_t *table) noexcept : table_(table) {}
+
+    [[nodiscard]] constexpr const uint8_t *data() const noexcept { return table_; }
+
+    template <typename T> [[nodiscard]] T scalar(uint16_t field, T defaultValue) const noexcept {
+        const uint16_t offset = fieldOffset(field);
+        return offset == 0 ? defaultValue : ReadScalar<T>(table_ + offset);
+    }
+
+    /// Returns the target of an offset field, nullptr if the field is absent
+    [[nodiscard]] const uint8_t *pointer(uint16_t field) const noexcept {
+        const uint16_t offset = fieldOffset(field);
+        return offset == 0 ? nullptr : FollowOffset(table_ + offset);
+    }
+
+  private:
+    [[nodiscard]] uint16_t fieldOffset(uint16_t field) const noexcept {
+        assert(table_ != nullptr && "table is null");
+        const uint8_t *vtable = table_ - ReadScalar<int32_t>(table_);
+        return field < ReadScalar<uint16_t>(vtable) ? ReadScalar<uint16_t>(vtable + field) : 0;
+    }
+
+    const uint8_t *table_ = nullptr;
+};
+
+inline size_t VectorSize(const uint8_t *vector) noexcept {
+    return vector == nullptr ? 0 : ReadScalar<uint32_t>(vector);
+}
+
+template <typename T> inline DataView<T> ScalarVector(const uint8_t *vector) noexcept {
+    if (vector == nullptr) {
+        return {};
+    }
+    return {reinterpret_cast<const T *>(vector + sizeof(uint32_t)), VectorSize(vector)};
+}
+
+inline FlatTable TableAt(const uint8_t *vector, uint32_t idx) noexcept {
+    assert(vector != nullptr && "vector is null");
+    assert(idx < VectorSize(vector) && "index out of range");
+    return FlatTable(FollowOffset(vector + sizeof(uint32_t) + sizeof(uint32_t) * static_cast<size_t>(idx)));
+}
+
+inline std::string_view StringAt(const uint8_t *string) noexcept {
+    if (string == nullptr) {
+        return {};
+    }
+    return {reinterpret_cast<const char *>(string + sizeof(uint32_t)), VectorSize(string)};
+}
+
+} // namespace detail
+
+/**
+ * \defgroup VGFDecoderViewsAPI Decoder views API
+ * @{
+ *
+ * Views are concrete, non-virtual counterparts of the table decoders. Their accessors are inline, so loops over
+ * segments, binding slots or resources can be inlined and optimized by the compiler. A view is a pointer into the
+ * section data, which must outlive it. Views must only be created over verified data, either with the Create*View
+ * functions or from the table decoders in VerificationMode::FULL.
+ */
+
+/**
+ * @brief Array of binding slots
+ */
+class BindingSlotsView final {
+  public:
+    constexpr BindingSlotsView() noexcept = default;
+    explicit BindingSlotsView(const void *vector) noexcept : vector_(static_cast<const uint8_t *>(vector)) {}
+
+    /// Returns the underlying data, which is also the BindingSlotArrayHandle of the array
+    [[nodiscard]] constexpr const void *data() const noexcept { return vector_; }
+    [[nodiscard]] size_t size() const noexcept { return detail::VectorSize(vector_); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] uint32_t binding(uint32_t slotIdx) const noexcept {
+        return detail::TableAt(vector_, slotIdx).scalar<uint32_t>(detail::BINDING_SLOT_BINDING, 0);
+    }
+
+    [[nodiscard]] uint32_t mrtIndex(uint32_t slotIdx) const noexcept {
+        return detail::TableAt(vector_, slotIdx).scalar<uint32_t>(detail::BINDING_SLOT_MRT_INDEX, 0);
+    }
+
+  private:
+    const uint8_t *vector_ = nullptr;
+};
+
+/**
+ * @brief Array of names
+ */
+class NamesView final {
+  public:
+    constexpr NamesView() noexcept = default;
+    explicit NamesView(const void *vector) noexcept : vector_(static_cast<const uint8_t *>(vector)) {}
+
+    /// Returns the underlying data, which is also the NameArrayHandle of the array
+    [[nodiscard]] constexpr const void *data() const noexcept { return vector_; }
+    [[nodiscard]] size_t size() const noexcept { return detail::VectorSize(vector_); }
+
+    [[nodiscard]] std::string_view name(uint32_t nameIdx) const noexcept {
+        assert(nameIdx < size() && "index out of range");
+        return detail::StringAt(
+            detail::FollowOffset(vector_ + sizeof(uint32_t) + sizeof(uint32_t) * static_cast<size_t>(nameIdx)));
+    }
+
+  private:
+    const uint8_t *vector_ = nullptr;
+};
+
+/**
+ * @brief Array of push constant ranges
+ */
+class PushConstantRangesView final {
+  public:
+    constexpr PushConstantRangesView() noexcept = default;
+    explicit PushConstantRangesView(const void *vector) noexcept : vector_(static_cast<const uint8_t *>(vector)) {}
+
+    /// Returns the underlying data, which is also the PushConstantRangeHandle of the array
+    [[nodiscard]] constexpr const void *data() const noexcept { return vector_; }
+    [[nodiscard]] size_t size() const noexcept { return detail::VectorSize(vector_); }
+
+    [[nodiscard]] uint32_t stageFlags(uint32_t rangeIdx) const noexcept {
+        return detail::TableAt(vector_, rangeIdx).scalar<uint32_t>(detail::PUSH_CONSTANT_RANGE_STAGE_FLAGS, 0);
+    }
+
+    [[nodiscard]] uint32_t offset(uint32_t rangeIdx) const noexcept {
+        return detail::TableAt(vector_, rangeIdx).scalar<uint32_t>(detail::PUSH_CONSTANT_RANGE_OFFSET, 0);
+    }
+
+    [[nodiscard]] uint32_t rangeSize(uint32_t rangeIdx) const noexcept {
+        return detail::TableAt(vector_, rangeIdx).scalar<uint32_t>(detail::PUSH_CONSTANT_RANGE_SIZE, 0);
+    }
+
+  private:
+    const uint8_t *vector_ = nullptr;
+};
+
+/**
+ * @brief Segment of the Model Sequence Table
+ */
+class SegmentView final {
+  public:
+    constexpr SegmentView() noexcept = default;
+    explicit SegmentView(const void *table) noexcept : table_(static_cast<const uint8_t *>(table)) {}
+
+    [[nodiscard]] ModuleType type() const noexcept {
+        return table_.scalar<uint8_t>(detail::SEGMENT_TYPE, 0) == detail::MODULE_TYPE_GRAPH ? ModuleType::GRAPH
+                                                                                            : ModuleType::COMPUTE;
+    }
+
+    [[nodiscard]] std::string_view name() const noexcept {
+        return detail::StringAt(table_.pointer(detail::SEGMENT_NAME));
+    }
+
+    [[nodiscard]] uint32_t moduleIndex() const noexcept {
+        return table_.scalar<uint32_t>(detail::SEGMENT_MODULE_INDEX, 0);
+    }
+
+    [[nodiscard]] size_t descriptorSetInfosSize() const noexcept {
+        return detail::VectorSize(table_.pointer(detail::SEGMENT_SET_INFOS));
+    }
+
+    /// Returns the descriptor set index, or descIdx for files that do not record it
+    [[nodiscard]] uint32_t descriptorSetIndex(uint32_t descIdx) const noexcept {
+        const uint32_t setIndex =
+            descriptorAt(descIdx).scalar<uint32_t>(detail::DESCRIPTOR_SET_INFO_SET_INDEX, detail::UNSET_SET_INDEX);
+        return setIndex == detail::UNSET_SET_INDEX ? descIdx : setIndex;
+    }
+
+    [[nodiscard]] BindingSlotsView descriptorBindingSlots(uint32_t descIdx) const noexcept {
+        return BindingSlotsView(descriptorAt(descIdx).pointer(detail::DESCRIPTOR_SET_INFO_BINDINGS));
+    }
+
+    [[nodiscard]] BindingSlotsView inputs() const noexcept {
+        return BindingSlotsView(table_.pointer(detail::SEGMENT_INPUTS));
+    }
+
+    [[nodiscard]] BindingSlotsView outputs() const noexcept {
+        return BindingSlotsView(table_.pointer(detail::SEGMENT_OUTPUTS));
+    }
+
+    [[nodiscard]] DataView<uint32_t> constantIndexes() const noexcept {
+        return detail::ScalarVector<uint32_t>(table_.pointer(detail::SEGMENT_CONSTANTS));
+    }
+
+    [[nodiscard]] DataView<uint32_t> dispatchShape() const noexcept {
+        return detail::ScalarVector<uint32_t>(table_.pointer(detail::SEGMENT_DISPATCH_SHAPE));
+    }
+
+    [[nodiscard]] PushConstantRangesView pushConstantRanges() const noexcept {
+        return PushConstantRangesView(table_.pointer(detail::SEGMENT_PUSH_CONSTANT_RANGES));
+    }
+
+  private:
+    [[nodiscard]] detail::FlatTable descriptorAt(uint32_t descIdx) const noexcept {
+        const uint8_t *descriptors = table_.pointer(detail::SEGMENT_SET_INFOS);
+        assert(descriptors != nullptr && "no descriptor found at given index");
+        return detail::TableAt(descriptors, descIdx);
+    }
+
+    detail::FlatTable table_;
+};
+
+/**
+ * @brief View of the Model Sequence Table, see ModelSequenceTableDecoder
+ */
+class ModelSequenceView final {
+  public:
+    constexpr ModelSequenceView() noexcept = default;
+    /// \param data Start of a verified Model Sequence Table section
+    explicit ModelSequenceView(const void *data) noexcept
+        : table_(detail::FollowOffset(static_cast<const uint8_t *>(data))) {}
+
+    [[nodiscard]] size_t size() const noexcept { return detail::VectorSize(segments()); }
+
+    [[nodiscard]] SegmentView segment(uint32_t segmentIdx) const noexcept {
+        return SegmentView(detail::TableAt(segments(), segmentIdx).data());
+    }
+
+    [[nodiscard]] BindingSlotsView inputs() const noexcept {
+        return BindingSlotsView(table_.pointer(detail::MODEL_SEQUENCE_INPUTS));
+    }
+
+    [[nodiscard]] BindingSlotsView outputs() const noexcept {
+        return BindingSlotsView(table_.pointer(detail::MODEL_SEQUENCE_OUTPUTS));
+    }
+
+    [[nodiscard]] NamesView inputNames() const noexcept {
+        return NamesView(table_.pointer(detail::MODEL_SEQUENCE_INPUT_NAMES));
+    }
+
+    [[nodiscard]] NamesView outputNames() const noexcept {
+        return NamesView(table_.pointer(detail::MODEL_SEQUENCE_OUTPUT_NAMES));
+    }
+
+  private:
+    [[nodiscard]] const uint8_t *segments() const noexcept { return table_.pointer(detail::MODEL_SEQUENCE_SEGMENTS); }
+
+    detail::FlatTable table_;
+};
+
+/**
+ * @brief Module of the Module Table
+ */
+class ModuleView final {
+  public:
+    constexpr ModuleView() noexcept = default;
+    explicit ModuleView(const void *table) noexcept : table_(static_cast<const uint8_t *>(table)) {}
+
+    [[nodiscard]] ModuleType type() const noexcept {
+        return table_.scalar<uint8_t>(detail::MODULE_TYPE, 0) == detail::MODULE_TYPE_GRAPH ? ModuleType::GRAPH
+                                                                                           : ModuleType::COMPUTE;
+    }
+
+    [[nodiscard]] std::string_view name() const noexcept {
+        return detail::StringAt(table_.pointer(detail::MODULE_NAME));
+    }
+
+    [[nodiscard]] std::string_view entryPoint() const noexcept {
+        return detail::StringAt(table_.pointer(detail::MODULE_ENTRY_POINT));
+    }
+
+    [[nodiscard]] bool isSPIRV() const noexcept { return codeType() == detail::MODULE_CODE_SPIRV; }
+    [[nodiscard]] bool isGLSL() const noexcept { return codeType() == detail::MODULE_CODE_GLSL; }
+    [[nodiscard]] bool isHLSL() const noexcept { return codeType() == detail::MODULE_CODE_HLSL; }
+
+    /// Returns the SPIR-V words, empty if the module holds no SPIR-V code
+    [[nodiscard]] DataView<uint32_t> spirvCode() const noexcept {
+        const uint8_t *code = codeAs(detail::MODULE_CODE_SPIRV);
+        return code == nullptr ? DataView<uint32_t>()
+                               : detail::ScalarVector<uint32_t>(detail::FlatTable(code).pointer(detail::SPIRV_WORDS));
+    }
+
+    /// Returns the GLSL source, empty if the module holds no GLSL code
+    [[nodiscard]] std::string_view glslCode() const noexcept { return shaderCode(detail::MODULE_CODE_GLSL); }
+
+    /// Returns the HLSL source, empty if the module holds no HLSL code
+    [[nodiscard]] std::string_view hlslCode() const noexcept { return shaderCode(detail::MODULE_CODE_HLSL); }
+
+  private:
+    [[nodiscard]] uint8_t codeType() const noexcept { return table_.scalar<uint8_t>(detail::MODULE_CODE_TYPE, 0); }
+
+    [[nodiscard]] const uint8_t *codeAs(uint8_t type) const noexcept {
+        return codeType() == type ? table_.pointer(detail::MODULE_CODE) : nullptr;
+    }
+
+    [[nodiscard]] std::string_view shaderCode(uint8_t type) const noexcept {
+        const uint8_t *code = codeAs(type);
+        return code == nullptr ? std::string_view()
+                               : detail::StringAt(detail::FlatTable(code).pointer(detail::SHADER_CODE));
+    }
+
+    detail::FlatTable table_;
+};
+
+/**
+ * @brief View of the Module Table, see ModuleTableDecoder
+ */
+class ModuleTableView final {
+  public:
+    constexpr ModuleTableView() noexcept = default;
+    /// \param data Start of a verified Module Table section
+    explicit ModuleTableView(const void *data) noexcept
+        : table_(detail::FollowOffset(static_cast<const uint8_t *>(data))) {}
+
+    [[nodiscard]] size_t size() const noexcept { return detail::VectorSize(modules()); }
+
+    [[nodiscard]] ModuleView module(uint32_t idx) const noexcept {
+        return ModuleView(detail::TableAt(modules(), idx).data());
+    }
+
+  private:
+    [[nodiscard]] const uint8_t *modules() const noexcept { return table_.pointer(detail::MODULE_TABLE_MODULES); }
+
+    detail::FlatTable table_;
+};
+
+/**
+ * @brief Sampler configuration of a Model Resource Table entry
+ */
+class SamplerConfigView final {
+  public:
+    constexpr SamplerConfigView() noexcept = default;
+    explicit SamplerConfigView(const void *table) noexcept : table_(static_cast<const uint8_t *>(table)) {}
+
+    /// Returns the underlying data, which is also the SamplerConfigHandle of the configuration
+    [[nodiscard]] constexpr const void *data() const noexcept { return table_.data(); }
+    [[nodiscard]] constexpr bool valid() const noexcept { return table_.data() != nullptr; }
+
+    [[nodiscard]] uint32_t minFilter() const noexcept {
+        return table_.scalar<uint32_t>(detail::SAMPLER_CONFIG_MIN_FILTER, 0);
+    }
+    [[nodiscard]] uint32_t magFilter() const noexcept {
+        return table_.scalar<uint32_t>(detail::SAMPLER_CONFIG_MAG_FILTER, 0);
+    }
+    [[nodiscard]] uint32_t addressModeU() const noexcept {
+        return table_.scalar<uint32_t>(detail::SAMPLER_CONFIG_ADDRESS_MODE_U, 0);
+    }
+    [[nodiscard]] uint32_t addressModeV() const noexcept {
+        return table_.scalar<uint32_t>(detail::SAMPLER_CONFIG_ADDRESS_MODE_V, 0);
+    }
+    [[nodiscard]] uint32_t borderColor() const noexcept {
+        return table_.scalar<uint32_t>(detail::SAMPLER_CONFIG_BORDER_COLOR, 0);
+    }
+
+  private:
+    detail::FlatTable table_;
+};
+
+/**
+ * @brief Entry of the Model Resource Table
+ */
+class ModelResourceEntryView final {
+  public:
+    constexpr ModelResourceEntryView() noexcept = default;
+    explicit ModelResourceEntryView(const void *table) noexcept : table_(static_cast<const uint8_t *>(table)) {}
+
+    [[nodiscard]] std::optional<DescriptorType> descriptorType() const noexcept {
+        const auto type = table_.scalar<uint32_t>(detail::RESOURCE_DESCRIPTOR_TYPE, 0);
+        if (type == detail::NULL_DESCRIPTOR_TYPE) {
+            return std::nullopt;
+        }
+        return static_cast<DescriptorType>(type);
+    }
+
+    [[nodiscard]] std::optional<AliasGroupId> aliasGroupId() const noexcept {
+        const auto aliasGroupId = table_.scalar<uint32_t>(detail::RESOURCE_ALIAS_GROUP_ID, INVALID_ALIAS_GROUP_ID);
+        if (aliasGroupId == INVALID_ALIAS_GROUP_ID) {
+            return std::nullopt;
+        }
+        return aliasGroupId;
+    }
+
+    [[nodiscard]] FormatType vkFormat() const noexcept {
+        return static_cast<FormatType>(table_.scalar<uint32_t>(detail::RESOURCE_FORMAT, 0));
+    }
+
+    [[nodiscard]] ResourceCategory category() const noexcept {
+        const auto category = table_.scalar<uint8_t>(detail::RESOURCE_CATEGORY, 0);
+        return category <= detail::RESOURCE_CATEGORY_MAX ? static_cast<ResourceCategory>(category)
+                                                         : ResourceCategory::INPUT;
+    }
+
+    [[nodiscard]] DataView<int64_t> tensorShape() const noexcept {
+        return descriptionVector(detail::DESCRIPTION_SHAPE);
+    }
+
+    [[nodiscard]] DataView<int64_t> tensorStride() const noexcept {
+        return descriptionVector(detail::DESCRIPTION_STRIDES);
+    }
+
+    /// Returns the sampler configuration, invalid if the entry has none
+    [[nodiscard]] SamplerConfigView samplerConfig() const noexcept {
+        if (table_.scalar<uint8_t>(detail::RESOURCE_EXTRA_CONFIG_TYPE, 0) != detail::EXTRA_CONFIG_SAMPLER_CONFIG) {
+            return {};
+        }
+        return SamplerConfigView(table_.pointer(detail::RESOURCE_EXTRA_CONFIG));
+    }
+
+  private:
+    [[nodiscard]] DataView<int64_t> descriptionVector(uint16_t field) const noexcept {
+        const uint8_t *description = table_.pointer(detail::RESOURCE_DESCRIPTION);
+        if (description == nullptr) {
+            return {};
+        }
+        return detail::ScalarVector<int64_t>(detail::FlatTable(description).pointer(field));
+    }
+
+    detail::FlatTable table_;
+};
+
+/**
+ * @brief View of the Model Resource Table, see ModelResourceTableDecoder
+ */
+class ModelResourceView final {
+  public:
+    constexpr ModelResourceView() noexcept = default;
+    /// \param data Start of a verified Model Resource Table section
+    explicit ModelResourceView(const void *data) noexcept
+        : table_(detail::FollowOffset(static_cast<const uint8_t *>(data))) {}
+
+    [[nodiscard]] size_t size() const noexcept { return detail::VectorSize(entries()); }
+
+    [[nodiscard]] ModelResourceEntryView entry(uint32_t id) const noexcept {
+        return ModelResourceEntryView(detail::TableAt(entries(), id).data());
+    }
+
+  private:
+    [[nodiscard]] const uint8_t *entries() const noexcept {
+        return table_.pointer(detail::MODEL_RESOURCE_TABLE_ENTRIES);
+    }
+
+    detail::FlatTable table_;
+};
+
+/**
+ * @brief View of a constants section with fixed-size metadata records, see ConstantDecoder
+ */
+class ConstantView final {
+  public:
+    constexpr ConstantView() noexcept = default;
+    /// \param metaData First metadata record
+    /// \param recordSize Size in bytes of each metadata record
+    /// \param count Number of metadata records
+    /// \param payload Start of the constant data, which the record offsets are relative to
+    /// \param defaultAlignment Alignment of the constants when the records do not hold one
+    constexpr ConstantView(const uint8_t *metaData, size_t recordSize, uint64_t count, const uint8_t *payload,
+                           uint64_t defaultAlignment) noexcept
+        : metaData_(metaData), recordSize_(recordSize), count_(count), payload_(payload),
+          defaultAlignment_(defaultAlignment) {}
+
+    [[nodiscard]] size_t size() const noexcept { return static_cast<size_t>(count_); }
+
+    [[nodiscard]] uint32_t mrtIndex(uint32_t idx) const noexcept {
+        return detail::ReadScalar<uint32_t>(recordAt(idx) + MRT_INDEX_OFFSET);
+    }
+
+    [[nodiscard]] int64_t sparsityDimension(uint32_t idx) const noexcept {
+        return detail::ReadScalar<int32_t>(recordAt(idx) + SPARSITY_DIMENSION_OFFSET);
+    }
+
+    [[nodiscard]] bool isSparse(uint32_t idx) const noexcept {
+        return sparsityDimension(idx) > CONSTANT_NOT_SPARSE_DIMENSION;
+    }
+
+    [[nodiscard]] DataView<uint8_t> data(uint32_t idx) const noexcept {
+        const uint8_t *record = recordAt(idx);
+        const auto offset = detail::ReadScalar<uint64_t>(record + DATA_OFFSET_OFFSET);
+        const auto size = detail::ReadScalar<uint64_t>(record + DATA_SIZE_OFFSET);
+        return {payload_ + static_cast<size_t>(offset), static_cast<size_t>(size)};
+    }
+
+    /// Returns the offset of the constant data from the start of the payload
+    [[nodiscard]] uint64_t dataOffset(uint32_t idx) const noexcept {
+        return detail::ReadScalar<uint64_t>(recordAt(idx) + DATA_OFFSET_OFFSET);
+    }
+
+    /// Returns the size in bytes of the constant data
+    [[nodiscard]] uint64_t dataSize(uint32_t idx) const noexcept {
+        return detail::ReadScalar<uint64_t>(recordAt(idx) + DATA_SIZE_OFFSET);
+    }
+
+    [[nodiscard]] uint64_t alignment(uint32_t idx) const noexcept {
+        const uint8_t *record = recordAt(idx);
+        return recordSize_ > ALIGNMENT_OFFSET ? detail::ReadScalar<uint64_t>(record + ALIGNMENT_OFFSET)
+                                              : defaultAlignment_;
+    }
+
+  private:
+    static constexpr size_t MRT_INDEX_OFFSET = 0;
+    static constexpr size_t SPARSITY_DIMENSION_OFFSET = 4;
+    static constexpr size_t DATA_SIZE_OFFSET = 8;
+    static constexpr size_t DATA_OFFSET_OFFSET = 16;
+    static constexpr size_t ALIGNMENT_OFFSET = 24;
+
+    [[nodiscard]] const uint8_t *recordAt(uint32_t idx) const noexcept {
+        assert(static_cast<uint64_t>(idx) < count_ && "index out of range");
+        return metaData_ + recordSize_ * static_cast<size_t>(idx);
+    }
+
+    const uint8_t *metaData_ = nullptr;
+    size_t recordSize_ = 0;
+    uint64_t count_ = 0;
+    const uint8_t *payload_ = nullptr;
+    uint64_t defaultAlignment_ = 0;
+};
+
+/**
+ * @brief Verifies a Module Table section and returns a view of it (returns std::nullopt if the section is invalid)
+ *
+ * @param data Pointer to the start of the Module Table section
+ * @param size Size in bytes of the section
+ */
+std::optional<ModuleTableView> CreateModuleTableView(const void *data, uint64_t size);
+
+/**
+ * @brief Verifies a Model Sequence Table section and returns a view of it (returns std::nullopt if the section is
+ * invalid)
+ *
+ * @param data Pointer to the start of the Model Sequence Table section
+ * @param size Size in bytes of the section
+ */
+std::optional<ModelSequenceView> CreateModelSequenceView(const void *data, uint64_t size);
+
+/**
+ * @brief Verifies a Model Resource Table section and returns a view of it (returns std::nullopt if the section is
+ * invalid)
+ *
+ * @param data Pointer to the start of the Model Resource Table section
+ * @param size Size in bytes of the section
+ */
+std::optional<ModelResourceView> CreateModelResourceView(const void *data, uint64_t size);
+
+/**
+ * @brief Verifies a constants section and returns a view of it (returns std::nullopt if the section is invalid)
+ *
+ * Only the CONST00 and CONST01 constants sections are supported. Legacy FlatBuffers constants sections are rejected
+ * and must be read with a ConstantDecoder.
+ *
+ * @param data Pointer to the start of the constants section
+ * @param size Size in bytes of the section
+ */
+std::optional<ConstantView> CreateConstantView(const void *data, uint64_t size);
+
+/**@}*/
+
+} // namespace mlsdk::vgflib
@@ -150,6 +150,15 @@ class Encoder {
     /// group to a resource that already has one is invalid.
     virtual void SetAliasGroup(ResourceRef resource, AliasGroupId aliasGroupId) = 0;
 
+    /// \brief Set the file offset alignment of the constants added afterwards
+    ///
+    /// Use a page size alignment to allow constants to be mapped or read with direct I/O in place. Alignments
+    /// above 8 bytes are recorded in the constants section.
+    ///
+    /// \param alignment Power of two alignment in bytes. Values below 8 use the default 8-byte alignment. Other
+    /// values are rejected with an error and leave the alignment unchanged
+    virtual void SetConstantAlignment(uint64_t alignment) = 0;
+
     /// \brief Add constant values to a constant resource type in the model resource table
     ///
     /// \param resource Resource reference used in model resource table
@@ -160,6 +169,22 @@ class Encoder {
     virtual ConstantRef AddConstant(ResourceRef resource, const void *data, size_t sizeInBytes,
                                     int64_t sparsityDimension = CONSTANT_NOT_SPARSE_DIMENSION) = 0;
 
+    /// \brief Add constant values without copying them into the encoder
+    ///
+    /// The encoder only records the pointer and synthesizes the payload padding when writing. The memory must
+    /// stay valid and unchanged until WriteTo returns or the encoder is destroyed. When owner is set, the encoder
+    /// keeps a reference to it for that duration and releases it afterwards.
+    ///
+    /// \param resource Resource reference used in model resource table
+    /// \param data Pointer to the memory containing the constant data
+    /// \param sizeInBytes Size of the constant data to encode
+    /// \param sparsityDimension Dimension on which the constant is sparse
+    /// \param owner Optional ownership handle keeping data alive
+    /// \return ConstantRef type containing information for the added constant
+    virtual ConstantRef AddBorrowedConstant(ResourceRef resource, const void *data, size_t sizeInBytes,
+                                            int64_t sparsityDimension = CONSTANT_NOT_SPARSE_DIMENSION,
+                                            std::shared_ptr<const void> owner = nullptr) = 0;
+
     /// \brief Add a binding slot and associate to resource in the model resource table
     ///
     /// \param binding The binding slot to be added
@@ -216,14 +241,74 @@ class Encoder {
                                                const std::vector<BindingSlotRef> &outputs = {},
                                                const std::vector<std::string> &outputNames = {}) = 0;
 
+    /// \brief Build the module, model resource and model sequence sections on separate threads in Finish()
+    ///
+    /// The sections use independent builders, so the encoded output is identical to a serial Finish().
+    ///
+    /// \param enable True to finish the sections in parallel
+    virtual void SetParallelFinish(bool enable) = 0;
+
+    /// \brief Store the CRC32C of each section in the header of the written file
+    ///
+    /// Decoders can then detect torn or corrupted files with CheckIntegrity(). Computing the checksums reads every
+    /// constant once more when writing. Streaming encoders must enable checksums before adding constants.
+    ///
+    /// \param enable True to write section checksums
+    virtual void SetSectionChecksums(bool enable) = 0;
+
     /// \brief Inidicate the finishing of VGF file encoding
     virtual void Finish() = 0;
 
     /// \brief Write the output VGF file
     ///
+    /// The constant data is released as it is written, so the model can be written once, by any of the WriteTo and
+    /// WriteToFile functions. Later writes fail.
+    ///
     /// \param output Output destination of the .vgf file
     /// \return Bool True if write successful
     virtual bool WriteTo(std::ostream &output) = 0;
+
+    /// \brief Return the exact size in bytes of the encoded VGF file
+    ///
+    /// Must be called after Finish(). Not supported by streaming encoders.
+    ///
+    /// \return Size in bytes, or 0 on error
+    virtual uint64_t GetEncodedSize() const = 0;
+
+    /// \brief Write the output VGF file directly into a caller-owned buffer
+    ///
+    /// The buffer can be any writable memory, such as an mmap'd file region. Constant data is copied straight from
+    /// the encoder without an intermediate stream.
+    ///
+    /// \param dst Destination buffer
+    /// \param capacity Size of the destination buffer in bytes, at least GetEncodedSize()
+    /// \return Bool True if write successful
+    virtual bool WriteTo(void *dst, size_t capacity) = 0;
+
+    /// \brief Write the output VGF file to a path
+    ///
+    /// The file is preallocated to its final size, then the sections and constant payloads are written at their
+    /// final offsets from several threads, and the file is synced once. This avoids funnelling large models through
+    /// a single stream.
+    ///
+    /// \param path Path of the .vgf file to create or overwrite
+    /// \param numThreads Maximum number of writer threads, 0 to use the hardware concurrency
+    /// \return Bool True if write successful
+    virtual bool WriteToFile(const std::string &path, uint32_t numThreads = 0) = 0;
+};
+
+/// \brief Encoder writing constant payloads to its output file as they are added
+///
+/// The file is opened on creation and each constant is appended immediately, so constant data is never held by
+/// the encoder. The metadata sections are written and the header is patched by Close().
+class StreamingEncoder : public Encoder {
+  public:
+    /// \brief Write the metadata sections, patch the header and close the output file
+    ///
+    /// Finish must be called first. WriteTo is not supported by streaming encoders.
+    ///
+    /// \return Bool True if the file was completed successfully
+    virtual bool Close() = 0;
 };
 
 /// \brief Create an Encoder object
@@ -237,6 +322,17 @@ class Encoder {
 /// \return Encoder object
 std::unique_ptr<Encoder> CreateEncoder(uint16_t vkHeaderVersion);
 
+/// \brief Create a StreamingEncoder object writing to a file
+///
+/// \param path Path of the output .vgf file, truncated on creation
+/// \param vkHeaderVersion Value of VK_HEADER_VERSION, see CreateEncoder.
+/// \param constantCountHint Number of constants the metadata table reserves room for ahead of the streamed payloads.
+///                          Exceeding it is supported but moves the payloads once when the encoder is closed.
+///
+/// \return StreamingEncoder object, or nullptr if the file cannot be opened
+std::unique_ptr<StreamingEncoder> CreateStreamingEncoder(const std::string &path, uint16_t vkHeaderVersion,
+                                                         uint64_t constantCountHint = 1024);
+
 /**@}*/
 
 } // namespace mlsdk::vgflib
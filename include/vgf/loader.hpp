@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "decoder.hpp"
+#include "types.hpp"
+
+namespace mlsdk::vgflib {
+
+/**
+ * \defgroup VGFLoaderAPI Loader API
+ * @{
+ */
+
+/**
+ * @brief Source of the bytes of a VGF file, read one range at a time
+ *
+ * Implementations must support concurrent calls to read from several threads.
+ */
+class RangeReader {
+  public:
+    virtual ~RangeReader() = default;
+
+    /**
+     * @brief Returns the size of the file in bytes
+     */
+    virtual uint64_t size() const = 0;
+
+    /**
+     * @brief Reads the bytes [offset, offset + size) of the file into 'dst'
+     *
+     * @param offset Offset of the first byte to read
+     * @param dst Destination of at least 'size' bytes
+     * @param size Number of bytes to read
+     * @return False if the range is not within the file or the read failed
+     */
+    virtual bool read(uint64_t offset, void *dst, uint64_t size) const = 0;
+
+    /**
+     * @brief Returns the file descriptor that read goes through, or -1 if the reader does not read a descriptor
+     *
+     * LoadConstants submits the reads of readers with a descriptor to the kernel directly.
+     */
+    virtual int fileDescriptor() const { return -1; }
+};
+
+/**
+ * @brief Constructs a reader over a file held in memory, for example a file mapped with MemoryMap
+ *
+ * @param data Pointer to the file contents, which must outlive the reader
+ * @param size Size in bytes of the file contents
+ */
+std::unique_ptr<RangeReader> CreateMemoryRangeReader(const void *data, uint64_t size);
+
+/**
+ * @brief Constructs a reader opening a file and reading it with positional reads (returns nullptr if the file cannot
+ * be opened)
+ *
+ * The file is never mapped, and the reader closes it when destroyed.
+ *
+ * @param path Path of the file
+ */
+std::unique_ptr<RangeReader> CreateFileRangeReader(const std::string &path);
+
+/**
+ * @brief Constructs a reader reading a file descriptor opened by the caller with positional reads (returns nullptr if
+ * the size of the file cannot be read)
+ *
+ * Positional reads do not move the file offset, so any number of readers and threads can share the descriptor. The
+ * descriptor must stay open while the reader is used, and the file must not shrink.
+ *
+ * @param fd Descriptor of a file opened for reading
+ */
+std::unique_ptr<RangeReader> CreateFileDescriptorRangeReader(int fd);
+
+/**
+ * @brief Reads the bytes [offset, offset + size) of a file into 'dst', returning false on failure
+ */
+using RangeReadCallback = std::function<bool(uint64_t offset, void *dst, uint64_t size)>;
+
+/**
+ * @brief Constructs a reader forwarding reads to a callback, for example over an asset manager or a network stream
+ *
+ * Ranges outside of the file are rejected before the callback is called. The callback must support concurrent calls
+ * if the reader is used from several threads.
+ *
+ * @param size Size in bytes of the file
+ * @param callback Callback reading a range of the file
+ */
+std::unique_ptr<RangeReader> CreateCallbackRangeReader(uint64_t size, RangeReadCallback callback);
+
+/**
+ * @brief VGF file decoded from a RangeReader without holding the whole file in memory
+ *
+ * The loader reads and owns the header, the module, model sequence and model resource tables, and the metadata
+ * records of the Constants section. Constant data is only read on request, directly into buffers of the caller.
+ */
+class VgfLoader {
+  public:
+    virtual ~VgfLoader() = default;
+
+    /**
+     * @brief Returns the decoder of the file header
+     */
+    virtual const HeaderDecoder &getHeaderDecoder() const = 0;
+
+    /**
+     * @brief Returns the decoder of the Module Table section
+     */
+    virtual const ModuleTableDecoder &getModuleTableDecoder() const = 0;
+
+    /**
+     * @brief Returns the decoder of the Model Sequence Table section
+     */
+    virtual const ModelSequenceTableDecoder &getModelSequenceTableDecoder() const = 0;
+
+    /**
+     * @brief Returns the decoder of the Model Resource Table section
+     */
+    virtual const ModelResourceTableDecoder &getModelResourceTableDecoder() const = 0;
+
+    /**
+     * @brief Returns the reader the loader reads the file from
+     */
+    virtual const RangeReader &getRangeReader() const = 0;
+
+    /**
+     * @brief Returns the number of constants in the Constant section
+     */
+    virtual size_t getNumConstants() const = 0;
+
+    /**
+     * @brief Returns the Model Resource Table index of constant 'idx' (CONSTANT_INVALID_MRT_INDEX if idx is invalid)
+     *
+     * @param idx Index of the constant
+     */
+    virtual uint32_t getConstantMrtIndex(uint32_t idx) const = 0;
+
+    /**
+     * @brief Returns the dimension on which constant 'idx' is sparse (CONSTANT_INVALID_SPARSITY_DIMENSION if idx is
+     * invalid)
+     *
+     * @param idx Index of the constant
+     */
+    virtual int64_t getConstantSparsityDimension(uint32_t idx) const = 0;
+
+    /**
+     * @brief Returns the size in bytes of constant 'idx' (0 if idx is invalid)
+     *
+     * @param idx Index of the constant
+     */
+    virtual uint64_t getConstantSize(uint32_t idx) const = 0;
+
+    /**
+     * @brief Returns the offset of constant 'idx' in the file (0 if idx is invalid)
+     *
+     * @param idx Index of the constant
+     */
+    virtual uint64_t getConstantFileOffset(uint32_t idx) const = 0;
+
+    /**
+     * @brief Reads constant 'idx' into 'dst'
+     *
+     * Can be called concurrently from several threads.
+     *
+     * @param idx Index of the constant
+     * @param dst Destination buffer
+     * @param capacity Size in bytes of the destination buffer, at least getConstantSize(idx)
+     * @return False if idx is invalid, the buffer is too small or the read failed
+     */
+    virtual bool readConstant(uint32_t idx, void *dst, uint64_t capacity) const = 0;
+
+    /**
+     * @brief Reads constant 'idx' in chunks of at most 'stagingSize' bytes into a staging buffer of the caller, passing
+     * each chunk to a callback
+     *
+     * Only one chunk is held in memory at a time, whatever the size of the constant, so that it can be fed to a fixed
+     * size upload ring. The chunks passed to the callback are views of the staging buffer, which the next chunk
+     * overwrites.
+     *
+     * @param idx Index of the constant
+     * @param staging Staging buffer
+     * @param stagingSize Size in bytes of the staging buffer
+     * @param callback Callback receiving the chunks
+     * @return False if idx is invalid, the staging buffer is empty, a read failed or the callback stopped the iteration
+     */
+    virtual bool forEachConstantChunk(uint32_t idx, void *staging, uint64_t stagingSize,
+                                      const ConstantChunkCallback &callback) const = 0;
+
+    /**
+     * @brief Reads constant 'idx' in chunks of at most 'chunkSize' bytes, passing each chunk to a callback
+     *
+     * Same as the overload taking a staging buffer, with a staging buffer of the size of a chunk allocated once for the
+     * call.
+     *
+     * @param idx Index of the constant
+     * @param chunkSize Maximum size in bytes of a chunk
+     * @param callback Callback receiving the chunks
+     * @return False if idx is invalid, chunkSize is 0, a read failed or the callback stopped the iteration
+     */
+    virtual bool forEachConstantChunk(uint32_t idx, uint64_t chunkSize,
+                                      const ConstantChunkCallback &callback) const = 0;
+};
+
+/**
+ * @brief Constructs a loader reading the header, the tables and the constant metadata of a VGF file (returns nullptr
+ * if the file is invalid)
+ *
+ * Only the CONST00 and CONST01 Constants sections can be loaded, as the legacy FlatBuffers sections cannot be decoded
+ * without their payload.
+ *
+ * @param reader Reader of the file, which must outlive the loader
+ * @param mode Verification of the FlatBuffers sections
+ */
+std::unique_ptr<VgfLoader> CreateVgfLoader(const RangeReader &reader, VerificationMode mode = VerificationMode::FULL);
+
+/**
+ * @brief Constant to read by LoadConstants and its destination
+ */
+struct ConstantLoadRequest {
+    /// Index of the constant
+    uint32_t idx = 0;
+    /// Destination buffer
+    void *dst = nullptr;
+    /// Size in bytes of the destination buffer, at least VgfLoader::getConstantSize(idx)
+    uint64_t capacity = 0;
+};
+
+/**
+ * @brief Called once for every request, with its index in the request list, when its constant is in its destination
+ * or could not be read
+ */
+using ConstantLoadCallback = std::function<void(size_t requestIdx, bool success)>;
+
+/**
+ * @brief How LoadConstants reads the constants
+ */
+enum class LoadBackend {
+    /// io_uring when the reader has a file descriptor and the kernel supports it, the thread pool otherwise
+    AUTO,
+    /// Submit the reads through an io_uring instance and wait for their completions on the calling thread
+    IO_URING,
+    /// Read on a pool of threads, with positional vectored reads when the reader has a file descriptor
+    THREAD_POOL,
+};
+
+/**
+ * @brief Options of LoadConstants
+ */
+struct LoadConstantsOptions {
+    LoadBackend backend = LoadBackend::AUTO;
+    /// Maximum number of reads in flight with io_uring, 0 is treated as 1
+    uint32_t queueDepth = 64;
+    /// Number of threads of the thread pool, 0 to use the hardware concurrency
+    uint32_t numThreads = 0;
+    /// Constants at most this many bytes apart in the file are read together, discarding the bytes between them
+    uint64_t maxMergedGap = 4096;
+    /// Reads merging several constants are at most this many bytes, so that their first constants are not delayed
+    uint64_t maxMergedReadSize = 8 * 1024 * 1024;
+};
+
+/**
+ * @brief Returns true if the kernel supports io_uring and allows the process to use it
+ */
+bool IsIoUringSupported();
+
+/**
+ * @brief Reads many constants of a loader with several reads in flight, reporting each constant as it arrives
+ *
+ * The requests are sorted by file offset, and the reads of constants stored next to each other are merged into a single
+ * vectored read scattering into their destinations. Reads are issued until all requests completed, and 'onComplete'
+ * is called for each request as soon as its read completed, so that the caller can start using the constants that
+ * arrived while the others are still being read. The callbacks are never called concurrently, but the thread pool
+ * backend calls them from its threads. Invalid requests, with an out of range index or a too small or null
+ * destination, are reported as failed before any read is issued.
+ *
+ * @param loader Loader of the file
+ * @param requests Constants to read
+ * @param onComplete Completion callback, called once per request
+ * @param options Options
+ * @return False if any request failed, or if LoadBackend::IO_URING was requested but is not available, in which case
+ * no request is read or reported
+ */
+bool LoadConstants(const VgfLoader &loader, const std::vector<ConstantLoadRequest> &requests,
+                   const ConstantLoadCallback &onComplete, const LoadConstantsOptions &options = {});
+
+/**@}*/
+} // namespace mlsdk::vgflib
@@ -39,6 +39,10 @@ std::ostream &operator<<(std::ostream &os, const LogLevel &logLevel);
 
 /// \brief Enables logging functionality
 ///
+/// The callback is never called concurrently, even when the library logs from several threads. It may log again,
+/// call into the library or change the callback from the thread it is called on, but it must not wait for another
+/// thread that logs.
+///
 /// \param callback Callback that should be used for processing the log messages
 void EnableLogging(const LoggingCallback &callback);
 
@@ -15,6 +15,13 @@ constexpr size_t CONSTANT_SECTION_VERSION_OFFSET = 0;
 constexpr size_t CONSTANT_SECTION_VERSION_SIZE = 8;
 static_assert(sizeof(CONSTANT_SECTION_VERSION) == CONSTANT_SECTION_VERSION_SIZE);
 
+// V01 extends each metadata record with the file offset alignment of the constant
+constexpr const char CONSTANT_SECTION_VERSION_V01[8] = {'C', 'O', 'N', 'S', 'T', '0', '1', '\0'};
+static_assert(sizeof(CONSTANT_SECTION_VERSION_V01) == CONSTANT_SECTION_VERSION_SIZE);
+
+// Alignment of constant payloads in V00 sections
+constexpr uint64_t CONSTANT_DEFAULT_ALIGNMENT = 8;
+
 constexpr size_t CONSTANT_SECTION_COUNT_OFFSET = CONSTANT_SECTION_VERSION_OFFSET + CONSTANT_SECTION_VERSION_SIZE;
 constexpr size_t CONSTANT_SECTION_COUNT_SIZE = 8;
 
@@ -53,4 +60,30 @@ static_assert(offsetof(ConstantMetaDataV00, size) == CONSTANT_SECTION_METADATA_S
               "ConstantMetaData size field offset mismatched from spec.");
 static_assert(offsetof(ConstantMetaDataV00, offset) == CONSTANT_SECTION_METADATA_OFFSET_OFFSET,
               "ConstantMetaData offset field offset mismatched from spec.");
+
+struct ConstantMetaDataV01 {
+    uint32_t mrtIndex{};
+    int32_t sparsityDimension{static_cast<int32_t>(CONSTANT_NOT_SPARSE_DIMENSION)};
+    uint64_t size{};
+    uint64_t offset{};
+    uint64_t alignment{CONSTANT_DEFAULT_ALIGNMENT};
+};
+
+constexpr size_t CONSTANT_SECTION_METADATA_ALIGNMENT_OFFSET =
+    CONSTANT_SECTION_METADATA_OFFSET_OFFSET + CONSTANT_SECTION_METADATA_OFFSET_SIZE;
+constexpr size_t CONSTANT_SECTION_METADATA_ALIGNMENT_SIZE = 8;
+
+static_assert(sizeof(ConstantMetaDataV01) % 8 == 0);
+static_assert(sizeof(ConstantMetaDataV01) == sizeof(ConstantMetaDataV00) + sizeof(uint64_t));
+
+static_assert(offsetof(ConstantMetaDataV01, mrtIndex) == CONSTANT_SECTION_METADATA_MRT_INDEX_OFFSET,
+              "ConstantMetaData mrtIndex field offset mismatched from spec.");
+static_assert(offsetof(ConstantMetaDataV01, sparsityDimension) == CONSTANT_SECTION_METADATA_SPARSITY_DIMENSION_OFFSET,
+              "ConstantMetaData sparsityDimension field offset mismatched from spec.");
+static_assert(offsetof(ConstantMetaDataV01, size) == CONSTANT_SECTION_METADATA_SIZE_OFFSET,
+              "ConstantMetaData size field offset mismatched from spec.");
+static_assert(offsetof(ConstantMetaDataV01, offset) == CONSTANT_SECTION_METADATA_OFFSET_OFFSET,
+              "ConstantMetaData offset field offset mismatched from spec.");
+static_assert(offsetof(ConstantMetaDataV01, alignment) == CONSTANT_SECTION_METADATA_ALIGNMENT_OFFSET,
+              "ConstantMetaData alignment field offset mismatched from spec.");
 } // namespace mlsdk::vgflib
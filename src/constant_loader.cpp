@@ -0,0 +1,497 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "vgf/loader.hpp"
+
+#include "internal_logging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#    include <climits>
+#    include <sys/uio.h>
+#    include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#    define VGFLIB_HAS_IO_URING
+#    include <linux/io_uring.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#endif
+
+namespace mlsdk::vgflib {
+
+namespace {
+
+#ifdef _WIN32
+struct iovec {
+    void *iov_base;
+    size_t iov_len;
+};
+constexpr size_t MAX_IOVECS = 1;
+#elif defined(IOV_MAX)
+constexpr size_t MAX_IOVECS = std::min<size_t>(IOV_MAX, 256);
+#else
+constexpr size_t MAX_IOVECS = 16;
+#endif
+
+/// Constant of a request, at its offset in the file
+struct LoadEntry {
+    size_t requestIdx;
+    uint64_t offset;
+    void *dst;
+    uint64_t size;
+};
+
+/// Consecutive bytes of the file read by a single vectored read, scattering into the entries and the gap buffer
+struct LoadBatch {
+    size_t firstEntry;
+    size_t numEntries;
+    uint64_t offset;
+    uint64_t size;
+    std::vector<iovec> iovecs;
+    size_t iovIdx = 0;
+};
+
+/// Groups the entries sorted by offset into batches, merging entries at most maxGap bytes apart
+std::vector<LoadBatch> makeBatches(const std::vector<LoadEntry> &entries, std::vector<uint8_t> &gap,
+                                   const LoadConstantsOptions &options) {
+    std::vector<LoadBatch> batches;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const LoadEntry &entry = entries[i];
+        if (!batches.empty()) {
+            LoadBatch &batch = batches.back();
+            const uint64_t batchEnd = batch.offset + batch.size;
+            // Entries sharing a payload overlap, and are read by separate batches
+            if (entry.offset >= batchEnd && entry.offset - batchEnd <= options.maxMergedGap &&
+                batch.size + (entry.offset - batchEnd) + entry.size <= options.maxMergedReadSize &&
+                batch.iovecs.size() + 2 <= MAX_IOVECS) {
+                if (entry.offset > batchEnd) {
+                    gap.resize(std::max(gap.size(), static_cast<size_t>(entry.offset - batchEnd)));
+                    batch.iovecs.push_back({nullptr, static_cast<size_t>(entry.offset - batchEnd)});
+                }
+                batch.iovecs.push_back({entry.dst, static_cast<size_t>(entry.size)});
+                batch.size = entry.offset + entry.size - batch.offset;
+                ++batch.numEntries;
+                continue;
+            }
+        }
+        batches.push_back({i, 1, entry.offset, entry.size, {{entry.dst, static_cast<size_t>(entry.size)}}});
+    }
+    // Every gap reads into the same discarded buffer, which is only allocated once all batches are known
+    for (LoadBatch &batch : batches) {
+        for (iovec &iov : batch.iovecs) {
+            if (iov.iov_base == nullptr) {
+                iov.iov_base = gap.data();
+            }
+        }
+    }
+    return batches;
+}
+
+/// Moves the batch past 'read' bytes. Returns true once the whole batch was read.
+bool advanceBatch(LoadBatch &batch, uint64_t read) {
+    batch.offset += read;
+    batch.size -= read;
+    while (batch.iovIdx < batch.iovecs.size() && read >= batch.iovecs[batch.iovIdx].iov_len) {
+        read -= batch.iovecs[batch.iovIdx].iov_len;
+        ++batch.iovIdx;
+    }
+    if (batch.iovIdx < batch.iovecs.size()) {
+        iovec &iov = batch.iovecs[batch.iovIdx];
+        iov.iov_base = static_cast<uint8_t *>(iov.iov_base) + read;
+        iov.iov_len -= static_cast<size_t>(read);
+    }
+    return batch.size == 0;
+}
+
+#ifdef VGFLIB_HAS_IO_URING
+
+/// Minimal io_uring instance over the raw system calls, used from a single thread
+class IoUring {
+  public:
+    IoUring() = default;
+    IoUring(const IoUring &) = delete;
+    IoUring &operator=(const IoUring &) = delete;
+
+    ~IoUring() {
+        if (sqes_ != MAP_FAILED) {
+            munmap(sqes_, sqesSize_);
+        }
+        if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_) {
+            munmap(cqRing_, cqRingSize_);
+        }
+        if (sqRing_ != MAP_FAILED) {
+            munmap(sqRing_, sqRingSize_);
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+    }
+
+    /// Returns 0 or the errno of the failed setup
+    [[nodiscard]] int init(uint32_t entries) {
+        io_uring_params params = {};
+        fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            return errno;
+        }
+        sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) {
+            sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+        }
+        sqRing_ =
+            mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+        if (sqRing_ == MAP_FAILED) {
+            return errno;
+        }
+        cqRing_ = singleMap ? sqRing_
+                            : mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                                   IORING_OFF_CQ_RING);
+        if (cqRing_ == MAP_FAILED) {
+            return errno;
+        }
+        sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+        if (sqes_ == MAP_FAILED) {
+            return errno;
+        }
+
+        auto *sq = static_cast<uint8_t *>(sqRing_);
+        sqHead_ = reinterpret_cast<uint32_t *>(sq + params.sq_off.head);
+        sqTail_ = reinterpret_cast<uint32_t *>(sq + params.sq_off.tail);
+        sqMask_ = *reinterpret_cast<uint32_t *>(sq + params.sq_off.ring_mask);
+        sqArray_ = reinterpret_cast<uint32_t *>(sq + params.sq_off.array);
+        sqEntries_ = params.sq_entries;
+        auto *cq = static_cast<uint8_t *>(cqRing_);
+        cqHead_ = reinterpret_cast<uint32_t *>(cq + params.cq_off.head);
+        cqTail_ = reinterpret_cast<uint32_t *>(cq + params.cq_off.tail);
+        cqMask_ = *reinterpret_cast<uint32_t *>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+        localTail_ = *sqTail_;
+        return 0;
+    }
+
+    [[nodiscard]] uint32_t entries() const { return sqEntries_; }
+
+    /// Queues a vectored read, returns false if the submission queue is full
+    [[nodiscard]] bool queueRead(int fd, const iovec *iovecs, uint32_t numIovecs, uint64_t offset, uint64_t userData) {
+        if (localTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) >= sqEntries_) {
+            return false;
+        }
+        const uint32_t index = localTail_ & sqMask_;
+        io_uring_sqe &sqe = static_cast<io_uring_sqe *>(sqes_)[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READV;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(iovecs);
+        sqe.len = numIovecs;
+        sqe.off = offset;
+        sqe.user_data = userData;
+        sqArray_[index] = index;
+        ++localTail_;
+        return true;
+    }
+
+    /// Submits the queued reads and waits for at least one completion. Returns 0 or the errno of the failed call.
+    [[nodiscard]] int submitAndWait() {
+        __atomic_store_n(sqTail_, localTail_, __ATOMIC_RELEASE);
+        for (;;) {
+            // The kernel moves the head past the entries it consumed, so a retried call submits the rest
+            const uint32_t pending = localTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+            if (syscall(__NR_io_uring_enter, fd_, pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0) >= 0) {
+                return 0;
+            }
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                return errno;
+            }
+        }
+    }
+
+    /// Waits for at least one completion without submitting anything. Returns 0 or the errno of the failed call.
+    [[nodiscard]] int wait() {
+        for (;;) {
+            if (syscall(__NR_io_uring_enter, fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) >= 0) {
+                return 0;
+            }
+            if (errno != EINTR) {
+                return errno;
+            }
+        }
+    }
+
+    /// Returns the number of queued reads the kernel did not consume yet
+    [[nodiscard]] uint32_t unsubmitted() const { return localTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE); }
+
+    /// Calls f(userData, result) for every completion
+    template <typename F> void reap(F &&f) {
+        uint32_t head = *cqHead_;
+        const uint32_t tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const io_uring_cqe &cqe = cqes_[head & cqMask_];
+            f(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+    }
+
+  private:
+    int fd_ = -1;
+    void *sqRing_ = MAP_FAILED;
+    void *cqRing_ = MAP_FAILED;
+    void *sqes_ = MAP_FAILED;
+    size_t sqRingSize_ = 0;
+    size_t cqRingSize_ = 0;
+    size_t sqesSize_ = 0;
+    uint32_t *sqHead_ = nullptr;
+    uint32_t *sqTail_ = nullptr;
+    uint32_t *sqArray_ = nullptr;
+    uint32_t sqMask_ = 0;
+    uint32_t sqEntries_ = 0;
+    uint32_t localTail_ = 0;
+    uint32_t *cqHead_ = nullptr;
+    uint32_t *cqTail_ = nullptr;
+    uint32_t cqMask_ = 0;
+    io_uring_cqe *cqes_ = nullptr;
+};
+
+bool loadWithIoUring(IoUring &ring, int fd, std::vector<LoadBatch> &batches, uint32_t queueDepth,
+                     const std::function<void(const LoadBatch &, bool)> &complete) {
+    const uint32_t depth = std::max(1U, std::min(queueDepth, ring.entries()));
+    std::vector<size_t> queued;
+    queued.reserve(batches.size());
+    for (size_t i = batches.size(); i > 0; --i) {
+        queued.push_back(i - 1);
+    }
+
+    std::vector<uint8_t> completed(batches.size(), 0);
+    const auto completeBatch = [&](size_t batchIdx, bool read) {
+        completed[batchIdx] = 1;
+        complete(batches[batchIdx], read);
+    };
+
+    uint32_t inFlight = 0;
+    bool success = true;
+    while (!queued.empty() || inFlight > 0) {
+        while (!queued.empty() && inFlight < depth) {
+            LoadBatch &batch = batches[queued.back()];
+            if (!ring.queueRead(fd, batch.iovecs.data() + batch.iovIdx,
+                                static_cast<uint32_t>(batch.iovecs.size() - batch.iovIdx), batch.offset,
+                                queued.back())) {
+                break;
+            }
+            queued.pop_back();
+            ++inFlight;
+        }
+        if (const int error = ring.submitAndWait(); error != 0) {
+            logging::error(std::string("io_uring submission failed: ") + std::strerror(error));
+            // The reads the kernel consumed still write to the destinations and read the iovecs of their batches, so
+            // wait for them before reporting every batch not completed yet as failed
+            uint32_t submitted = inFlight - ring.unsubmitted();
+            while (submitted > 0) {
+                if (const int waitError = ring.wait(); waitError != 0) {
+                    logging::error(std::string("io_uring wait failed: ") + std::strerror(waitError));
+                    break;
+                }
+                ring.reap([&](uint64_t batchIdx, int32_t result) {
+                    --submitted;
+                    if (result > 0 && advanceBatch(batches[static_cast<size_t>(batchIdx)],
+                                                   static_cast<uint64_t>(result))) {
+                        completeBatch(static_cast<size_t>(batchIdx), true);
+                    }
+                });
+            }
+            for (size_t batchIdx = 0; batchIdx < batches.size(); ++batchIdx) {
+                if (completed[batchIdx] == 0) {
+                    completeBatch(batchIdx, false);
+                }
+            }
+            return false;
+        }
+        ring.reap([&](uint64_t batchIdx, int32_t result) {
+            --inFlight;
+            LoadBatch &batch = batches[static_cast<size_t>(batchIdx)];
+            if (result == -EINTR || result == -EAGAIN) {
+                queued.push_back(static_cast<size_t>(batchIdx));
+            } else if (result <= 0) {
+                logging::error("Failed to read " + std::to_string(batch.size) + " bytes at offset " +
+                               std::to_string(batch.offset) + ": " +
+                               (result == 0 ? std::string("unexpected end of file") : std::strerror(-result)));
+                completeBatch(static_cast<size_t>(batchIdx), false);
+                success = false;
+            } else if (advanceBatch(batch, static_cast<uint64_t>(result))) {
+                completeBatch(static_cast<size_t>(batchIdx), true);
+            } else {
+                // Short read, the rest of the batch is read by another submission
+                queued.push_back(static_cast<size_t>(batchIdx));
+            }
+        });
+    }
+    return success;
+}
+
+#endif
+
+/// Reads the whole batch with positional vectored reads. Returns 0 or the errno of the failed read.
+int readBatch(int fd, LoadBatch &batch) {
+#ifdef _WIN32
+    (void)fd;
+    (void)batch;
+    return ENOSYS;
+#else
+    while (batch.size > 0) {
+        const size_t numIovecs = std::min(batch.iovecs.size() - batch.iovIdx, MAX_IOVECS);
+        const ssize_t read = preadv(fd, batch.iovecs.data() + batch.iovIdx, static_cast<int>(numIovecs),
+                                    static_cast<off_t>(batch.offset));
+        if (read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        if (read == 0) {
+            return EIO;
+        }
+        advanceBatch(batch, static_cast<uint64_t>(read));
+    }
+    return 0;
+#endif
+}
+
+bool loadWithThreadPool(const RangeReader &reader, const std::vector<LoadEntry> &entries,
+                        std::vector<LoadBatch> &batches, uint32_t numThreads,
+                        const std::function<void(const LoadBatch &, bool)> &complete) {
+#ifdef _WIN32
+    const int fd = -1;
+#else
+    const int fd = reader.fileDescriptor();
+#endif
+    if (numThreads == 0) {
+        numThreads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    numThreads = static_cast<uint32_t>(std::min<size_t>(numThreads, batches.size()));
+
+    std::atomic<size_t> nextBatch{0};
+    std::atomic<bool> success{true};
+    const auto loadBatches = [&] {
+        for (size_t i = nextBatch++; i < batches.size(); i = nextBatch++) {
+            LoadBatch &batch = batches[i];
+            bool read = true;
+            if (fd >= 0) {
+                if (const int error = readBatch(fd, batch); error != 0) {
+                    logging::error("Failed to read " + std::to_string(batch.size) + " bytes at offset " +
+                                   std::to_string(batch.offset) + ": " + std::strerror(error));
+                    read = false;
+                }
+            } else {
+                // Readers without a descriptor gain nothing from merged reads
+                for (size_t e = batch.firstEntry; e < batch.firstEntry + batch.numEntries && read; ++e) {
+                    read = reader.read(entries[e].offset, entries[e].dst, entries[e].size);
+                }
+            }
+            complete(batch, read);
+            if (!read) {
+                success = false;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 1; i < numThreads; ++i) {
+        workers.emplace_back(loadBatches);
+    }
+    loadBatches();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    return success;
+}
+
+} // namespace
+
+bool IsIoUringSupported() {
+#ifdef VGFLIB_HAS_IO_URING
+    static const bool supported = [] {
+        IoUring ring;
+        return ring.init(1) == 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+bool LoadConstants(const VgfLoader &loader, const std::vector<ConstantLoadRequest> &requests,
+                   const ConstantLoadCallback &onComplete, const LoadConstantsOptions &options) {
+    const RangeReader &reader = loader.getRangeReader();
+    const bool canUseIoUring = reader.fileDescriptor() >= 0 && IsIoUringSupported();
+    if (options.backend == LoadBackend::IO_URING && !canUseIoUring) {
+        logging::error("io_uring is not available for this reader");
+        return false;
+    }
+#ifdef VGFLIB_HAS_IO_URING
+    const bool useIoUring = options.backend != LoadBackend::THREAD_POOL && canUseIoUring;
+    IoUring ring;
+    if (useIoUring) {
+        if (const int error = ring.init(std::max(1U, std::min(options.queueDepth, 4096U))); error != 0) {
+            logging::error(std::string("io_uring setup failed: ") + std::strerror(error));
+            return false;
+        }
+    }
+#endif
+
+    bool success = true;
+    std::vector<LoadEntry> entries;
+    entries.reserve(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const ConstantLoadRequest &request = requests[i];
+        const uint64_t size = loader.getConstantSize(request.idx);
+        if (static_cast<size_t>(request.idx) >= loader.getNumConstants() || request.capacity < size ||
+            (request.dst == nullptr && size != 0)) {
+            logging::error("Invalid load request " + std::to_string(i) + " for constant " +
+                           std::to_string(request.idx));
+            onComplete(i, false);
+            success = false;
+        } else if (size == 0) {
+            onComplete(i, true);
+        } else {
+            entries.push_back({i, loader.getConstantFileOffset(request.idx), request.dst, size});
+        }
+    }
+    if (entries.empty()) {
+        return success;
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const LoadEntry &lhs, const LoadEntry &rhs) { return lhs.offset < rhs.offset; });
+
+    std::vector<uint8_t> gap;
+    std::vector<LoadBatch> batches = makeBatches(entries, gap, options);
+    std::mutex completionMutex;
+    const std::function<void(const LoadBatch &, bool)> complete = [&](const LoadBatch &batch, bool read) {
+        std::lock_guard<std::mutex> lock(completionMutex);
+        for (size_t e = batch.firstEntry; e < batch.firstEntry + batch.numEntries; ++e) {
+            onComplete(entries[e].requestIdx, read);
+        }
+    };
+
+#ifdef VGFLIB_HAS_IO_URING
+    if (useIoUring) {
+        return loadWithIoUring(ring, reader.fileDescriptor(), batches, options.queueDepth, complete) && success;
+    }
+#endif
+    return loadWithThreadPool(reader, entries, batches, options.numThreads, complete) && success;
+}
+
+} // namespace mlsdk::vgflib
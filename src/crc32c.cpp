@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "crc32c.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+// _mm_crc32_u64 only exists on x86-64, 32-bit x86 uses the portable tables
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define VGF_CRC32C_SSE42 1
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define VGF_CRC32C_ARMV8 1
+#endif
+
+namespace mlsdk::vgflib {
+namespace {
+
+// Reflected Castagnoli polynomial
+constexpr uint32_t POLY = 0x82F63B78U;
+
+// Bytes per stream in each round of the interleaved hardware loop
+constexpr uint64_t BLOCK_SIZE = 4096;
+
+/// Slicing-by-8 lookup tables of the portable implementation
+using Tables = std::array<std::array<uint32_t, 256>, 8>;
+
+constexpr Tables makeTables() {
+    Tables tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1U) != 0 ? (crc >> 1) ^ POLY : crc >> 1;
+        }
+        tables[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; ++i) {
+        for (size_t table = 1; table < tables.size(); ++table) {
+            tables[table][i] = (tables[table - 1][i] >> 8) ^ tables[0][tables[table - 1][i] & 0xFFU];
+        }
+    }
+    return tables;
+}
+
+constexpr Tables TABLES = makeTables();
+
+uint64_t read64(const uint8_t *bytes) {
+    uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+/// Portable CRC of the raw register, without pre and post conditioning
+uint32_t crc32cPortable(uint32_t crc, const uint8_t *bytes, uint64_t size) {
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        word ^= crc;
+        crc = TABLES[7][word & 0xFFU] ^ TABLES[6][(word >> 8) & 0xFFU] ^ TABLES[5][(word >> 16) & 0xFFU] ^
+              TABLES[4][(word >> 24) & 0xFFU] ^ TABLES[3][(word >> 32) & 0xFFU] ^ TABLES[2][(word >> 40) & 0xFFU] ^
+              TABLES[1][(word >> 48) & 0xFFU] ^ TABLES[0][word >> 56];
+    }
+    for (; size > 0; --size, ++bytes) {
+        crc = (crc >> 8) ^ TABLES[0][(crc ^ *bytes) & 0xFFU];
+    }
+    return crc;
+}
+
+/// Product of two polynomials modulo POLY, in the reflected bit order
+uint32_t multModP(uint32_t a, uint32_t b) {
+    uint32_t m = 1U << 31;
+    uint32_t p = 0;
+    while (m != 0) {
+        if ((a & m) != 0) {
+            p ^= b;
+        }
+        m >>= 1;
+        b = (b & 1U) != 0 ? (b >> 1) ^ POLY : b >> 1;
+    }
+    return p;
+}
+
+/// x^(8 * size) modulo POLY, which shifts a raw register over size zero bytes
+uint32_t shiftOperator(uint64_t size) {
+    static const std::array<uint32_t, 64> powers = [] {
+        // powers[k] = x^(2^k)
+        std::array<uint32_t, 64> table{};
+        uint32_t p = 1U << 30;
+        for (auto &power : table) {
+            power = p;
+            p = multModP(p, p);
+        }
+        return table;
+    }();
+
+    uint32_t result = 1U << 31;
+    // Multiplying by 8 adds 3 to the exponent of 2
+    for (size_t k = 3; size != 0 && k < powers.size(); size >>= 1, ++k) {
+        if ((size & 1U) != 0) {
+            result = multModP(powers[k], result);
+        }
+    }
+    return result;
+}
+
+#if defined(VGF_CRC32C_SSE42) || defined(VGF_CRC32C_ARMV8)
+
+#if defined(VGF_CRC32C_SSE42)
+#define VGF_CRC32C_TARGET __attribute__((target("sse4.2")))
+VGF_CRC32C_TARGET inline uint32_t step64(uint32_t crc, uint64_t word) {
+    return static_cast<uint32_t>(_mm_crc32_u64(crc, word));
+}
+VGF_CRC32C_TARGET inline uint32_t step8(uint32_t crc, uint8_t byte) { return _mm_crc32_u8(crc, byte); }
+bool hardwareSupported() {
+    static const bool supported = __builtin_cpu_supports("sse4.2") != 0;
+    return supported;
+}
+#else
+#define VGF_CRC32C_TARGET
+inline uint32_t step64(uint32_t crc, uint64_t word) { return __crc32cd(crc, word); }
+inline uint32_t step8(uint32_t crc, uint8_t byte) { return __crc32cb(crc, byte); }
+bool hardwareSupported() { return true; }
+#endif
+
+/// Hardware CRC of the raw register. Large inputs run three independent streams per block, merged with shifts.
+VGF_CRC32C_TARGET uint32_t crc32cHardware(uint32_t crc, const uint8_t *bytes, uint64_t size) {
+    static const uint32_t blockShift = shiftOperator(BLOCK_SIZE);
+    for (; size >= 3 * BLOCK_SIZE; size -= 3 * BLOCK_SIZE, bytes += 3 * BLOCK_SIZE) {
+        uint32_t crc1 = 0;
+        uint32_t crc2 = 0;
+        for (uint64_t i = 0; i < BLOCK_SIZE; i += sizeof(uint64_t)) {
+            crc = step64(crc, read64(bytes + i));
+            crc1 = step64(crc1, read64(bytes + BLOCK_SIZE + i));
+            crc2 = step64(crc2, read64(bytes + 2 * BLOCK_SIZE + i));
+        }
+        crc = multModP(blockShift, multModP(blockShift, crc) ^ crc1) ^ crc2;
+    }
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+        crc = step64(crc, read64(bytes));
+    }
+    for (; size > 0; --size, ++bytes) {
+        crc = step8(crc, *bytes);
+    }
+    return crc;
+}
+
+#endif
+
+} // namespace
+
+uint32_t crc32c(uint32_t crc, const void *data, uint64_t size) {
+    const auto *bytes = static_cast<const uint8_t *>(data);
+#if defined(VGF_CRC32C_SSE42) || defined(VGF_CRC32C_ARMV8)
+    if (hardwareSupported()) {
+        return ~crc32cHardware(~crc, bytes, size);
+    }
+#endif
+    return ~crc32cPortable(~crc, bytes, size);
+}
+
+uint32_t crc32cCombine(uint32_t crcFirst, uint32_t crcSecond, uint64_t sizeSecond) {
+    return multModP(shiftOperator(sizeSecond), crcFirst) ^ crcSecond;
+}
+
+} // namespace mlsdk::vgflib
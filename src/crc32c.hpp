@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace mlsdk::vgflib {
+
+/// \brief Extend a CRC32C (Castagnoli) checksum with more bytes
+///
+/// Uses the SSE4.2 or Armv8 CRC32 instructions when the host supports them, with three interleaved streams to hide
+/// their latency, and a table driven implementation otherwise. Chaining calls over consecutive buffers gives the
+/// checksum of their concatenation, starting from 0.
+///
+/// \param crc Checksum of the preceding bytes, 0 for the first buffer
+/// \param data Bytes to checksum
+/// \param size Number of bytes
+/// \return Checksum of the preceding bytes followed by data
+uint32_t crc32c(uint32_t crc, const void *data, uint64_t size);
+
+/// \brief Checksum of the concatenation of two buffers from their checksums
+///
+/// \param crcFirst Checksum of the first buffer
+/// \param crcSecond Checksum of the second buffer
+/// \param sizeSecond Size in bytes of the second buffer
+uint32_t crc32cCombine(uint32_t crcFirst, uint32_t crcSecond, uint64_t sizeSecond);
+
+} // namespace mlsdk::vgflib
@@ -4,22 +4,36 @@
  */
 
 #include "vgf/decoder.hpp"
+#include "vgf/decoder_views.hpp"
+
+#define VGFLIB_VK_HELPERS // Avoid need to include Vulkan headers
+#include "vgf/vulkan_helpers.generated.hpp"
 
 #include "constant.hpp"
+#include "crc32c.hpp"
+#include "decoder_internal.hpp"
 #include "header.hpp"
 #include "internal_logging.hpp"
 #include "internal_types.hpp"
 #include "utils.hpp"
+#include "verification_cache.hpp"
 #include "vgf_generated.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
+#include <functional>
+#include <future>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <optional>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 
 namespace mlsdk::vgflib {
 namespace {
@@ -84,35 +98,85 @@ template <> constexpr std::string_view verifyTypeName<VGF::ConstantSection>() {
 template <> constexpr std::string_view verifyTypeName<VGF::ModuleTable>() { return "VerifyModuleTable"; }
 template <> constexpr std::string_view verifyTypeName<VGF::ModelSequenceTable>() { return "VerifyModelSequenceTable"; }
 template <> constexpr std::string_view verifyTypeName<VGF::ModelResourceTable>() { return "VerifyModelResourceTable"; }
-
-ModuleType fromVGF(VGF::ModuleType type) {
-    switch (type) {
-    case VGF::ModuleType::ModuleType_COMPUTE:
-        return ModuleType::COMPUTE;
-    case VGF::ModuleType::ModuleType_GRAPH:
-        return ModuleType::GRAPH;
-    default:
-        assert(false && "unknown Moduletype");
-        return ModuleType::COMPUTE;
-    }
+template <> constexpr std::string_view verifyTypeName<VGF::Module>() { return "VerifyModule"; }
+template <> constexpr std::string_view verifyTypeName<VGF::SegmentInfo>() { return "VerifySegmentInfo"; }
+template <> constexpr std::string_view verifyTypeName<VGF::ModelResourceTableEntry>() {
+    return "VerifyModelResourceTableEntry";
 }
 
-ResourceCategory fromVGF(VGF::ResourceCategory category) {
-    switch (category) {
-    case VGF::ResourceCategory::ResourceCategory_INPUT:
-        return ResourceCategory::INPUT;
-    case VGF::ResourceCategory::ResourceCategory_OUTPUT:
-        return ResourceCategory::OUTPUT;
-    case VGF::ResourceCategory::ResourceCategory_INTERMEDIATE:
-        return ResourceCategory::INTERMEDIATE;
-    case VGF::ResourceCategory::ResourceCategory_CONSTANT:
-        return ResourceCategory::CONSTANT;
-    default:
-        assert(false && "unknown ResourceCategory");
-        return ResourceCategory::INPUT;
-    }
+template <class T> constexpr VerifiedSection verifiedSection() {
+    static_assert(!std::is_same_v<T, T>, "verifiedSection not defined for this table type");
+    return {};
+}
+template <> constexpr VerifiedSection verifiedSection<VGF::ConstantSection>() {
+    return VerifiedSection::CONSTANT_SECTION;
+}
+template <> constexpr VerifiedSection verifiedSection<VGF::ModuleTable>() { return VerifiedSection::MODULE_TABLE; }
+template <> constexpr VerifiedSection verifiedSection<VGF::ModelSequenceTable>() {
+    return VerifiedSection::MODEL_SEQUENCE_TABLE;
+}
+template <> constexpr VerifiedSection verifiedSection<VGF::ModelResourceTable>() {
+    return VerifiedSection::MODEL_RESOURCE_TABLE;
 }
 
+// The views read the FlatBuffers tables directly, so their field offsets must follow the schema
+static_assert(detail::MODULE_TABLE_MODULES == VGF::ModuleTable::VT_MODULES);
+static_assert(detail::MODULE_TYPE == VGF::Module::VT_TYPE);
+static_assert(detail::MODULE_NAME == VGF::Module::VT_NAME);
+static_assert(detail::MODULE_ENTRY_POINT == VGF::Module::VT_ENTRY_POINT);
+static_assert(detail::MODULE_CODE_TYPE == VGF::Module::VT_CODE_TYPE);
+static_assert(detail::MODULE_CODE == VGF::Module::VT_CODE);
+static_assert(detail::SPIRV_WORDS == VGF::SPIRV::VT_WORDS);
+static_assert(detail::SHADER_CODE == VGF::GLSL::VT_CODE && detail::SHADER_CODE == VGF::HLSL::VT_CODE);
+static_assert(detail::MODEL_SEQUENCE_SEGMENTS == VGF::ModelSequenceTable::VT_SEGMENTS);
+static_assert(detail::MODEL_SEQUENCE_INPUTS == VGF::ModelSequenceTable::VT_INPUTS);
+static_assert(detail::MODEL_SEQUENCE_OUTPUTS == VGF::ModelSequenceTable::VT_OUTPUTS);
+static_assert(detail::MODEL_SEQUENCE_INPUT_NAMES == VGF::ModelSequenceTable::VT_INPUT_NAMES);
+static_assert(detail::MODEL_SEQUENCE_OUTPUT_NAMES == VGF::ModelSequenceTable::VT_OUTPUT_NAMES);
+static_assert(detail::SEGMENT_TYPE == VGF::SegmentInfo::VT_TYPE);
+static_assert(detail::SEGMENT_NAME == VGF::SegmentInfo::VT_NAME);
+static_assert(detail::SEGMENT_MODULE_INDEX == VGF::SegmentInfo::VT_MODULE_INDEX);
+static_assert(detail::SEGMENT_SET_INFOS == VGF::SegmentInfo::VT_SET_INFOS);
+static_assert(detail::SEGMENT_INPUTS == VGF::SegmentInfo::VT_INPUTS);
+static_assert(detail::SEGMENT_OUTPUTS == VGF::SegmentInfo::VT_OUTPUTS);
+static_assert(detail::SEGMENT_CONSTANTS == VGF::SegmentInfo::VT_CONSTANTS);
+static_assert(detail::SEGMENT_DISPATCH_SHAPE == VGF::SegmentInfo::VT_DISPATCH_SHAPE);
+static_assert(detail::SEGMENT_PUSH_CONSTANT_RANGES == VGF::SegmentInfo::VT_PUSH_CONSTANT_RANGES);
+static_assert(detail::DESCRIPTOR_SET_INFO_BINDINGS == VGF::DescriptorSetInfo::VT_BINDINGS);
+static_assert(detail::DESCRIPTOR_SET_INFO_SET_INDEX == VGF::DescriptorSetInfo::VT_SET_INDEX);
+static_assert(detail::BINDING_SLOT_BINDING == VGF::BindingSlot::VT_BINDING);
+static_assert(detail::BINDING_SLOT_MRT_INDEX == VGF::BindingSlot::VT_MRT_INDEX);
+static_assert(detail::PUSH_CONSTANT_RANGE_STAGE_FLAGS == VGF::PushConstantRange::VT_STAGE_FLAGS);
+static_assert(detail::PUSH_CONSTANT_RANGE_OFFSET == VGF::PushConstantRange::VT_OFFSET);
+static_assert(detail::PUSH_CONSTANT_RANGE_SIZE == VGF::PushConstantRange::VT_SIZE);
+static_assert(detail::MODEL_RESOURCE_TABLE_ENTRIES == VGF::ModelResourceTable::VT_MRT_ENTRY);
+static_assert(detail::RESOURCE_DESCRIPTOR_TYPE == VGF::ModelResourceTableEntry::VT_VK_DESCRIPTOR_TYPE);
+static_assert(detail::RESOURCE_FORMAT == VGF::ModelResourceTableEntry::VT_VK_FORMAT);
+static_assert(detail::RESOURCE_CATEGORY == VGF::ModelResourceTableEntry::VT_CATEGORY);
+static_assert(detail::RESOURCE_DESCRIPTION == VGF::ModelResourceTableEntry::VT_DESCRIPTION);
+static_assert(detail::RESOURCE_EXTRA_CONFIG_TYPE == VGF::ModelResourceTableEntry::VT_EXTRA_CONFIG_TYPE);
+static_assert(detail::RESOURCE_EXTRA_CONFIG == VGF::ModelResourceTableEntry::VT_EXTRA_CONFIG);
+static_assert(detail::RESOURCE_ALIAS_GROUP_ID == VGF::ModelResourceTableEntry::VT_ALIAS_GROUP_ID);
+static_assert(detail::DESCRIPTION_SHAPE == VGF::Description::VT_SHAPE);
+static_assert(detail::DESCRIPTION_STRIDES == VGF::Description::VT_STRIDES);
+static_assert(detail::SAMPLER_CONFIG_MIN_FILTER == VGF::SamplerConfig::VT_MIN_FILTER);
+static_assert(detail::SAMPLER_CONFIG_MAG_FILTER == VGF::SamplerConfig::VT_MAG_FILTER);
+static_assert(detail::SAMPLER_CONFIG_ADDRESS_MODE_U == VGF::SamplerConfig::VT_ADDRESS_MODE_U);
+static_assert(detail::SAMPLER_CONFIG_ADDRESS_MODE_V == VGF::SamplerConfig::VT_ADDRESS_MODE_V);
+static_assert(detail::SAMPLER_CONFIG_BORDER_COLOR == VGF::SamplerConfig::VT_BORDER_COLOR);
+
+static_assert(detail::MODULE_CODE_SPIRV == VGF::ModuleCode_SPIRV);
+static_assert(detail::MODULE_CODE_GLSL == VGF::ModuleCode_GLSL);
+static_assert(detail::MODULE_CODE_HLSL == VGF::ModuleCode_HLSL);
+static_assert(detail::EXTRA_CONFIG_SAMPLER_CONFIG == VGF::ExtraConfig_SamplerConfig);
+static_assert(detail::MODULE_TYPE_GRAPH == VGF::ModuleType_GRAPH);
+static_assert(detail::RESOURCE_CATEGORY_MAX == VGF::ResourceCategory_MAX);
+static_assert(static_cast<int>(ResourceCategory::INPUT) == VGF::ResourceCategory_INPUT);
+static_assert(static_cast<int>(ResourceCategory::OUTPUT) == VGF::ResourceCategory_OUTPUT);
+static_assert(static_cast<int>(ResourceCategory::INTERMEDIATE) == VGF::ResourceCategory_INTERMEDIATE);
+static_assert(static_cast<int>(ResourceCategory::CONSTANT) == VGF::ResourceCategory_CONSTANT);
+static_assert(detail::NULL_DESCRIPTOR_TYPE == NullOptDescriptorType());
+
 constexpr FourCCValue OldMagicAsFourCC() {
     auto v = HEADER_MAGIC_VALUE_OLD;
 
@@ -124,14 +188,75 @@ constexpr FourCCValue OldMagicAsFourCC() {
     return FourCC(toChar(v, 0), toChar(v, 8), toChar(v, 16), toChar(v, 24));
 }
 
-std::string_view ToStringView(const flatbuffers::String *string) {
-    if (string == nullptr) {
-        return {};
+// Verify the root table, leaving the entries of its large vectors of tables to LazyEntries
+template <class T> bool VerifyRootTable(flatbuffers::Verifier &verifier, const T *root) {
+    // Sections without lazily verified entries are verified in full
+    return verifier.VerifyTable(root);
+}
+
+template <> bool VerifyRootTable<VGF::ModuleTable>(flatbuffers::Verifier &verifier, const VGF::ModuleTable *root) {
+    const auto *table = reinterpret_cast<const flatbuffers::Table *>(root);
+    return table->VerifyTableStart(verifier) && table->VerifyOffset(verifier, VGF::ModuleTable::VT_MODULES) &&
+           verifier.VerifyVector(root->modules()) && verifier.EndTable();
+}
+
+template <>
+bool VerifyRootTable<VGF::ModelSequenceTable>(flatbuffers::Verifier &verifier, const VGF::ModelSequenceTable *root) {
+    const auto *table = reinterpret_cast<const flatbuffers::Table *>(root);
+    return table->VerifyTableStart(verifier) &&
+           table->VerifyOffset(verifier, VGF::ModelSequenceTable::VT_SEGMENTS) &&
+           verifier.VerifyVector(root->segments()) &&
+           table->VerifyOffset(verifier, VGF::ModelSequenceTable::VT_INPUTS) && verifier.VerifyVector(root->inputs()) &&
+           verifier.VerifyVectorOfTables(root->inputs()) &&
+           table->VerifyOffset(verifier, VGF::ModelSequenceTable::VT_OUTPUTS) &&
+           verifier.VerifyVector(root->outputs()) && verifier.VerifyVectorOfTables(root->outputs()) &&
+           table->VerifyOffset(verifier, VGF::ModelSequenceTable::VT_INPUT_NAMES) &&
+           verifier.VerifyVector(root->input_names()) && verifier.VerifyVectorOfStrings(root->input_names()) &&
+           table->VerifyOffset(verifier, VGF::ModelSequenceTable::VT_OUTPUT_NAMES) &&
+           verifier.VerifyVector(root->output_names()) && verifier.VerifyVectorOfStrings(root->output_names()) &&
+           verifier.EndTable();
+}
+
+template <>
+bool VerifyRootTable<VGF::ModelResourceTable>(flatbuffers::Verifier &verifier, const VGF::ModelResourceTable *root) {
+    const auto *table = reinterpret_cast<const flatbuffers::Table *>(root);
+    return table->VerifyTableStart(verifier) &&
+           table->VerifyOffset(verifier, VGF::ModelResourceTable::VT_MRT_ENTRY) &&
+           verifier.VerifyVector(root->mrt_entry()) && verifier.EndTable();
+}
+
+template <class T> bool VerifyEntrySemantic(const T *, uint32_t) { return true; }
+
+template <> bool VerifyEntrySemantic<VGF::SegmentInfo>(const VGF::SegmentInfo *segment, uint32_t idx) {
+    const auto *dispatchShape = segment->dispatch_shape();
+    if (dispatchShape != nullptr && dispatchShape->size() != 3) {
+        logging::error("VerifyModelSequenceTable: SegmentInfo.dispatch_shape must contain 3 elements at index " +
+                       std::to_string(idx));
+        return false;
+    }
+    return true;
+}
+
+template <class T> bool VerifySemantic(const T *) { return true; }
+
+template <> bool VerifySemantic<VGF::ModelSequenceTable>(const VGF::ModelSequenceTable *modelSequenceTable) {
+    const auto *segments = modelSequenceTable->segments();
+    if (segments == nullptr) {
+        return true;
+    }
+
+    for (flatbuffers::uoffset_t i = 0; i < segments->size(); ++i) {
+        const auto *segment = segments->Get(i);
+        if (segment != nullptr && !VerifyEntrySemantic(segment, i)) {
+            return false;
+        }
     }
-    return std::string_view{string->c_str()};
+
+    return true;
 }
 
-template <class T> bool VerifyImpl(const void *data, const uint64_t size) {
+template <class T>
+bool VerifyImpl(const void *data, const uint64_t size, VerificationMode mode = VerificationMode::FULL) {
     const std::string typeName{verifyTypeName<T>()};
 
     if (data == nullptr) {
@@ -157,47 +282,109 @@ template <class T> bool VerifyImpl(const void *data, const uint64_t size) {
         return false;
     }
 
+    if (mode == VerificationMode::LAZY) {
+        // Only the root table and the bounds of its entry vectors, the entries are checked on access
+        flatbuffers::Verifier verifier(static_cast<const uint8_t *>(data), static_cast<size_t>(size));
+        if (verifier.VerifyOffset(0) == 0 || !VerifyRootTable(verifier, flatbuffers::GetRoot<T>(data))) {
+            logging::error(typeName + ": verification failed");
+            return false;
+        }
+        return true;
+    }
+
+    const auto digest = digestForVerificationCache(verifiedSection<T>(), data, size, size);
+    if (digest.has_value() && isVerificationCached(*digest)) {
+        return true;
+    }
+
     flatbuffers::Verifier verifier(static_cast<const uint8_t *>(data), static_cast<size_t>(size));
     if (!verifier.VerifyBuffer<T>()) {
         logging::error(typeName + ": verification failed");
         return false;
     }
+    if (!VerifySemantic(flatbuffers::GetRoot<T>(data))) {
+        return false;
+    }
+    if (digest.has_value()) {
+        recordVerification(*digest);
+    }
     return true;
 }
 
-template <class T> bool VerifySemantic(const T *) { return true; }
+// A table whose vtable declares no fields, so every accessor returns the default value of its field
+template <class T> const T *EmptyTable() {
+    // 4-byte vtable {vtable size, table size} followed by the table's offset back to it
+    alignas(flatbuffers::uoffset_t) static constexpr uint8_t emptyTable[] = {4, 0, 4, 0, 4, 0, 0, 0};
+    return reinterpret_cast<const T *>(emptyTable + 4);
+}
 
-template <> bool VerifySemantic<VGF::ModelSequenceTable>(const VGF::ModelSequenceTable *modelSequenceTable) {
-    const auto *segments = modelSequenceTable->segments();
-    if (segments == nullptr) {
-        return true;
+/// Entries of a vector of tables, verified on first access in VerificationMode::LAZY
+template <class T> class LazyEntries {
+  public:
+    using Vector = flatbuffers::Vector<flatbuffers::Offset<T>>;
+
+    LazyEntries(const void *buffer, uint64_t size, const Vector *entries, VerificationMode mode)
+        : buffer_(static_cast<const uint8_t *>(buffer)), size_(static_cast<size_t>(size)),
+          count_(entries == nullptr ? 0 : entries->size()) {
+        if (mode == VerificationMode::LAZY) {
+            // Verified bits followed by failed bits
+            bits_ = std::make_unique<std::atomic<uint64_t>[]>(2 * numWords());
+        }
     }
 
-    for (flatbuffers::uoffset_t i = 0; i < segments->size(); ++i) {
-        const auto *segment = segments->Get(i);
-        if (segment == nullptr) {
-            continue;
+    /// Returns the entry, or EmptyTable() if it fails lazy verification
+    [[nodiscard]] const T *get(const Vector *entries, uint32_t idx) const {
+        if (bits_ == nullptr) {
+            return entries->Get(idx);
+        }
+        if (idx >= count_) {
+            logging::error(std::string(verifyTypeName<T>()) + ": index out of range (index=" + std::to_string(idx) +
+                           ", size=" + std::to_string(count_) + ")");
+            return EmptyTable<T>();
         }
 
-        const auto *dispatchShape = segment->dispatch_shape();
-        if (dispatchShape != nullptr && dispatchShape->size() != 3) {
-            logging::error("VerifyModelSequenceTable: SegmentInfo.dispatch_shape must contain 3 elements at index " +
-                           std::to_string(i));
-            return false;
+        const uint64_t mask = uint64_t{1} << (idx % 64);
+        std::atomic<uint64_t> &verified = bits_[idx / 64];
+        std::atomic<uint64_t> &failed = bits_[numWords() + idx / 64];
+        if ((verified.load(std::memory_order_acquire) & mask) != 0) {
+            return entries->Get(idx);
+        }
+        if ((failed.load(std::memory_order_acquire) & mask) != 0) {
+            return EmptyTable<T>();
+        }
+
+        const T *entry = entries->Get(idx);
+        flatbuffers::Verifier verifier(buffer_, size_);
+        if (verifier.VerifyTable(entry) && VerifyEntrySemantic(entry, idx)) {
+            verified.fetch_or(mask, std::memory_order_release);
+            return entry;
         }
+        if ((failed.fetch_or(mask, std::memory_order_acq_rel) & mask) == 0) {
+            logging::error(std::string(verifyTypeName<T>()) + ": verification failed at index " + std::to_string(idx));
+        }
+        return EmptyTable<T>();
     }
 
-    return true;
-}
+  private:
+    [[nodiscard]] size_t numWords() const { return (static_cast<size_t>(count_) + 63) / 64; }
+
+    const uint8_t *buffer_;
+    size_t size_;
+    flatbuffers::uoffset_t count_;
+    std::unique_ptr<std::atomic<uint64_t>[]> bits_;
+};
 
 const char *getConstantSectionVersion(const void *data) {
     return static_cast<const char *>(data) + CONSTANT_SECTION_VERSION_OFFSET;
 }
 
-bool hasConstantSectionVersion(const void *data) {
-    return std::memcmp(getConstantSectionVersion(data), CONSTANT_SECTION_VERSION, CONSTANT_SECTION_VERSION_SIZE) == 0;
+bool hasConstantSectionVersion(const void *data, const char *version) {
+    return std::memcmp(getConstantSectionVersion(data), version, CONSTANT_SECTION_VERSION_SIZE) == 0;
 }
 
+constexpr uint64_t constantAlignment(const ConstantMetaDataV00 &) { return CONSTANT_DEFAULT_ALIGNMENT; }
+constexpr uint64_t constantAlignment(const ConstantMetaDataV01 &metaData) { return metaData.alignment; }
+
 } // namespace
 
 // Header Decoder
@@ -299,6 +486,31 @@ class HeaderDecoderImpl : public HeaderDecoder {
         return ReadBytesAs<uint64_t>(header_, HEADER_CONSTANT_SECTION_OFFSET_OFFSET);
     }
 
+    [[nodiscard]] uint64_t GetChecksumType() const {
+        return ReadBytesAs<uint64_t>(header_, HEADER_CHECKSUM_TYPE_OFFSET);
+    }
+
+    [[nodiscard]] ByteRange GetSectionRange(SectionName section) const {
+        switch (section) {
+        case SectionName::MODULES:
+            return {GetModuleTableOffset(), GetModuleTableSize()};
+        case SectionName::MODEL_SEQUENCE:
+            return {GetModelSequenceTableOffset(), GetModelSequenceTableSize()};
+        case SectionName::RESOURCES:
+            return {GetModelResourceTableOffset(), GetModelResourceTableSize()};
+        case SectionName::CONSTANTS:
+            return {GetConstantsOffset(), GetConstantsSize()};
+        }
+        assert(false && "unknown SectionName");
+        return {};
+    }
+
+    [[nodiscard]] uint32_t GetSectionChecksum(SectionName section) const {
+        constexpr size_t offsets[] = {HEADER_MODULE_CHECKSUM_OFFSET, HEADER_MODEL_SEQUENCE_CHECKSUM_OFFSET,
+                                      HEADER_MODEL_RESOURCE_CHECKSUM_OFFSET, HEADER_CONSTANT_CHECKSUM_OFFSET};
+        return static_cast<uint32_t>(ReadBytesAs<uint64_t>(header_, offsets[static_cast<size_t>(section)]));
+    }
+
   private:
     [[nodiscard]] static bool _verify(HeaderDecoderImpl *decoder, uint64_t fileSize) {
         if (!decoder->IsValid() || !decoder->CheckVersion()) {
@@ -328,59 +540,102 @@ HeaderDecoder *CreateHeaderDecoderInPlace(const void *const data, uint64_t heade
     return HeaderDecoderImpl::CreateInPlace(data, headerSize, fileSize, decoderMem);
 }
 
+namespace {
+
+IntegrityStatus CheckSectionIntegrity(const HeaderDecoderImpl &header, const void *const data, SectionName section) {
+    if (header.GetChecksumType() == HEADER_CHECKSUM_TYPE_NONE) {
+        return IntegrityStatus::NO_CHECKSUMS;
+    }
+    if (header.GetChecksumType() != HEADER_CHECKSUM_TYPE_CRC32C) {
+        logging::error("Unknown section checksum type " + std::to_string(header.GetChecksumType()));
+        return IntegrityStatus::INVALID_FILE;
+    }
+
+    // The header decoder checked that the section lies within the file
+    const ByteRange range = header.GetSectionRange(section);
+    const uint32_t expected = header.GetSectionChecksum(section);
+    const auto *bytes = static_cast<const uint8_t *>(data) + static_cast<size_t>(range.offset);
+    const uint32_t actual = crc32c(0, bytes, range.size);
+    if (actual != expected) {
+        constexpr const char *names[] = {"Module table", "Model sequence table", "Model resource table", "Constants"};
+        logging::error(std::string(names[static_cast<size_t>(section)]) + " section checksum mismatch (expected " +
+                       std::to_string(expected) + ", actual " + std::to_string(actual) + ")");
+        return IntegrityStatus::CORRUPTED;
+    }
+    return IntegrityStatus::VALID;
+}
+
+} // namespace
+
+IntegrityStatus CheckSectionIntegrity(const void *const data, uint64_t size, SectionName section) {
+    const auto header = HeaderDecoderImpl::Create(data, HeaderSize(), size);
+    if (header == nullptr) {
+        return IntegrityStatus::INVALID_FILE;
+    }
+    return CheckSectionIntegrity(*header, data, section);
+}
+
+IntegrityStatus CheckIntegrity(const void *const data, uint64_t size) {
+    const auto header = HeaderDecoderImpl::Create(data, HeaderSize(), size);
+    if (header == nullptr) {
+        return IntegrityStatus::INVALID_FILE;
+    }
+    for (const SectionName section :
+         {SectionName::MODULES, SectionName::MODEL_SEQUENCE, SectionName::RESOURCES, SectionName::CONSTANTS}) {
+        if (const IntegrityStatus status = CheckSectionIntegrity(*header, data, section);
+            status != IntegrityStatus::VALID) {
+            return status;
+        }
+    }
+    return IntegrityStatus::VALID;
+}
+
 // Module Table decoder
-class ModuleTableDecoderImpl : public ModuleTableDecoder {
+class ModuleTableDecoderImpl final : public ModuleTableDecoder {
   public:
-    explicit ModuleTableDecoderImpl(const void *const data, uint64_t size)
-        : moduleTable_(flatbuffers::GetRoot<const VGF::ModuleTable>(data)) {
-        (void)size;
+    static std::unique_ptr<ModuleTableDecoderImpl> Create(const void *const data, uint64_t size,
+                                                          VerificationMode mode) {
+        if (!VerifyImpl<VGF::ModuleTable>(data, size, mode)) {
+            logging::error("Module table could not be decoded safely");
+            return nullptr;
+        }
+        return std::unique_ptr<ModuleTableDecoderImpl>(new ModuleTableDecoderImpl(data, size, mode));
     }
 
-    [[nodiscard]] size_t size() const override {
-        const auto *modules = moduleTable_->modules();
-        return modules == nullptr ? 0 : modules->size();
+    static ModuleTableDecoderImpl *CreateInPlace(const void *const data, uint64_t size, void *decoderMem,
+                                                 VerificationMode mode) {
+        if (!VerifyImpl<VGF::ModuleTable>(data, size, mode)) {
+            logging::error("Module table could not be decoded safely");
+            return nullptr;
+        }
+        return new (decoderMem) ModuleTableDecoderImpl(data, size, mode);
     }
 
-    [[nodiscard]] ModuleType getModuleType(uint32_t idx) const override { return fromVGF(getModuleAt(idx)->type()); }
+    [[nodiscard]] size_t size() const override { return view_.size(); }
 
-    [[nodiscard]] std::string_view getModuleName(uint32_t idx) const override {
-        return ToStringView(getModuleAt(idx)->name());
-    }
+    [[nodiscard]] ModuleType getModuleType(uint32_t idx) const override { return getModuleAt(idx).type(); }
+
+    [[nodiscard]] std::string_view getModuleName(uint32_t idx) const override { return getModuleAt(idx).name(); }
 
     [[nodiscard]] bool hasSPIRV(uint32_t idx) const override {
         logging::warning("hasSPIRV is deprecated use isSPIRV instead");
         return isSPIRV(idx);
     }
 
-    [[nodiscard]] bool isSPIRV(uint32_t idx) const override {
-        return VGF::ModuleCode_SPIRV == getModuleAt(idx)->code_type();
-    }
+    [[nodiscard]] bool isSPIRV(uint32_t idx) const override { return getModuleAt(idx).isSPIRV(); }
 
-    [[nodiscard]] bool hasSPIRVCode(uint32_t idx) const override {
-        const VGF::SPIRV *spirv = getModuleAt(idx)->code_as_SPIRV();
-        return spirv != nullptr && spirv->words() != nullptr && !spirv->words()->empty();
-    }
+    [[nodiscard]] bool hasSPIRVCode(uint32_t idx) const override { return !getModuleAt(idx).spirvCode().empty(); }
 
-    [[nodiscard]] bool isGLSL(uint32_t idx) const override {
-        return VGF::ModuleCode_GLSL == getModuleAt(idx)->code_type();
-    }
+    [[nodiscard]] bool isGLSL(uint32_t idx) const override { return getModuleAt(idx).isGLSL(); }
 
-    [[nodiscard]] bool hasGLSLCode(uint32_t idx) const override {
-        const VGF::GLSL *glsl = getModuleAt(idx)->code_as_GLSL();
-        return glsl != nullptr && glsl->code() != nullptr && !glsl->code()->empty();
-    }
+    [[nodiscard]] bool hasGLSLCode(uint32_t idx) const override { return !getModuleAt(idx).glslCode().empty(); }
 
-    [[nodiscard]] bool isHLSL(uint32_t idx) const override {
-        return VGF::ModuleCode_HLSL == getModuleAt(idx)->code_type();
-    }
+    [[nodiscard]] bool isHLSL(uint32_t idx) const override { return getModuleAt(idx).isHLSL(); }
 
-    [[nodiscard]] bool hasHLSLCode(uint32_t idx) const override {
-        const VGF::HLSL *hlsl = getModuleAt(idx)->code_as_HLSL();
-        return hlsl != nullptr && hlsl->code() != nullptr && !hlsl->code()->empty();
-    }
+    [[nodiscard]] bool hasHLSLCode(uint32_t idx) const override { return !getModuleAt(idx).hlslCode().empty(); }
 
     [[nodiscard]] std::string_view getModuleEntryPoint(uint32_t idx) const override {
-        return ToStringView(getModuleAt(idx)->entry_point());
+        return getModuleAt(idx).entryPoint();
     }
 
     [[nodiscard]] DataView<uint32_t> getModuleCode(uint32_t idx) const override {
@@ -389,420 +644,427 @@ class ModuleTableDecoderImpl : public ModuleTableDecoder {
     }
 
     [[nodiscard]] DataView<uint32_t> getSPIRVModuleCode(uint32_t idx) const override {
-        const VGF::SPIRV *spirv = getModuleAt(idx)->code_as_SPIRV();
-        if ((spirv != nullptr) && (spirv->words() != nullptr)) {
-            return {spirv->words()->data(), spirv->words()->size()};
+        const DataView<uint32_t> code = getModuleAt(idx).spirvCode();
+        if (code.data() == nullptr) {
+            logging::warning("Trying to fetch non-existing SPIR-V code");
         }
-        logging::warning("Trying to fetch non-existing SPIR-V code");
-        return {};
+        return code;
     }
 
     [[nodiscard]] std::string_view getGLSLModuleCode(uint32_t idx) const override {
-        const VGF::GLSL *glsl = getModuleAt(idx)->code_as_GLSL();
-        if (glsl != nullptr && glsl->code() != nullptr) {
-            return std::string_view{glsl->code()->data(), glsl->code()->size()};
+        const std::string_view code = getModuleAt(idx).glslCode();
+        if (code.data() == nullptr) {
+            logging::warning("Trying to fetch non-existing GLSL code");
         }
-        logging::warning("Trying to fetch non-existing GLSL code");
-        return {};
+        return code;
     }
 
     [[nodiscard]] std::string_view getHLSLModuleCode(uint32_t idx) const override {
-        const VGF::HLSL *hlsl = getModuleAt(idx)->code_as_HLSL();
-        if (hlsl != nullptr && hlsl->code() != nullptr) {
-            return std::string_view{hlsl->code()->data(), hlsl->code()->size()};
+        const std::string_view code = getModuleAt(idx).hlslCode();
+        if (code.data() == nullptr) {
+            logging::warning("Trying to fetch non-existing HLSL code");
         }
-        logging::warning("Trying to fetch non-existing HLSL code");
-        return {};
+        return code;
     }
 
   private:
-    [[nodiscard]] const VGF::Module *getModuleAt(uint32_t idx) const {
+    explicit ModuleTableDecoderImpl(const void *const data, uint64_t size, VerificationMode mode)
+        : view_(data), moduleTable_(flatbuffers::GetRoot<const VGF::ModuleTable>(data)),
+          modules_(data, size, moduleTable_->modules(), mode) {}
+
+    [[nodiscard]] ModuleView getModuleAt(uint32_t idx) const {
         const auto *modules = moduleTable_->modules();
         assert(modules && "no modules found");
-        return modules->Get(idx);
+        return ModuleView(modules_.get(modules, idx));
     }
 
+    ModuleTableView view_;
     const VGF::ModuleTable *moduleTable_;
+    LazyEntries<VGF::Module> modules_;
 };
 
 size_t ModuleTableDecoderSize() { return sizeof(ModuleTableDecoderImpl); }
 
-std::unique_ptr<ModuleTableDecoder> CreateModuleTableDecoder(const void *const data, const uint64_t size) {
+std::unique_ptr<ModuleTableDecoder> CreateModuleTableDecoder(const void *const data, const uint64_t size,
+                                                             VerificationMode mode) {
     assert(data != nullptr && "data is null");
-    if (!VerifyImpl<VGF::ModuleTable>(data, size)) {
-        logging::error("Module table could not be decoded safely");
-        return nullptr;
-    }
-    return std::make_unique<ModuleTableDecoderImpl>(data, size);
+    return ModuleTableDecoderImpl::Create(data, size, mode);
 }
 
 ModuleTableDecoder *CreateModuleTableDecoderInPlace(const void *const data, const uint64_t size, void *decoderMem) {
     assert(data != nullptr && "data is null");
     assert(decoderMem != nullptr && "decoderMem is null");
-    if (!VerifyImpl<VGF::ModuleTable>(data, size)) {
-        logging::error("Module table could not be decoded safely");
-        return nullptr;
-    }
-    return new (decoderMem) ModuleTableDecoderImpl(data, size);
+    return ModuleTableDecoderImpl::CreateInPlace(data, size, decoderMem, VerificationMode::FULL);
 }
 
 namespace {
-const flatbuffers::Vector<flatbuffers::Offset<VGF::BindingSlot>> *FromHandle(BindingSlotArrayHandle handle) {
-    return reinterpret_cast<const flatbuffers::Vector<flatbuffers::Offset<VGF::BindingSlot>> *>(handle);
-}
-
-BindingSlotArrayHandle ToHandle(const flatbuffers::Vector<flatbuffers::Offset<VGF::BindingSlot>> *ptr) {
-    return reinterpret_cast<BindingSlotArrayHandle>(ptr);
-}
-
-const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *FromHandle(NameArrayHandle handle) {
-    return reinterpret_cast<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(handle);
-}
-
-NameArrayHandle ToHandle(const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *ptr) {
-    return reinterpret_cast<NameArrayHandle>(ptr);
-}
+BindingSlotArrayHandle ToHandle(BindingSlotsView view) { return static_cast<BindingSlotArrayHandle>(view.data()); }
 
-const flatbuffers::Vector<flatbuffers::Offset<VGF::PushConstantRange>> *FromHandle(PushConstantRangeHandle handle) {
-    return reinterpret_cast<const flatbuffers::Vector<flatbuffers::Offset<VGF::PushConstantRange>> *>(handle);
-}
-
-PushConstantRangeHandle ToHandle(const flatbuffers::Vector<flatbuffers::Offset<VGF::PushConstantRange>> *ptr) {
-    return reinterpret_cast<PushConstantRangeHandle>(ptr);
-}
+NameArrayHandle ToHandle(NamesView view) { return static_cast<NameArrayHandle>(view.data()); }
 
-const VGF::SamplerConfig *FromHandle(SamplerConfigHandle handle) {
-    return reinterpret_cast<const VGF::SamplerConfig *>(handle);
+PushConstantRangeHandle ToHandle(PushConstantRangesView view) {
+    return static_cast<PushConstantRangeHandle>(view.data());
 }
 
-SamplerConfigHandle ToHandle(const VGF::SamplerConfig *ptr) { return reinterpret_cast<SamplerConfigHandle>(ptr); }
+SamplerConfigHandle ToHandle(SamplerConfigView view) { return static_cast<SamplerConfigHandle>(view.data()); }
 
 } // namespace
 
 // Model Sequence Table Decoder
-class ModelSequenceTableDecoderImpl : public ModelSequenceTableDecoder {
+class ModelSequenceTableDecoderImpl final : public ModelSequenceTableDecoder {
   public:
-    explicit ModelSequenceTableDecoderImpl(const void *const data, uint64_t size)
-        : modelSequenceTable_(flatbuffers::GetRoot<const VGF::ModelSequenceTable>(data)) {
-        (void)size;
+    static std::unique_ptr<ModelSequenceTableDecoderImpl> Create(const void *const data, uint64_t size,
+                                                                 VerificationMode mode) {
+        if (!_verify(data, size, mode)) {
+            return nullptr;
+        }
+        return std::unique_ptr<ModelSequenceTableDecoderImpl>(new ModelSequenceTableDecoderImpl(data, size, mode));
     }
 
-    [[nodiscard]] size_t modelSequenceTableSize() const override {
-        const auto *segments = modelSequenceTable_->segments();
-        return segments == nullptr ? 0 : segments->size();
+    static ModelSequenceTableDecoderImpl *CreateInPlace(const void *const data, uint64_t size, void *decoderMem,
+                                                        VerificationMode mode) {
+        if (!_verify(data, size, mode)) {
+            return nullptr;
+        }
+        return new (decoderMem) ModelSequenceTableDecoderImpl(data, size, mode);
     }
 
+    [[nodiscard]] size_t modelSequenceTableSize() const override { return view_.size(); }
+
     [[nodiscard]] size_t getSegmentDescriptorSetInfosSize(uint32_t segmentIdx) const override {
-        const auto *descriptors = getSegmentAt(segmentIdx)->set_infos();
-        return descriptors == nullptr ? 0 : descriptors->size();
+        return getSegmentAt(segmentIdx).descriptorSetInfosSize();
     }
 
     [[nodiscard]] uint32_t getSegmentDescriptorSetIndex(uint32_t segmentIdx, uint32_t descIdx) const override {
-        const auto *descriptorSetInfo = getDescriptorAt(getSegmentAt(segmentIdx), descIdx);
-        const uint32_t setIndex = descriptorSetInfo->set_index();
-        if (setIndex != std::numeric_limits<uint32_t>::max()) {
-            return setIndex;
-        }
-        // Legacy encoding did not include explicit descriptor set ids; use
-        // descriptor position as a backward-compatible fallback.
-        return descIdx;
+        return getSegmentAt(segmentIdx).descriptorSetIndex(descIdx);
     }
 
     [[nodiscard]] DataView<uint32_t> getSegmentConstantIndexes(uint32_t segmentIdx) const override {
-        const auto *constants = getSegmentAt(segmentIdx)->constants();
-        if (constants == nullptr) {
-            return {};
-        }
-        return {constants->data(), constants->size()};
+        return getSegmentAt(segmentIdx).constantIndexes();
     }
 
     [[nodiscard]] DataView<uint32_t> getSegmentDispatchShape(uint32_t segmentIdx) const override {
-        const auto *dispatchShape = getSegmentAt(segmentIdx)->dispatch_shape();
-        if (dispatchShape == nullptr) {
-            return {};
-        }
-        return {dispatchShape->data(), dispatchShape->size()};
+        return getSegmentAt(segmentIdx).dispatchShape();
     }
 
     [[nodiscard]] BindingSlotArrayHandle getDescriptorBindingSlotsHandle(uint32_t segmentIdx,
                                                                          uint32_t descIdx) const override {
-        return ToHandle(getDescriptorAt(getSegmentAt(segmentIdx), descIdx)->bindings());
+        return ToHandle(getSegmentAt(segmentIdx).descriptorBindingSlots(descIdx));
     }
 
     [[nodiscard]] BindingSlotArrayHandle getSegmentInputBindingSlotsHandle(uint32_t segmentIdx) const override {
-        return ToHandle(getSegmentAt(segmentIdx)->inputs());
+        return ToHandle(getSegmentAt(segmentIdx).inputs());
     }
 
     [[nodiscard]] BindingSlotArrayHandle getSegmentOutputBindingSlotsHandle(uint32_t segmentIdx) const override {
-        return ToHandle(getSegmentAt(segmentIdx)->outputs());
+        return ToHandle(getSegmentAt(segmentIdx).outputs());
     }
 
     [[nodiscard]] BindingSlotArrayHandle getModelSequenceInputBindingSlotsHandle() const override {
-        return ToHandle(modelSequenceTable_->inputs());
+        return ToHandle(view_.inputs());
     }
 
     [[nodiscard]] BindingSlotArrayHandle getModelSequenceOutputBindingSlotsHandle() const override {
-        return ToHandle(modelSequenceTable_->outputs());
+        return ToHandle(view_.outputs());
     }
 
     [[nodiscard]] size_t getBindingsSize(BindingSlotArrayHandle handle) const override {
-        if (handle == nullptr) {
-            return 0;
-        }
-        return FromHandle(handle)->size();
+        return BindingSlotsView(handle).size();
     }
 
     uint32_t getBindingSlotBinding(BindingSlotArrayHandle handle, uint32_t slotIdx) const override {
-        return FromHandle(handle)->Get(slotIdx)->binding();
+        return BindingSlotsView(handle).binding(slotIdx);
     }
 
     uint32_t getBindingSlotMrtIndex(BindingSlotArrayHandle handle, uint32_t slotIdx) const override {
-        return FromHandle(handle)->Get(slotIdx)->mrt_index();
+        return BindingSlotsView(handle).mrtIndex(slotIdx);
     }
 
     PushConstantRangeHandle getSegmentPushConstRange(uint32_t segmentIdx) const override {
-        return ToHandle(getSegmentAt(segmentIdx)->push_constant_ranges());
+        return ToHandle(getSegmentAt(segmentIdx).pushConstantRanges());
     }
 
     [[nodiscard]] NameArrayHandle getModelSequenceInputNamesHandle() const override {
-        return ToHandle(modelSequenceTable_->input_names());
+        return ToHandle(view_.inputNames());
     }
 
     [[nodiscard]] NameArrayHandle getModelSequenceOutputNamesHandle() const override {
-        return ToHandle(modelSequenceTable_->output_names());
+        return ToHandle(view_.outputNames());
     }
 
-    [[nodiscard]] size_t getNamesSize(NameArrayHandle handle) const override {
-        if (handle == nullptr) {
-            return 0;
-        }
-        return FromHandle(handle)->size();
-    }
+    [[nodiscard]] size_t getNamesSize(NameArrayHandle handle) const override { return NamesView(handle).size(); }
 
     [[nodiscard]] std::string_view getName(NameArrayHandle handle, uint32_t nameIdx) const override {
-        return std::string_view{FromHandle(handle)->Get(nameIdx)->c_str()};
+        return NamesView(handle).name(nameIdx);
     }
 
     [[nodiscard]] size_t getPushConstRangesSize(PushConstantRangeHandle handle) const override {
-        if (handle == nullptr) {
-            return 0;
-        }
-        return FromHandle(handle)->size();
+        return PushConstantRangesView(handle).size();
     }
 
     [[nodiscard]] uint32_t getPushConstRangeStageFlags(PushConstantRangeHandle handle,
                                                        uint32_t rangeIdx) const override {
-        return FromHandle(handle)->Get(rangeIdx)->stage_flags();
+        return PushConstantRangesView(handle).stageFlags(rangeIdx);
     }
 
     [[nodiscard]] uint32_t getPushConstRangeOffset(PushConstantRangeHandle handle, uint32_t rangeIdx) const override {
-        return FromHandle(handle)->Get(rangeIdx)->offset();
+        return PushConstantRangesView(handle).offset(rangeIdx);
     }
 
     [[nodiscard]] uint32_t getPushConstRangeSize(PushConstantRangeHandle handle, uint32_t rangeIdx) const override {
-        return FromHandle(handle)->Get(rangeIdx)->size();
+        return PushConstantRangesView(handle).rangeSize(rangeIdx);
     }
 
     [[nodiscard]] ModuleType getSegmentType(uint32_t segmentIdx) const override {
-        return fromVGF(getSegmentAt(segmentIdx)->type());
+        return getSegmentAt(segmentIdx).type();
     }
 
     [[nodiscard]] std::string_view getSegmentName(uint32_t segmentIdx) const override {
-        return ToStringView(getSegmentAt(segmentIdx)->name());
+        return getSegmentAt(segmentIdx).name();
     }
 
     [[nodiscard]] uint32_t getSegmentModuleIndex(uint32_t segmentIdx) const override {
-        return getSegmentAt(segmentIdx)->module_index();
+        return getSegmentAt(segmentIdx).moduleIndex();
     }
 
-  private:
-    [[nodiscard]] const VGF::SegmentInfo *getSegmentAt(uint32_t segmentIdx) const {
+    [[nodiscard]] SegmentView getSegmentAt(uint32_t segmentIdx) const {
         const auto *segments = modelSequenceTable_->segments();
         assert(segments && "no segment found at given index");
-        return segments->Get(segmentIdx);
+        return SegmentView(segments_.get(segments, segmentIdx));
     }
 
-    static const VGF::DescriptorSetInfo *getDescriptorAt(const VGF::SegmentInfo *segment, uint32_t segmentIdx) {
-        const auto *descriptors = segment->set_infos();
-        assert(descriptors && "no descriptor found at given index");
-        return descriptors->Get(segmentIdx);
+  private:
+    explicit ModelSequenceTableDecoderImpl(const void *const data, uint64_t size, VerificationMode mode)
+        : view_(data), modelSequenceTable_(flatbuffers::GetRoot<const VGF::ModelSequenceTable>(data)),
+          segments_(data, size, modelSequenceTable_->segments(), mode) {}
+
+    [[nodiscard]] static bool _verify(const void *const data, uint64_t size, VerificationMode mode) {
+        if (!VerifyImpl<VGF::ModelSequenceTable>(data, size, mode)) {
+            logging::error("Model sequence table could not be decoded safely");
+            return false;
+        }
+        return true;
     }
 
+    ModelSequenceView view_;
     const VGF::ModelSequenceTable *modelSequenceTable_;
+    LazyEntries<VGF::SegmentInfo> segments_;
 };
 
 size_t ModelSequenceTableDecoderSize() { return sizeof(ModelSequenceTableDecoderImpl); }
 
-std::unique_ptr<ModelSequenceTableDecoder> CreateModelSequenceTableDecoder(const void *const data,
-                                                                           const uint64_t size) {
+SegmentView GetSegmentView(const ModelSequenceTableDecoder &decoder, uint32_t segmentIdx) {
+    return static_cast<const ModelSequenceTableDecoderImpl &>(decoder).getSegmentAt(segmentIdx);
+}
+
+std::unique_ptr<ModelSequenceTableDecoder> CreateModelSequenceTableDecoder(const void *const data, const uint64_t size,
+                                                                           VerificationMode mode) {
     assert(data != nullptr && "data is null");
-    if (!VerifyImpl<VGF::ModelSequenceTable>(data, size)) {
-        logging::error("Model sequence table could not be decoded safely");
-        return nullptr;
-    }
-    if (!VerifySemantic(flatbuffers::GetRoot<const VGF::ModelSequenceTable>(data))) {
-        logging::error("Model sequence table could not be decoded safely");
-        return nullptr;
-    }
-    return std::make_unique<ModelSequenceTableDecoderImpl>(data, size);
+    return ModelSequenceTableDecoderImpl::Create(data, size, mode);
 }
 
 ModelSequenceTableDecoder *CreateModelSequenceTableDecoderInPlace(const void *const data, const uint64_t size,
                                                                   void *decoderMem) {
     assert(data != nullptr && "data is null");
     assert(decoderMem != nullptr && "decoderMem is null");
-    if (!VerifyImpl<VGF::ModelSequenceTable>(data, size)) {
-        logging::error("Model sequence table could not be decoded safely");
-        return nullptr;
-    }
-    if (!VerifySemantic(flatbuffers::GetRoot<const VGF::ModelSequenceTable>(data))) {
-        logging::error("Model sequence table could not be decoded safely");
-        return nullptr;
-    }
-    return new (decoderMem) ModelSequenceTableDecoderImpl(data, size);
+    return ModelSequenceTableDecoderImpl::CreateInPlace(data, size, decoderMem, VerificationMode::FULL);
 }
 
 // Model Resource Table Decoder
-class ModelResourceTableDecoderImpl : public ModelResourceTableDecoder {
-  public:
-    explicit ModelResourceTableDecoderImpl(const void *const data, uint64_t size)
-        : modelRecTable_(flatbuffers::GetRoot<const VGF::ModelResourceTable>(data)) {
-        (void)size;
-    }
+namespace {
 
-    [[nodiscard]] size_t size() const override {
-        const auto *entries = modelRecTable_->mrt_entry();
-        return entries == nullptr ? 0 : entries->size();
+/// Computes the sizes of a tensor, std::nullopt when its shape, strides or format do not give them
+std::optional<TensorLayout> ComputeTensorLayout(FormatType format, DataView<int64_t> shape, DataView<int64_t> strides) {
+    TensorLayout layout;
+    layout.elementSize = blockSize(format);
+    if (layout.elementSize == 0 || (!strides.empty() && strides.size() != shape.size())) {
+        return std::nullopt;
     }
 
-    [[nodiscard]] std::optional<DescriptorType> getDescriptorType(uint32_t id) const override {
-        const auto *entry = getEntryAt(id);
-
-        auto decDescType = static_cast<EncodedDescriptorType>(entry->vk_descriptor_type());
-        if (decDescType == NullOptDescriptorType()) {
+    std::optional<uint64_t> elementCount = 1;
+    for (const int64_t dim : shape) {
+        if (dim < 0) {
+            return std::nullopt;
+        }
+        elementCount = elementCount.has_value() ? checkedMul(*elementCount, static_cast<uint64_t>(dim)) : std::nullopt;
+    }
+    const std::optional<uint64_t> packedByteSize =
+        elementCount.has_value() ? checkedMul(*elementCount, layout.elementSize) : std::nullopt;
+    if (!packedByteSize.has_value()) {
+        return std::nullopt;
+    }
+    layout.elementCount = *elementCount;
+    layout.packedByteSize = *packedByteSize;
+    layout.spanByteSize = *packedByteSize;
+    layout.contiguous = true;
+    if (strides.empty() || layout.elementCount == 0) {
+        return layout;
+    }
+
+    // Offset of the last element, comparing each stride with the packed row-major one on the way
+    std::optional<uint64_t> lastElementOffset = 0;
+    uint64_t packedStride = layout.elementSize;
+    // The shape comes from a FlatBuffers vector, so its rank fits the uint32_t index of DataView
+    for (auto i = static_cast<uint32_t>(shape.size()); i-- > 0;) {
+        if (strides[i] < 0) {
             return std::nullopt;
         }
-        return static_cast<DescriptorType>(decDescType);
+        const auto stride = static_cast<uint64_t>(strides[i]);
+        const auto dim = static_cast<uint64_t>(shape[i]);
+        layout.contiguous = layout.contiguous && (dim == 1 || stride == packedStride);
+        packedStride *= dim;
+        const std::optional<uint64_t> dimOffset = checkedMul(dim - 1, stride);
+        lastElementOffset = lastElementOffset.has_value() && dimOffset.has_value()
+                                ? checkedAdd(*lastElementOffset, *dimOffset)
+                                : std::nullopt;
+    }
+    const std::optional<uint64_t> spanByteSize =
+        lastElementOffset.has_value() ? checkedAdd(*lastElementOffset, layout.elementSize) : std::nullopt;
+    if (!spanByteSize.has_value()) {
+        return std::nullopt;
+    }
+    layout.spanByteSize = *spanByteSize;
+    return layout;
+}
+
+} // namespace
+
+class ModelResourceTableDecoderImpl final : public ModelResourceTableDecoder {
+  public:
+    static std::unique_ptr<ModelResourceTableDecoderImpl> Create(const void *const data, uint64_t size,
+                                                                 VerificationMode mode) {
+        if (!VerifyImpl<VGF::ModelResourceTable>(data, size, mode)) {
+            logging::error("Model resource table could not be decoded safely");
+            return nullptr;
+        }
+        return std::unique_ptr<ModelResourceTableDecoderImpl>(
+            new ModelResourceTableDecoderImpl(data, size, mode, true));
     }
 
-    [[nodiscard]] std::optional<AliasGroupId> getAliasGroupId(uint32_t id) const override {
-        const auto *entry = getEntryAt(id);
-        const AliasGroupId aliasGroupId = entry->alias_group_id();
-        if (aliasGroupId == INVALID_ALIAS_GROUP_ID) {
-            return std::nullopt;
+    /// Decoders created in place are not always destroyed, so they only own the layouts when their owner destroys them
+    static ModelResourceTableDecoderImpl *CreateInPlace(const void *const data, uint64_t size, void *decoderMem,
+                                                        VerificationMode mode, bool precomputeLayouts = false) {
+        if (!VerifyImpl<VGF::ModelResourceTable>(data, size, mode)) {
+            logging::error("Model resource table could not be decoded safely");
+            return nullptr;
         }
-        return aliasGroupId;
+        return new (decoderMem) ModelResourceTableDecoderImpl(data, size, mode, precomputeLayouts);
     }
 
-    [[nodiscard]] FormatType getVkFormat(uint32_t id) const override {
-        const auto *entry = getEntryAt(id);
-        return static_cast<FormatType>(entry->vk_format());
+    [[nodiscard]] size_t size() const override { return view_.size(); }
+
+    [[nodiscard]] std::optional<DescriptorType> getDescriptorType(uint32_t id) const override {
+        return getEntryAt(id).descriptorType();
     }
 
-    [[nodiscard]] ResourceCategory getCategory(uint32_t id) const override {
-        const auto *entry = getEntryAt(id);
-        return fromVGF(entry->category());
+    [[nodiscard]] std::optional<AliasGroupId> getAliasGroupId(uint32_t id) const override {
+        return getEntryAt(id).aliasGroupId();
     }
 
+    [[nodiscard]] FormatType getVkFormat(uint32_t id) const override { return getEntryAt(id).vkFormat(); }
+
+    [[nodiscard]] ResourceCategory getCategory(uint32_t id) const override { return getEntryAt(id).category(); }
+
     [[nodiscard]] DataView<int64_t> getTensorShape(uint32_t id) const override {
-        const auto *entry = getEntryAt(id);
-        const auto *description = entry->description();
-        if (description == nullptr) {
-            return {};
-        }
-        const auto *shape = description->shape();
-        if (shape == nullptr) {
-            return {};
-        }
-        return {shape->data(), shape->size()};
+        return getEntryAt(id).tensorShape();
     }
 
     [[nodiscard]] DataView<int64_t> getTensorStride(uint32_t id) const override {
-        const auto *entry = getEntryAt(id);
-        const auto *description = entry->description();
-        if (description == nullptr) {
-            return {};
-        }
-        const auto *strides = description->strides();
-        if (strides == nullptr) {
-            return {};
+        return getEntryAt(id).tensorStride();
+    }
+
+    [[nodiscard]] std::optional<TensorLayout> getTensorLayout(uint32_t id) const override {
+        if (id >= view_.size()) {
+            logging::error("Model resource table index " + std::to_string(id) + " is out of range");
+            return std::nullopt;
         }
-        return {strides->data(), strides->size()};
+        return layouts_ == nullptr ? computeTensorLayout(id) : layouts_[id];
     }
 
     [[nodiscard]] SamplerConfigHandle getSamplerConfigHandle(uint32_t id) const override {
-        return ToHandle(getSamplerConfigAt(id));
+        return ToHandle(getEntryAt(id).samplerConfig());
     }
 
     [[nodiscard]] uint32_t getSamplerConfigMinFilter(SamplerConfigHandle handle) const override {
         assert(handle != nullptr && "sampler config handle is null");
-        return FromHandle(handle)->min_filter();
+        return SamplerConfigView(handle).minFilter();
     }
 
     [[nodiscard]] uint32_t getSamplerConfigMagFilter(SamplerConfigHandle handle) const override {
         assert(handle != nullptr && "sampler config handle is null");
-        return FromHandle(handle)->mag_filter();
+        return SamplerConfigView(handle).magFilter();
     }
 
     [[nodiscard]] uint32_t getSamplerConfigAddressModeU(SamplerConfigHandle handle) const override {
         assert(handle != nullptr && "sampler config handle is null");
-        return FromHandle(handle)->address_mode_u();
+        return SamplerConfigView(handle).addressModeU();
     }
 
     [[nodiscard]] uint32_t getSamplerConfigAddressModeV(SamplerConfigHandle handle) const override {
         assert(handle != nullptr && "sampler config handle is null");
-        return FromHandle(handle)->address_mode_v();
+        return SamplerConfigView(handle).addressModeV();
     }
 
     [[nodiscard]] uint32_t getSamplerConfigBorderColor(SamplerConfigHandle handle) const override {
         assert(handle != nullptr && "sampler config handle is null");
-        return FromHandle(handle)->border_color();
+        return SamplerConfigView(handle).borderColor();
+    }
+
+    [[nodiscard]] ModelResourceEntryView getEntryAt(uint32_t index) const {
+        const auto *entryTable = modelRecTable_->mrt_entry();
+        assert(entryTable && "no entryTable found");
+        return ModelResourceEntryView(entries_.get(entryTable, index));
     }
 
   private:
-    [[nodiscard]] const VGF::SamplerConfig *getSamplerConfigAt(uint32_t index) const {
-        const auto *entry = getEntryAt(index);
-        if (entry->extra_config_type() != VGF::ExtraConfig_SamplerConfig) {
-            return nullptr;
+    explicit ModelResourceTableDecoderImpl(const void *const data, uint64_t size, VerificationMode mode,
+                                           bool precomputeLayouts)
+        : view_(data), modelRecTable_(flatbuffers::GetRoot<const VGF::ModelResourceTable>(data)),
+          entries_(data, size, modelRecTable_->mrt_entry(), mode) {
+        // Lazily verified entries are not read before their first access
+        if (precomputeLayouts && mode == VerificationMode::FULL) {
+            layouts_ = std::make_unique<std::optional<TensorLayout>[]>(view_.size());
+            for (uint32_t id = 0; id < view_.size(); ++id) {
+                layouts_[id] = computeTensorLayout(id);
+            }
         }
-        return entry->extra_config_as_SamplerConfig();
     }
 
-    [[nodiscard]] const VGF::ModelResourceTableEntry *getEntryAt(uint32_t index) const {
-        const auto *entryTable = modelRecTable_->mrt_entry();
-        assert(entryTable && "no entryTable found");
-        return entryTable->Get(index);
+    [[nodiscard]] std::optional<TensorLayout> computeTensorLayout(uint32_t id) const {
+        const ModelResourceEntryView entry = getEntryAt(id);
+        return ComputeTensorLayout(entry.vkFormat(), entry.tensorShape(), entry.tensorStride());
     }
+
+    ModelResourceView view_;
     const VGF::ModelResourceTable *modelRecTable_;
+    LazyEntries<VGF::ModelResourceTableEntry> entries_;
+    std::unique_ptr<std::optional<TensorLayout>[]> layouts_;
 };
 
 size_t ModelResourceTableDecoderSize() { return sizeof(ModelResourceTableDecoderImpl); }
 
-std::unique_ptr<ModelResourceTableDecoder> CreateModelResourceTableDecoder(const void *const data,
-                                                                           const uint64_t size) {
+ModelResourceEntryView GetModelResourceEntryView(const ModelResourceTableDecoder &decoder, uint32_t idx) {
+    return static_cast<const ModelResourceTableDecoderImpl &>(decoder).getEntryAt(idx);
+}
+
+std::unique_ptr<ModelResourceTableDecoder> CreateModelResourceTableDecoder(const void *const data, const uint64_t size,
+                                                                           VerificationMode mode) {
     assert(data != nullptr && "data is null");
-    if (!VerifyImpl<VGF::ModelResourceTable>(data, size)) {
-        logging::error("Model resource table could not be decoded safely");
-        return nullptr;
-    }
-    return std::make_unique<ModelResourceTableDecoderImpl>(data, size);
+    return ModelResourceTableDecoderImpl::Create(data, size, mode);
 }
 
 ModelResourceTableDecoder *CreateModelResourceTableDecoderInPlace(const void *const data, const uint64_t size,
                                                                   void *decoderMem) {
     assert(data != nullptr && "data is null");
     assert(decoderMem != nullptr && "decoderMem is null");
-    if (!VerifyImpl<VGF::ModelResourceTable>(data, size)) {
-        logging::error("Model resource table could not be decoded safely");
-        return nullptr;
-    }
-    return new (decoderMem) ModelResourceTableDecoderImpl(data, size);
+    return ModelResourceTableDecoderImpl::CreateInPlace(data, size, decoderMem, VerificationMode::FULL);
 }
 
-class ConstantDecoderImpl : public ConstantDecoder {
+class ConstantDecoderImpl final : public ConstantDecoder {
   public:
     explicit ConstantDecoderImpl(const void *const data)
-        : constantSection_(flatbuffers::GetRoot<const VGF::ConstantSection>(data)) {}
+        : section_(static_cast<const uint8_t *>(data)),
+          constantSection_(flatbuffers::GetRoot<const VGF::ConstantSection>(data)) {}
 
     [[nodiscard]] size_t size() const override {
         const auto *constants = constantSection_->data();
@@ -837,110 +1099,170 @@ class ConstantDecoderImpl : public ConstantDecoder {
         return dim;
     }
 
+    [[nodiscard]] uint64_t getConstantAlignment(uint32_t idx) const override {
+        // Legacy sections do not record an alignment
+        return static_cast<uint64_t>(idx) < size() ? 1 : 0;
+    }
+
+    [[nodiscard]] bool isConstantAligned(uint32_t idx, uint64_t sectionOffset, uint64_t alignment) const override {
+        if (static_cast<uint64_t>(idx) >= size() || alignment == 0) {
+            return false;
+        }
+        const DataView<uint8_t> constant = getConstant(idx);
+        if (constant.begin() == nullptr) {
+            return false;
+        }
+        const auto fileOffset = checkedAdd(sectionOffset, static_cast<uint64_t>(constant.begin() - section_));
+        return fileOffset.has_value() && *fileOffset % alignment == 0;
+    }
+
   private:
+    const uint8_t *section_;
     const VGF::ConstantSection *constantSection_;
 };
 
-class ConstantDecoderV00Impl : public ConstantDecoder {
+template <class MetaData> class ConstantDecoderRawImpl final : public ConstantDecoder {
   public:
-    static std::unique_ptr<ConstantDecoderV00Impl> Create(const void *const data, const uint64_t sectionSize) {
+    static std::unique_ptr<ConstantDecoderRawImpl> Create(const void *const data, const uint64_t sectionSize) {
         const auto verified = _verify(data, sectionSize);
         if (!verified.has_value()) {
             return nullptr;
         }
         const auto &[count, metaData, dataStart, dataSize] = *verified;
-        return std::unique_ptr<ConstantDecoderV00Impl>(
-            new ConstantDecoderV00Impl(count, metaData, dataStart, dataSize));
+        return std::unique_ptr<ConstantDecoderRawImpl>(
+            new ConstantDecoderRawImpl(data, count, metaData, dataStart));
     }
 
-    static ConstantDecoderV00Impl *CreateInPlace(const void *const data, const uint64_t sectionSize,
+    static ConstantDecoderRawImpl *CreateInPlace(const void *const data, const uint64_t sectionSize,
                                                  void *const decoderMem) {
         const auto verified = _verify(data, sectionSize);
         if (!verified.has_value()) {
             return nullptr;
         }
         const auto &[count, metaData, dataStart, dataSize] = *verified;
-        return new (decoderMem) ConstantDecoderV00Impl(count, metaData, dataStart, dataSize);
+        return new (decoderMem) ConstantDecoderRawImpl(data, count, metaData, dataStart);
     }
 
-    [[nodiscard]] size_t size() const override { return static_cast<size_t>(count_); }
+    [[nodiscard]] size_t size() const override { return view_.size(); }
 
     [[nodiscard]] DataView<uint8_t> getConstant(uint32_t idx) const override {
-        const auto *metaData = _getPtrToMetaData(idx);
-        if (metaData == nullptr) {
-            return {};
-        }
-
-        if (!_constantDataWithinBounds(metaData, dataSize_)) {
-            return {};
-        }
-
-        const ByteRange range = _constantDataRange(*metaData);
-        return DataView<uint8_t>(data_ + static_cast<size_t>(range.offset), static_cast<size_t>(range.size));
+        return inRange(idx) ? view_.data(idx) : DataView<uint8_t>();
     }
 
     [[nodiscard]] uint32_t getConstantMrtIndex(uint32_t idx) const override {
-        const auto *metaData = _getPtrToMetaData(idx);
-        return metaData == nullptr ? CONSTANT_INVALID_MRT_INDEX : metaData->mrtIndex;
+        return inRange(idx) ? view_.mrtIndex(idx) : CONSTANT_INVALID_MRT_INDEX;
     }
 
     [[nodiscard]] int64_t getConstantSparsityDimension(uint32_t idx) const override {
-        const auto *metaData = _getPtrToMetaData(idx);
-        if (metaData == nullptr) {
-            return CONSTANT_INVALID_SPARSITY_DIMENSION;
-        }
-        const auto dim = metaData->sparsityDimension;
-        if (dim < CONSTANT_NOT_SPARSE_DIMENSION) {
-            return CONSTANT_INVALID_SPARSITY_DIMENSION;
-        }
-        return dim;
+        return inRange(idx) ? view_.sparsityDimension(idx) : CONSTANT_INVALID_SPARSITY_DIMENSION;
     }
 
-    [[nodiscard]] bool isSparseConstant(uint32_t idx) const override {
-        return getConstantSparsityDimension(idx) > CONSTANT_NOT_SPARSE_DIMENSION;
+    [[nodiscard]] bool isSparseConstant(uint32_t idx) const override { return inRange(idx) && view_.isSparse(idx); }
+
+    [[nodiscard]] uint64_t getConstantAlignment(uint32_t idx) const override {
+        return inRange(idx) ? view_.alignment(idx) : 0;
     }
 
-  private:
-    explicit ConstantDecoderV00Impl(uint64_t count, const uint8_t *metaData, const uint8_t *data, uint64_t dataSize)
-        : count_(count), metaData_(metaData), data_(data), dataSize_(dataSize) {}
+    [[nodiscard]] bool isConstantAligned(uint32_t idx, uint64_t sectionOffset, uint64_t alignment) const override {
+        if (!inRange(idx) || alignment == 0) {
+            return false;
+        }
+        const auto fileOffset = checkedAdd(sectionOffset, payloadOffset_ + view_.dataOffset(idx));
+        return fileOffset.has_value() && *fileOffset % alignment == 0;
+    }
 
-    using VerifiedLayout = std::tuple<uint64_t, const uint8_t *, const uint8_t *, uint64_t>;
+    /// Returns a view over a verified section
+    [[nodiscard]] static ConstantView MakeView(uint64_t count, const uint8_t *metaData, const uint8_t *payload) {
+        return {metaData, sizeof(MetaData), count, payload, constantAlignment(MetaData{})};
+    }
 
-    [[nodiscard]] static std::optional<VerifiedLayout> _verify(const void *const data, const uint64_t sectionSize) {
-#if SIZE_MAX < UINT64_MAX
-        if (sectionSize > SIZE_MAX_VALUE) {
-            logging::error("VerifyConstant: Size out of bounds (" + std::to_string(sectionSize) +
-                           ", max=" + std::to_string(SIZE_MAX_VALUE) + ")");
+    /// Returns a view over the metadata records of a section whose payload was not read
+    [[nodiscard]] static std::optional<ConstantView> CreateMetaDataView(const void *const metaData,
+                                                                        const uint64_t sectionSize) {
+        const auto layout = _verifyMetaData(metaData, sectionSize);
+        if (!layout.has_value()) {
             return std::nullopt;
         }
-#endif
+        return ConstantView(static_cast<const uint8_t *>(metaData) + static_cast<size_t>(layout->records.offset),
+                            sizeof(MetaData), layout->records.size / sizeof(MetaData), nullptr,
+                            constantAlignment(MetaData{}));
+    }
+
+    [[nodiscard]] static std::optional<ConstantView> CreateView(const void *const data, const uint64_t sectionSize) {
+        const auto verified = _verify(data, sectionSize);
+        if (!verified.has_value()) {
+            return std::nullopt;
+        }
+        const auto &[count, metaData, dataStart, dataSize] = *verified;
+        return MakeView(count, metaData, dataStart);
+    }
+
+  private:
+    explicit ConstantDecoderRawImpl(const void *section, uint64_t count, const uint8_t *metaData, const uint8_t *data)
+        : view_(MakeView(count, metaData, data)),
+          payloadOffset_(static_cast<uint64_t>(data - static_cast<const uint8_t *>(section))) {}
+
+    [[nodiscard]] bool inRange(uint32_t idx) const { return static_cast<uint64_t>(idx) < view_.size(); }
+
+    using VerifiedLayout = std::tuple<uint64_t, const uint8_t *, const uint8_t *, uint64_t>;
+
+    [[nodiscard]] static std::optional<VerifiedLayout> _verify(const void *const data, const uint64_t sectionSize) {
+#if SIZE_MAX < UINT64_MAX
+        if (sectionSize > SIZE_MAX_VALUE) {
+            logging::error("VerifyConstant: Size out of bounds (" + std::to_string(sectionSize) +
+                           ", max=" + std::to_string(SIZE_MAX_VALUE) + ")");
+            return std::nullopt;
+        }
+#endif
+
+        const auto layout = _verifyMetaData(data, sectionSize);
+        if (!layout.has_value()) {
+            return std::nullopt;
+        }
+        const auto *metaData = static_cast<const uint8_t *>(data) + static_cast<size_t>(layout->records.offset);
+        const auto *dataStart = static_cast<const uint8_t *>(data) + static_cast<size_t>(layout->payload.offset);
+        return VerifiedLayout{layout->records.size / sizeof(MetaData), metaData, dataStart, layout->payload.size};
+    }
 
+    /// Checks the metadata records of a section of sectionSize bytes, reading only the bytes before its payload
+    [[nodiscard]] static std::optional<FixedRecordTableLayout> _verifyMetaData(const void *const data,
+                                                                               const uint64_t sectionSize) {
         if (sectionSize < CONSTANT_SECTION_METADATA_OFFSET) {
             logging::error("VerifyConstant: Constant section too small to contain metadata");
             return std::nullopt;
         }
 
         const auto declaredCount = ReadBytesAs<uint64_t>(data, CONSTANT_SECTION_COUNT_OFFSET);
-        const uint64_t maxEntries = (sectionSize - CONSTANT_SECTION_METADATA_OFFSET) / sizeof(ConstantMetaDataV00);
+        const uint64_t maxEntries = (sectionSize - CONSTANT_SECTION_METADATA_OFFSET) / sizeof(MetaData);
         if (declaredCount > maxEntries) {
             logging::error("VerifyConstant: Constant section declares more entries than fit in the buffer");
             return std::nullopt;
         }
 
         const auto layout = splitFixedRecordTable(sectionSize, CONSTANT_SECTION_METADATA_OFFSET,
-                                                  sizeof(ConstantMetaDataV00), declaredCount);
+                                                  sizeof(MetaData), declaredCount);
         if (!layout.has_value()) {
             logging::error("VerifyConstant: Constant data offset exceeds addressable size");
             return std::nullopt;
         }
 
         const auto *metaData = static_cast<const uint8_t *>(data) + static_cast<size_t>(layout->records.offset);
-        const auto *dataStart = static_cast<const uint8_t *>(data) + static_cast<size_t>(layout->payload.offset);
         const uint64_t dataSize = layout->payload.size;
 
+        // The checks below read the metadata records only, so the payload is left out of the digest
+        constexpr auto kind = std::is_same_v<MetaData, ConstantMetaDataV00> ? VerifiedSection::CONSTANT_METADATA_V00
+                                                                            : VerifiedSection::CONSTANT_METADATA_V01;
+        const auto digest =
+            digestForVerificationCache(kind, data, sectionSize, layout->records.offset + layout->records.size);
+        if (digest.has_value() && isVerificationCached(*digest)) {
+            return layout;
+        }
+
+        // Entries are checked independently: several entries may share or overlap payload ranges, as the encoder
+        // stores identical constants once.
         for (uint64_t idx = 0; idx < declaredCount; ++idx) {
             const auto *entry =
-                reinterpret_cast<const ConstantMetaDataV00 *>(metaData + idx * sizeof(ConstantMetaDataV00));
+                reinterpret_cast<const MetaData *>(metaData + idx * sizeof(MetaData));
             if (!_constantDataWithinBounds(entry, dataSize)) {
                 logging::error("VerifyConstant: Constant metadata offset/size exceeds section bounds at index " +
                                std::to_string(idx));
@@ -951,23 +1273,24 @@ class ConstantDecoderV00Impl : public ConstantDecoder {
                                std::to_string(idx));
                 return std::nullopt;
             }
+            const uint64_t alignment = constantAlignment(*entry);
+            if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+                logging::error("VerifyConstant: Constant alignment is invalid at index " + std::to_string(idx));
+                return std::nullopt;
+            }
         }
 
-        return VerifiedLayout{declaredCount, metaData, dataStart, dataSize};
-    }
-
-    [[nodiscard]] const ConstantMetaDataV00 *_getPtrToMetaData(uint32_t idx) const {
-        if (metaData_ == nullptr || static_cast<uint64_t>(idx) >= count_) {
-            return nullptr;
+        if (digest.has_value()) {
+            recordVerification(*digest);
         }
-        return reinterpret_cast<const ConstantMetaDataV00 *>(metaData_ + idx * sizeof(ConstantMetaDataV00));
+        return layout;
     }
 
-    [[nodiscard]] static ByteRange _constantDataRange(const ConstantMetaDataV00 &metaData) {
+    [[nodiscard]] static ByteRange _constantDataRange(const MetaData &metaData) {
         return {metaData.offset, metaData.size};
     }
 
-    [[nodiscard]] static bool _constantDataWithinBounds(const ConstantMetaDataV00 *metaData, uint64_t dataSize) {
+    [[nodiscard]] static bool _constantDataWithinBounds(const MetaData *metaData, uint64_t dataSize) {
         if (metaData == nullptr) {
             return false;
         }
@@ -975,12 +1298,16 @@ class ConstantDecoderV00Impl : public ConstantDecoder {
         return byteRangeCanBeAddressed(range) && byteRangeWithinBounds(range, dataSize);
     }
 
-    uint64_t count_ = 0;
-    const uint8_t *metaData_ = nullptr;
-    const uint8_t *data_ = nullptr;
-    uint64_t dataSize_ = 0;
+    ConstantView view_;
+    uint64_t payloadOffset_ = 0;
 };
-size_t ConstantDecoderSize() { return std::max(sizeof(ConstantDecoderImpl), sizeof(ConstantDecoderV00Impl)); }
+
+using ConstantDecoderV00Impl = ConstantDecoderRawImpl<ConstantMetaDataV00>;
+using ConstantDecoderV01Impl = ConstantDecoderRawImpl<ConstantMetaDataV01>;
+
+size_t ConstantDecoderSize() {
+    return std::max({sizeof(ConstantDecoderImpl), sizeof(ConstantDecoderV00Impl), sizeof(ConstantDecoderV01Impl)});
+}
 
 std::unique_ptr<ConstantDecoder> CreateConstantDecoder(const void *const data, const uint64_t size) {
     assert(data != nullptr && "data is null");
@@ -989,13 +1316,20 @@ std::unique_ptr<ConstantDecoder> CreateConstantDecoder(const void *const data, c
         return nullptr;
     }
     std::unique_ptr<ConstantDecoder> decoder;
-    if (hasConstantSectionVersion(data)) {
+    if (hasConstantSectionVersion(data, CONSTANT_SECTION_VERSION)) {
         // V00 constant section
         decoder = ConstantDecoderV00Impl::Create(data, size);
         if (decoder == nullptr) {
             logging::error("Constant section verification failed");
             return nullptr;
         }
+    } else if (hasConstantSectionVersion(data, CONSTANT_SECTION_VERSION_V01)) {
+        // V01 constant section
+        decoder = ConstantDecoderV01Impl::Create(data, size);
+        if (decoder == nullptr) {
+            logging::error("Constant section verification failed");
+            return nullptr;
+        }
     } else {
         // Legacy FlatBuffer constant section
         if (!VerifyImpl<VGF::ConstantSection>(data, size)) {
@@ -1021,7 +1355,7 @@ ConstantDecoder *CreateConstantDecoderInPlace(const void *const data, const uint
         logging::error("Constant section too small to contain version");
         return nullptr;
     }
-    if (hasConstantSectionVersion(data)) {
+    if (hasConstantSectionVersion(data, CONSTANT_SECTION_VERSION)) {
         // V00 constant section
         auto *decoder = ConstantDecoderV00Impl::CreateInPlace(data, size, decoderMem);
         if (decoder == nullptr) {
@@ -1030,6 +1364,15 @@ ConstantDecoder *CreateConstantDecoderInPlace(const void *const data, const uint
         }
         return decoder;
     }
+    if (hasConstantSectionVersion(data, CONSTANT_SECTION_VERSION_V01)) {
+        // V01 constant section
+        auto *decoder = ConstantDecoderV01Impl::CreateInPlace(data, size, decoderMem);
+        if (decoder == nullptr) {
+            logging::error("Constant section verification failed");
+            return nullptr;
+        }
+        return decoder;
+    }
 
     // Legacy FlatBuffer constant section
     if (!VerifyImpl<VGF::ConstantSection>(data, size)) {
@@ -1047,4 +1390,812 @@ ConstantDecoder *CreateConstantDecoderInPlace(const void *const data, const uint
     return decoder;
 }
 
+bool ForEachConstantChunk(const ConstantDecoder &constants, uint32_t idx, uint64_t chunkSize,
+                          const ConstantChunkCallback &callback) {
+    if (static_cast<size_t>(idx) >= constants.size()) {
+        logging::error("Constant index " + std::to_string(idx) + " out of range");
+        return false;
+    }
+    if (chunkSize == 0) {
+        logging::error("Constant chunk size is 0");
+        return false;
+    }
+    const DataView<uint8_t> constant = constants.getConstant(idx);
+    for (size_t offset = 0; offset < constant.size();) {
+        const auto size = static_cast<size_t>(std::min<uint64_t>(chunkSize, constant.size() - offset));
+        if (!callback(offset, DataView<uint8_t>(constant.begin() + offset, size))) {
+            return false;
+        }
+        offset += size;
+    }
+    return true;
+}
+
+// Decoder views
+std::optional<ModuleTableView> CreateModuleTableView(const void *const data, const uint64_t size) {
+    assert(data != nullptr && "data is null");
+    if (!VerifyImpl<VGF::ModuleTable>(data, size, VerificationMode::FULL)) {
+        logging::error("Module table could not be decoded safely");
+        return std::nullopt;
+    }
+    return ModuleTableView(data);
+}
+
+std::optional<ModelSequenceView> CreateModelSequenceView(const void *const data, const uint64_t size) {
+    assert(data != nullptr && "data is null");
+    if (!VerifyImpl<VGF::ModelSequenceTable>(data, size, VerificationMode::FULL)) {
+        logging::error("Model sequence table could not be decoded safely");
+        return std::nullopt;
+    }
+    return ModelSequenceView(data);
+}
+
+std::optional<ModelResourceView> CreateModelResourceView(const void *const data, const uint64_t size) {
+    assert(data != nullptr && "data is null");
+    if (!VerifyImpl<VGF::ModelResourceTable>(data, size, VerificationMode::FULL)) {
+        logging::error("Model resource table could not be decoded safely");
+        return std::nullopt;
+    }
+    return ModelResourceView(data);
+}
+
+std::optional<ConstantView> CreateConstantView(const void *const data, const uint64_t size) {
+    assert(data != nullptr && "data is null");
+    if (size < CONSTANT_SECTION_VERSION_SIZE) {
+        logging::error("Constant section too small to contain version");
+        return std::nullopt;
+    }
+    std::optional<ConstantView> view;
+    if (hasConstantSectionVersion(data, CONSTANT_SECTION_VERSION)) {
+        view = ConstantDecoderV00Impl::CreateView(data, size);
+    } else if (hasConstantSectionVersion(data, CONSTANT_SECTION_VERSION_V01)) {
+        view = ConstantDecoderV01Impl::CreateView(data, size);
+    } else {
+        logging::error("Legacy constant sections are not supported by ConstantView");
+        return std::nullopt;
+    }
+    if (!view.has_value()) {
+        logging::error("Constant section verification failed");
+    }
+    return view;
+}
+
+std::optional<uint64_t> GetConstantMetaDataSize(const void *const prefix, const uint64_t sectionSize) {
+    assert(prefix != nullptr && "prefix is null");
+    if (sectionSize < CONSTANT_SECTION_METADATA_OFFSET) {
+        logging::error("Constant section too small to contain metadata");
+        return std::nullopt;
+    }
+    size_t recordSize = 0;
+    if (hasConstantSectionVersion(prefix, CONSTANT_SECTION_VERSION)) {
+        recordSize = sizeof(ConstantMetaDataV00);
+    } else if (hasConstantSectionVersion(prefix, CONSTANT_SECTION_VERSION_V01)) {
+        recordSize = sizeof(ConstantMetaDataV01);
+    } else {
+        logging::error("Legacy constant sections cannot be read without their payload");
+        return std::nullopt;
+    }
+    const auto layout = splitFixedRecordTable(sectionSize, CONSTANT_SECTION_METADATA_OFFSET, recordSize,
+                                              ReadBytesAs<uint64_t>(prefix, CONSTANT_SECTION_COUNT_OFFSET));
+    if (!layout.has_value()) {
+        logging::error("Constant section declares more entries than fit in the section");
+        return std::nullopt;
+    }
+    return layout->payload.offset;
+}
+
+std::optional<ConstantView> CreateConstantMetaDataView(const void *const metaData, const uint64_t sectionSize) {
+    assert(metaData != nullptr && "metaData is null");
+    std::optional<ConstantView> view;
+    if (hasConstantSectionVersion(metaData, CONSTANT_SECTION_VERSION)) {
+        view = ConstantDecoderV00Impl::CreateMetaDataView(metaData, sectionSize);
+    } else if (hasConstantSectionVersion(metaData, CONSTANT_SECTION_VERSION_V01)) {
+        view = ConstantDecoderV01Impl::CreateMetaDataView(metaData, sectionSize);
+    }
+    if (!view.has_value()) {
+        logging::error("Constant section verification failed");
+    }
+    return view;
+}
+
+// Name Index
+class NameIndexImpl final : public NameIndex {
+  public:
+    static size_t Size(const ModuleTableDecoder &moduleTable, const ModelSequenceTableDecoder &modelSequenceTable) {
+        size_t numSlots = 0;
+        for (size_t count : Counts(moduleTable, modelSequenceTable)) {
+            numSlots += Capacity(count);
+        }
+        return sizeof(NameIndexImpl) + numSlots * sizeof(Slot);
+    }
+
+    static std::unique_ptr<NameIndexImpl> Create(const ModuleTableDecoder &moduleTable,
+                                                 const ModelSequenceTableDecoder &modelSequenceTable) {
+        auto index = std::unique_ptr<NameIndexImpl>(new NameIndexImpl(moduleTable, modelSequenceTable));
+        index->storage_.resize((Size(moduleTable, modelSequenceTable) - sizeof(NameIndexImpl)) / sizeof(Slot));
+        index->_build(index->storage_.data());
+        return index;
+    }
+
+    static NameIndexImpl *CreateInPlace(const ModuleTableDecoder &moduleTable,
+                                        const ModelSequenceTableDecoder &modelSequenceTable, void *indexMem) {
+        auto *index = new (indexMem) NameIndexImpl(moduleTable, modelSequenceTable);
+        // The slots follow the index in the caller's memory
+        index->_build(reinterpret_cast<Slot *>(static_cast<unsigned char *>(indexMem) + sizeof(NameIndexImpl)));
+        return index;
+    }
+
+    [[nodiscard]] std::optional<uint32_t> findInputByName(std::string_view name) const override {
+        return _find(INPUTS, name);
+    }
+
+    [[nodiscard]] std::optional<uint32_t> findOutputByName(std::string_view name) const override {
+        return _find(OUTPUTS, name);
+    }
+
+    [[nodiscard]] std::optional<uint32_t> findModuleByName(std::string_view name) const override {
+        return _find(MODULES, name);
+    }
+
+    [[nodiscard]] std::optional<uint32_t> findSegmentByName(std::string_view name) const override {
+        return _find(SEGMENTS, name);
+    }
+
+  private:
+    enum Kind : size_t { INPUTS, OUTPUTS, MODULES, SEGMENTS, NUM_KINDS };
+
+    // Open addressing with linear probing. The low bits of the hash select the first slot to probe
+    struct Slot {
+        uint32_t hash;
+        uint32_t entry; // index of the name plus one, 0 for an empty slot
+    };
+
+    struct Table {
+        Slot *slots = nullptr;
+        uint32_t mask = 0;
+    };
+
+    NameIndexImpl(const ModuleTableDecoder &moduleTable, const ModelSequenceTableDecoder &modelSequenceTable)
+        : moduleTable_(moduleTable), modelSequenceTable_(modelSequenceTable),
+          inputNames_(modelSequenceTable.getModelSequenceInputNamesHandle()),
+          outputNames_(modelSequenceTable.getModelSequenceOutputNamesHandle()) {}
+
+    static std::array<size_t, NUM_KINDS> Counts(const ModuleTableDecoder &moduleTable,
+                                                const ModelSequenceTableDecoder &modelSequenceTable) {
+        std::array<size_t, NUM_KINDS> counts{};
+        counts[INPUTS] = modelSequenceTable.getNamesSize(modelSequenceTable.getModelSequenceInputNamesHandle());
+        counts[OUTPUTS] = modelSequenceTable.getNamesSize(modelSequenceTable.getModelSequenceOutputNamesHandle());
+        counts[MODULES] = moduleTable.size();
+        counts[SEGMENTS] = modelSequenceTable.modelSequenceTableSize();
+        return counts;
+    }
+
+    // Keep the load factor at or below one half so that probe sequences stay short
+    static size_t Capacity(size_t count) {
+        size_t capacity = 0;
+        if (count > 0) {
+            capacity = 2;
+            while (capacity < 2 * count) {
+                capacity *= 2;
+            }
+        }
+        return capacity;
+    }
+
+    static uint32_t Hash(std::string_view name) { return static_cast<uint32_t>(hashBytes(name.data(), name.size())); }
+
+    [[nodiscard]] std::string_view _nameAt(Kind kind, uint32_t idx) const {
+        switch (kind) {
+        case INPUTS:
+            return modelSequenceTable_.getName(inputNames_, idx);
+        case OUTPUTS:
+            return modelSequenceTable_.getName(outputNames_, idx);
+        case MODULES:
+            return moduleTable_.getModuleName(idx);
+        case SEGMENTS:
+        default:
+            return modelSequenceTable_.getSegmentName(idx);
+        }
+    }
+
+    void _build(Slot *slots) {
+        const std::array<size_t, NUM_KINDS> counts = Counts(moduleTable_, modelSequenceTable_);
+        for (size_t kind = 0; kind < NUM_KINDS; ++kind) {
+            const size_t capacity = Capacity(counts[kind]);
+            if (capacity == 0) {
+                continue;
+            }
+            std::fill_n(slots, capacity, Slot{0, 0});
+            Table &table = tables_[kind];
+            table.slots = slots;
+            table.mask = static_cast<uint32_t>(capacity - 1);
+            slots += capacity;
+            for (uint32_t idx = 0; idx < counts[kind]; ++idx) {
+                _insert(static_cast<Kind>(kind), idx);
+            }
+        }
+    }
+
+    void _insert(Kind kind, uint32_t idx) {
+        const Table &table = tables_[kind];
+        const std::string_view name = _nameAt(kind, idx);
+        const uint32_t hash = Hash(name);
+        for (uint32_t pos = hash & table.mask;; pos = (pos + 1) & table.mask) {
+            Slot &slot = table.slots[pos];
+            if (slot.entry == 0) {
+                slot = Slot{hash, idx + 1};
+                return;
+            }
+            // Lookups return the first of duplicated names, as a linear scan would
+            if (slot.hash == hash && _nameAt(kind, slot.entry - 1) == name) {
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] std::optional<uint32_t> _find(Kind kind, std::string_view name) const {
+        const Table &table = tables_[kind];
+        if (table.slots == nullptr) {
+            return std::nullopt;
+        }
+        const uint32_t hash = Hash(name);
+        for (uint32_t pos = hash & table.mask;; pos = (pos + 1) & table.mask) {
+            const Slot &slot = table.slots[pos];
+            if (slot.entry == 0) {
+                return std::nullopt;
+            }
+            if (slot.hash == hash && _nameAt(kind, slot.entry - 1) == name) {
+                return slot.entry - 1;
+            }
+        }
+    }
+
+    const ModuleTableDecoder &moduleTable_;
+    const ModelSequenceTableDecoder &modelSequenceTable_;
+    NameArrayHandle inputNames_;
+    NameArrayHandle outputNames_;
+    std::array<Table, NUM_KINDS> tables_{};
+    std::vector<Slot> storage_;
+};
+
+size_t NameIndexSize(const ModuleTableDecoder &moduleTable, const ModelSequenceTableDecoder &modelSequenceTable) {
+    return NameIndexImpl::Size(moduleTable, modelSequenceTable);
+}
+
+std::unique_ptr<NameIndex> CreateNameIndex(const ModuleTableDecoder &moduleTable,
+                                           const ModelSequenceTableDecoder &modelSequenceTable) {
+    return NameIndexImpl::Create(moduleTable, modelSequenceTable);
+}
+
+NameIndex *CreateNameIndexInPlace(const ModuleTableDecoder &moduleTable,
+                                  const ModelSequenceTableDecoder &modelSequenceTable, void *indexMem) {
+    assert(indexMem != nullptr && "indexMem is null");
+    return NameIndexImpl::CreateInPlace(moduleTable, modelSequenceTable, indexMem);
+}
+
+// Resource Index
+namespace {
+
+/// Rows of values stored contiguously, the values of row i being values[offsets[i], offsets[i + 1])
+class CompressedRows {
+  public:
+    using Pair = std::pair<uint32_t /* row */, uint32_t /* value */>;
+
+    CompressedRows() = default;
+
+    /// Group the pairs by row with a counting sort, keeping the order of the values within each row
+    CompressedRows(size_t numRows, const std::vector<Pair> &pairs) : offsets_(numRows + 1, 0) {
+        for (const auto &[row, value] : pairs) {
+            ++offsets_[row + 1];
+        }
+        std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+        values_.resize(offsets_.back());
+        std::vector<uint32_t> cursors(offsets_.begin(), offsets_.end() - 1);
+        for (const auto &[row, value] : pairs) {
+            values_[cursors[row]++] = value;
+        }
+    }
+
+    /// Remove the repeated values of each row, whose values must be sorted
+    void removeDuplicates() {
+        uint32_t size = 0;
+        for (size_t rowIdx = 0; rowIdx + 1 < offsets_.size(); ++rowIdx) {
+            const uint32_t begin = offsets_[rowIdx];
+            const uint32_t end = offsets_[rowIdx + 1];
+            offsets_[rowIdx] = size;
+            for (uint32_t i = begin; i < end; ++i) {
+                if (size == offsets_[rowIdx] || values_[size - 1] != values_[i]) {
+                    values_[size++] = values_[i];
+                }
+            }
+        }
+        offsets_.back() = size;
+        values_.resize(size);
+    }
+
+    [[nodiscard]] DataView<uint32_t> row(size_t rowIdx) const {
+        if (rowIdx + 1 >= offsets_.size()) {
+            return {};
+        }
+        return {values_.data() + offsets_[rowIdx], offsets_[rowIdx + 1] - offsets_[rowIdx]};
+    }
+
+  private:
+    std::vector<uint32_t> offsets_;
+    std::vector<uint32_t> values_;
+};
+
+/// Record that segmentIdx refers to each entry of the binding slots, ignoring indexes past the table
+void AddSegmentPairs(const ModelSequenceTableDecoder &decoder, BindingSlotArrayHandle handle, uint32_t segmentIdx,
+                     size_t numEntries, std::vector<CompressedRows::Pair> &pairs) {
+    for (uint32_t slotIdx = 0; slotIdx < decoder.getBindingsSize(handle); ++slotIdx) {
+        const uint32_t mrtIdx = decoder.getBindingSlotMrtIndex(handle, slotIdx);
+        if (mrtIdx < numEntries) {
+            pairs.emplace_back(mrtIdx, segmentIdx);
+        }
+    }
+}
+
+} // namespace
+
+class ResourceIndexImpl final : public ResourceIndex {
+  public:
+    ResourceIndexImpl(const ModelSequenceTableDecoder &modelSequenceTable,
+                      const ModelResourceTableDecoder &modelResourceTable, const ConstantDecoder &constants) {
+        const size_t numEntries = modelResourceTable.size();
+
+        std::vector<CompressedRows::Pair> constantPairs;
+        for (uint32_t constantIdx = 0; constantIdx < constants.size(); ++constantIdx) {
+            const uint32_t mrtIdx = constants.getConstantMrtIndex(constantIdx);
+            if (mrtIdx < numEntries) {
+                constantPairs.emplace_back(mrtIdx, constantIdx);
+            }
+        }
+        constants_ = CompressedRows(numEntries, constantPairs);
+
+        std::vector<CompressedRows::Pair> producerPairs;
+        std::vector<CompressedRows::Pair> consumerPairs;
+        std::vector<CompressedRows::Pair> bindingPairs;
+        for (uint32_t segmentIdx = 0; segmentIdx < modelSequenceTable.modelSequenceTableSize(); ++segmentIdx) {
+            AddSegmentPairs(modelSequenceTable, modelSequenceTable.getSegmentOutputBindingSlotsHandle(segmentIdx),
+                            segmentIdx, numEntries, producerPairs);
+            AddSegmentPairs(modelSequenceTable, modelSequenceTable.getSegmentInputBindingSlotsHandle(segmentIdx),
+                            segmentIdx, numEntries, consumerPairs);
+            for (uint32_t descIdx = 0; descIdx < modelSequenceTable.getSegmentDescriptorSetInfosSize(segmentIdx);
+                 ++descIdx) {
+                AddSegmentPairs(modelSequenceTable,
+                                modelSequenceTable.getDescriptorBindingSlotsHandle(segmentIdx, descIdx), segmentIdx,
+                                numEntries, bindingPairs);
+            }
+        }
+        // Segments are visited in order, so a segment referring to an entry several times repeats itself in a row
+        producers_ = CompressedRows(numEntries, producerPairs);
+        producers_.removeDuplicates();
+        consumers_ = CompressedRows(numEntries, consumerPairs);
+        consumers_.removeDuplicates();
+        bindings_ = CompressedRows(numEntries, bindingPairs);
+        bindings_.removeDuplicates();
+
+        std::vector<CompressedRows::Pair> aliasPairs;
+        for (uint32_t mrtIdx = 0; mrtIdx < numEntries; ++mrtIdx) {
+            if (const std::optional<AliasGroupId> aliasGroupId = modelResourceTable.getAliasGroupId(mrtIdx)) {
+                aliasPairs.emplace_back(*aliasGroupId, mrtIdx);
+            }
+        }
+        // Number the distinct ids, so that the members of each group form a row filled in the order of the entries
+        aliasGroupIds_.reserve(aliasPairs.size());
+        for (const auto &[aliasGroupId, mrtIdx] : aliasPairs) {
+            aliasGroupIds_.push_back(aliasGroupId);
+        }
+        std::sort(aliasGroupIds_.begin(), aliasGroupIds_.end());
+        aliasGroupIds_.erase(std::unique(aliasGroupIds_.begin(), aliasGroupIds_.end()), aliasGroupIds_.end());
+        for (auto &[aliasGroupId, mrtIdx] : aliasPairs) {
+            aliasGroupId = aliasGroupRow(aliasGroupId);
+        }
+        aliasGroups_ = CompressedRows(aliasGroupIds_.size(), aliasPairs);
+    }
+
+    [[nodiscard]] DataView<uint32_t> getConstants(uint32_t mrtIdx) const override { return constants_.row(mrtIdx); }
+
+    [[nodiscard]] DataView<uint32_t> getProducerSegments(uint32_t mrtIdx) const override {
+        return producers_.row(mrtIdx);
+    }
+
+    [[nodiscard]] DataView<uint32_t> getConsumerSegments(uint32_t mrtIdx) const override {
+        return consumers_.row(mrtIdx);
+    }
+
+    [[nodiscard]] DataView<uint32_t> getBindingSegments(uint32_t mrtIdx) const override {
+        return bindings_.row(mrtIdx);
+    }
+
+    [[nodiscard]] DataView<AliasGroupId> getAliasGroupIds() const override {
+        return {aliasGroupIds_.data(), aliasGroupIds_.size()};
+    }
+
+    [[nodiscard]] DataView<uint32_t> getAliasGroupMembers(AliasGroupId aliasGroupId) const override {
+        // An unused id maps past the rows or to the row of another id
+        const uint32_t row = aliasGroupRow(aliasGroupId);
+        if (row == aliasGroupIds_.size() || aliasGroupIds_[row] != aliasGroupId) {
+            return {};
+        }
+        return aliasGroups_.row(row);
+    }
+
+  private:
+    /// Row of the first used alias group id not less than aliasGroupId
+    [[nodiscard]] uint32_t aliasGroupRow(AliasGroupId aliasGroupId) const {
+        const auto it = std::lower_bound(aliasGroupIds_.begin(), aliasGroupIds_.end(), aliasGroupId);
+        return static_cast<uint32_t>(it - aliasGroupIds_.begin());
+    }
+
+    CompressedRows constants_;
+    CompressedRows producers_;
+    CompressedRows consumers_;
+    CompressedRows bindings_;
+    std::vector<AliasGroupId> aliasGroupIds_;
+    CompressedRows aliasGroups_;
+};
+
+std::unique_ptr<ResourceIndex> CreateResourceIndex(const ModelSequenceTableDecoder &modelSequenceTable,
+                                                   const ModelResourceTableDecoder &modelResourceTable,
+                                                   const ConstantDecoder &constants) {
+    return std::make_unique<ResourceIndexImpl>(modelSequenceTable, modelResourceTable, constants);
+}
+
+// Segment Graph
+namespace {
+
+constexpr uint32_t NO_SEGMENT = std::numeric_limits<uint32_t>::max();
+
+/// Binding slot of a segment, by the list it appears in
+struct SegmentBinding {
+    enum class Kind : uint8_t { INPUT, OUTPUT, DESCRIPTOR };
+
+    uint32_t mrtIdx;
+    Kind kind;
+};
+
+void AddSegmentBindings(const ModelSequenceTableDecoder &decoder, BindingSlotArrayHandle handle,
+                        SegmentBinding::Kind kind, std::vector<SegmentBinding> &bindings) {
+    for (uint32_t slotIdx = 0; slotIdx < decoder.getBindingsSize(handle); ++slotIdx) {
+        bindings.push_back({decoder.getBindingSlotMrtIndex(handle, slotIdx), kind});
+    }
+}
+
+/// Access of a segment to a resource, a write also covering reads
+struct SegmentAccess {
+    uint32_t mrtIdx;
+    bool write;
+};
+
+/// Merge the bindings of a segment into one access per resource
+void MergeSegmentBindings(std::vector<SegmentBinding> &bindings, std::vector<SegmentAccess> &accesses) {
+    std::sort(bindings.begin(), bindings.end(),
+              [](const SegmentBinding &lhs, const SegmentBinding &rhs) { return lhs.mrtIdx < rhs.mrtIdx; });
+    accesses.clear();
+    for (auto it = bindings.begin(); it != bindings.end();) {
+        bool input = false;
+        bool output = false;
+        bool descriptor = false;
+        const uint32_t mrtIdx = it->mrtIdx;
+        for (; it != bindings.end() && it->mrtIdx == mrtIdx; ++it) {
+            input |= it->kind == SegmentBinding::Kind::INPUT;
+            output |= it->kind == SegmentBinding::Kind::OUTPUT;
+            descriptor |= it->kind == SegmentBinding::Kind::DESCRIPTOR;
+        }
+        accesses.push_back({mrtIdx, output || (descriptor && !input)});
+    }
+}
+
+/// Last writer of a resource and the last of the reads recorded since that write
+struct ResourceState {
+    uint32_t lastWriter = NO_SEGMENT;
+    uint32_t lastRead = NO_SEGMENT;
+};
+
+} // namespace
+
+class SegmentGraphImpl final : public SegmentGraph {
+  public:
+    explicit SegmentGraphImpl(const ModelSequenceTableDecoder &decoder)
+        : numSegments_(static_cast<uint32_t>(decoder.modelSequenceTableSize())), levels_(numSegments_, 0) {
+        std::unordered_map<uint32_t, ResourceState> resources;
+        // Reads of the resources, each linked to the previous read of the same resource since its last write
+        std::vector<uint32_t> readSegments;
+        std::vector<uint32_t> readLinks;
+        std::vector<uint32_t> markers(numSegments_, NO_SEGMENT);
+        std::vector<uint32_t> criticalPredecessors(numSegments_, NO_SEGMENT);
+        std::vector<CompressedRows::Pair> predecessorPairs;
+        std::vector<CompressedRows::Pair> successorPairs;
+        std::vector<SegmentBinding> bindings;
+        std::vector<SegmentAccess> accesses;
+        std::vector<uint32_t> predecessors;
+
+        for (uint32_t segmentIdx = 0; segmentIdx < numSegments_; ++segmentIdx) {
+            bindings.clear();
+            AddSegmentBindings(decoder, decoder.getSegmentInputBindingSlotsHandle(segmentIdx),
+                               SegmentBinding::Kind::INPUT, bindings);
+            AddSegmentBindings(decoder, decoder.getSegmentOutputBindingSlotsHandle(segmentIdx),
+                               SegmentBinding::Kind::OUTPUT, bindings);
+            for (uint32_t descIdx = 0; descIdx < decoder.getSegmentDescriptorSetInfosSize(segmentIdx); ++descIdx) {
+                AddSegmentBindings(decoder, decoder.getDescriptorBindingSlotsHandle(segmentIdx, descIdx),
+                                   SegmentBinding::Kind::DESCRIPTOR, bindings);
+            }
+            MergeSegmentBindings(bindings, accesses);
+
+            predecessors.clear();
+            const auto addPredecessor = [&](uint32_t predecessorIdx) {
+                if (predecessorIdx != NO_SEGMENT && markers[predecessorIdx] != segmentIdx) {
+                    markers[predecessorIdx] = segmentIdx;
+                    predecessors.push_back(predecessorIdx);
+                }
+            };
+            for (const SegmentAccess &access : accesses) {
+                ResourceState &state = resources[access.mrtIdx];
+                addPredecessor(state.lastWriter);
+                if (access.write) {
+                    for (uint32_t read = state.lastRead; read != NO_SEGMENT; read = readLinks[read]) {
+                        addPredecessor(readSegments[read]);
+                    }
+                    state.lastWriter = segmentIdx;
+                    state.lastRead = NO_SEGMENT;
+                } else {
+                    readSegments.push_back(segmentIdx);
+                    readLinks.push_back(state.lastRead);
+                    state.lastRead = static_cast<uint32_t>(readSegments.size() - 1);
+                }
+            }
+
+            std::sort(predecessors.begin(), predecessors.end());
+            for (const uint32_t predecessorIdx : predecessors) {
+                predecessorPairs.emplace_back(segmentIdx, predecessorIdx);
+                successorPairs.emplace_back(predecessorIdx, segmentIdx);
+                if (levels_[predecessorIdx] + 1 > levels_[segmentIdx]) {
+                    levels_[segmentIdx] = levels_[predecessorIdx] + 1;
+                    criticalPredecessors[segmentIdx] = predecessorIdx;
+                }
+            }
+        }
+        predecessors_ = CompressedRows(numSegments_, predecessorPairs);
+        successors_ = CompressedRows(numSegments_, successorPairs);
+
+        std::vector<CompressedRows::Pair> levelPairs;
+        levelPairs.reserve(numSegments_);
+        uint32_t lastSegment = NO_SEGMENT;
+        for (uint32_t segmentIdx = 0; segmentIdx < numSegments_; ++segmentIdx) {
+            levelPairs.emplace_back(levels_[segmentIdx], segmentIdx);
+            if (lastSegment == NO_SEGMENT || levels_[segmentIdx] > levels_[lastSegment]) {
+                lastSegment = segmentIdx;
+            }
+        }
+        numLevels_ = lastSegment == NO_SEGMENT ? 0 : levels_[lastSegment] + 1;
+        levelSegments_ = CompressedRows(numLevels_, levelPairs);
+
+        for (uint32_t segmentIdx = lastSegment; segmentIdx != NO_SEGMENT;
+             segmentIdx = criticalPredecessors[segmentIdx]) {
+            criticalPath_.push_back(segmentIdx);
+        }
+        std::reverse(criticalPath_.begin(), criticalPath_.end());
+    }
+
+    [[nodiscard]] size_t size() const override { return numSegments_; }
+
+    [[nodiscard]] DataView<uint32_t> getPredecessors(uint32_t segmentIdx) const override {
+        return predecessors_.row(segmentIdx);
+    }
+
+    [[nodiscard]] DataView<uint32_t> getSuccessors(uint32_t segmentIdx) const override {
+        return successors_.row(segmentIdx);
+    }
+
+    [[nodiscard]] uint32_t getLevel(uint32_t segmentIdx) const override {
+        assert(segmentIdx < numSegments_ && "segmentIdx out of bounds");
+        return levels_[segmentIdx];
+    }
+
+    [[nodiscard]] size_t getNumLevels() const override { return numLevels_; }
+
+    [[nodiscard]] DataView<uint32_t> getLevelSegments(uint32_t level) const override {
+        return levelSegments_.row(level);
+    }
+
+    [[nodiscard]] DataView<uint32_t> getCriticalPath() const override {
+        return {criticalPath_.data(), criticalPath_.size()};
+    }
+
+  private:
+    uint32_t numSegments_;
+    size_t numLevels_ = 0;
+    std::vector<uint32_t> levels_;
+    std::vector<uint32_t> criticalPath_;
+    CompressedRows predecessors_;
+    CompressedRows successors_;
+    CompressedRows levelSegments_;
+};
+
+std::unique_ptr<SegmentGraph> CreateSegmentGraph(const ModelSequenceTableDecoder &modelSequenceTable) {
+    return std::make_unique<SegmentGraphImpl>(modelSequenceTable);
+}
+
+// VGF Model
+class VgfModelImpl : public VgfModel {
+  public:
+    static std::unique_ptr<VgfModelImpl> Create(const void *const data, uint64_t size, const VgfModelOptions &options) {
+        auto model = std::unique_ptr<VgfModelImpl>(new VgfModelImpl());
+        // The model is destroyed by its owner, so its decoders can hold the tensor layouts
+        model->precomputeLayouts_ = true;
+        if (!model->_decode(data, size, options)) {
+            return nullptr;
+        }
+        return model;
+    }
+
+    static VgfModelImpl *CreateInPlace(const void *const data, uint64_t size, void *modelMem) {
+        assert(modelMem != nullptr && "modelMem is null");
+        auto *model = new (modelMem) VgfModelImpl();
+        if (!model->_decode(data, size, VgfModelOptions{})) {
+            model->~VgfModelImpl();
+            return nullptr;
+        }
+        return model;
+    }
+
+    VgfModelImpl(const VgfModelImpl &) = delete;
+    VgfModelImpl &operator=(const VgfModelImpl &) = delete;
+
+    ~VgfModelImpl() override {
+        if (constants_ != nullptr) {
+            constants_->~ConstantDecoder();
+        }
+        if (modelResourceTable_ != nullptr) {
+            modelResourceTable_->~ModelResourceTableDecoder();
+        }
+        if (modelSequenceTable_ != nullptr) {
+            modelSequenceTable_->~ModelSequenceTableDecoder();
+        }
+        if (moduleTable_ != nullptr) {
+            moduleTable_->~ModuleTableDecoder();
+        }
+        if (header_ != nullptr) {
+            header_->~HeaderDecoder();
+        }
+    }
+
+    [[nodiscard]] const HeaderDecoder &getHeaderDecoder() const override { return *header_; }
+    [[nodiscard]] const ModuleTableDecoder &getModuleTableDecoder() const override { return *moduleTable_; }
+    [[nodiscard]] const ModelSequenceTableDecoder &getModelSequenceTableDecoder() const override {
+        return *modelSequenceTable_;
+    }
+    [[nodiscard]] const ModelResourceTableDecoder &getModelResourceTableDecoder() const override {
+        return *modelResourceTable_;
+    }
+    [[nodiscard]] const ConstantDecoder &getConstantDecoder() const override { return *constants_; }
+    [[nodiscard]] const NameIndex *getNameIndex() const override { return nameIndex_.get(); }
+
+  private:
+    VgfModelImpl() = default;
+
+    [[nodiscard]] bool _decode(const void *const data, uint64_t size, const VgfModelOptions &options) {
+        if (data == nullptr) {
+            logging::error("VGF model data is null");
+            return false;
+        }
+#if SIZE_MAX < UINT64_MAX
+        if (size > SIZE_MAX_VALUE) {
+            logging::error("VGF model size out of bounds (" + std::to_string(size) +
+                           ", max=" + std::to_string(SIZE_MAX_VALUE) + ")");
+            return false;
+        }
+#endif
+        if (size < HeaderSize()) {
+            logging::error("VGF model is smaller than the header size");
+            return false;
+        }
+
+        // The header checks that every section lies within the file, so the sections can be addressed directly
+        header_ = HeaderDecoderImpl::CreateInPlace(data, HeaderSize(), size, headerMem_);
+        if (header_ == nullptr) {
+            return false;
+        }
+        const auto section = [data](uint64_t offset) {
+            return static_cast<const uint8_t *>(data) + static_cast<size_t>(offset);
+        };
+
+        const VerificationMode mode = options.mode;
+        // Each task verifies a distinct byte range and places its decoder into its own storage
+        const std::vector<std::function<bool()>> tasks{
+            [&] {
+                moduleTable_ = ModuleTableDecoderImpl::CreateInPlace(
+                    section(header_->GetModuleTableOffset()), header_->GetModuleTableSize(), moduleTableMem_, mode);
+                return moduleTable_ != nullptr;
+            },
+            [&] {
+                modelSequenceTable_ = ModelSequenceTableDecoderImpl::CreateInPlace(
+                    section(header_->GetModelSequenceTableOffset()), header_->GetModelSequenceTableSize(),
+                    modelSequenceTableMem_, mode);
+                return modelSequenceTable_ != nullptr;
+            },
+            [&] {
+                modelResourceTable_ = ModelResourceTableDecoderImpl::CreateInPlace(
+                    section(header_->GetModelResourceTableOffset()), header_->GetModelResourceTableSize(),
+                    modelResourceTableMem_, mode, precomputeLayouts_);
+                return modelResourceTable_ != nullptr;
+            },
+            [&] {
+                constants_ = CreateConstantDecoderInPlace(section(header_->GetConstantsOffset()),
+                                                          header_->GetConstantsSize(), constantsMem_);
+                return constants_ != nullptr;
+            },
+        };
+        // Serial verification stops at the first section failing verification
+        const bool verified = options.parallelVerification
+                                  ? _runParallel(tasks, options.executor)
+                                  : std::all_of(tasks.begin(), tasks.end(), [](const auto &task) { return task(); });
+        if (verified && options.buildNameIndex) {
+            nameIndex_ = NameIndexImpl::Create(*moduleTable_, *modelSequenceTable_);
+        }
+        return verified;
+    }
+
+    [[nodiscard]] static bool _runParallel(const std::vector<std::function<bool()>> &tasks,
+                                           const VerificationExecutor &executor) {
+        // One byte per task, so that tasks do not share a bit of std::vector<bool>
+        std::vector<uint8_t> results(tasks.size(), 0);
+        if (executor) {
+            std::vector<std::function<void()>> executorTasks;
+            executorTasks.reserve(tasks.size());
+            for (size_t i = 0; i < tasks.size(); ++i) {
+                executorTasks.emplace_back([&tasks, &results, i] { results[i] = tasks[i]() ? 1 : 0; });
+            }
+            executor(executorTasks);
+        } else {
+            // The calling thread verifies the first section while the others run on their own threads
+            std::vector<std::future<bool>> futures;
+            futures.reserve(tasks.size() - 1);
+            for (size_t i = 1; i < tasks.size(); ++i) {
+                futures.push_back(std::async(std::launch::async, tasks[i]));
+            }
+            results[0] = tasks[0]() ? 1 : 0;
+            for (size_t i = 1; i < tasks.size(); ++i) {
+                results[i] = futures[i - 1].get() ? 1 : 0;
+            }
+        }
+        return std::all_of(results.begin(), results.end(), [](uint8_t result) { return result != 0; });
+    }
+
+    static constexpr size_t CONSTANT_DECODER_SIZE =
+        std::max({sizeof(ConstantDecoderImpl), sizeof(ConstantDecoderV00Impl), sizeof(ConstantDecoderV01Impl)});
+
+    HeaderDecoder *header_ = nullptr;
+    ModuleTableDecoder *moduleTable_ = nullptr;
+    ModelSequenceTableDecoder *modelSequenceTable_ = nullptr;
+    ModelResourceTableDecoder *modelResourceTable_ = nullptr;
+    ConstantDecoder *constants_ = nullptr;
+    std::unique_ptr<NameIndexImpl> nameIndex_;
+    bool precomputeLayouts_ = false;
+
+    alignas(HeaderDecoderImpl) unsigned char headerMem_[sizeof(HeaderDecoderImpl)];
+    alignas(ModuleTableDecoderImpl) unsigned char moduleTableMem_[sizeof(ModuleTableDecoderImpl)];
+    alignas(ModelSequenceTableDecoderImpl) unsigned char modelSequenceTableMem_[sizeof(ModelSequenceTableDecoderImpl)];
+    alignas(ModelResourceTableDecoderImpl) unsigned char modelResourceTableMem_[sizeof(ModelResourceTableDecoderImpl)];
+    alignas(std::max_align_t) unsigned char constantsMem_[CONSTANT_DECODER_SIZE];
+};
+
+size_t VgfModelSize() { return sizeof(VgfModelImpl); }
+
+std::unique_ptr<VgfModel> CreateVgfModel(const void *const data, uint64_t size, VerificationMode mode) {
+    VgfModelOptions options;
+    options.mode = mode;
+    return VgfModelImpl::Create(data, size, options);
+}
+
+std::unique_ptr<VgfModel> CreateVgfModel(const void *const data, uint64_t size, const VgfModelOptions &options) {
+    return VgfModelImpl::Create(data, size, options);
+}
+
+VgfModel *CreateVgfModelInPlace(const void *const data, uint64_t size, void *modelMem) {
+    return VgfModelImpl::CreateInPlace(data, size, modelMem);
+}
+
 } // namespace mlsdk::vgflib
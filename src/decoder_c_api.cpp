@@ -5,10 +5,15 @@
 
 #include "vgf/decoder.h"
 #include "vgf/decoder.hpp"
+#include "vgf/decoder_views.hpp"
+#include "vgf/loader.hpp"
 
+#include "decoder_internal.hpp"
 #include "header.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
 
 using namespace mlsdk::vgflib;
 
@@ -106,6 +111,33 @@ void mlsdk_decoder_get_header_section_info(const mlsdk_decoder_header_decoder *c
     }
 }
 
+mlsdk_decoder_integrity_status mlsdk_decoder_check_section_integrity(const void *const data, const uint64_t size,
+                                                                     mlsdk_decoder_section sectionName) {
+    SectionName section = SectionName::MODULES;
+    switch (sectionName) {
+    case mlsdk_decoder_section_modules:
+        section = SectionName::MODULES;
+        break;
+    case mlsdk_decoder_section_model_sequence:
+        section = SectionName::MODEL_SEQUENCE;
+        break;
+    case mlsdk_decoder_section_resources:
+        section = SectionName::RESOURCES;
+        break;
+    case mlsdk_decoder_section_constants:
+        section = SectionName::CONSTANTS;
+        break;
+    default:
+        assert(false && "Unknown section name");
+        return mlsdk_decoder_integrity_invalid_file;
+    }
+    return static_cast<mlsdk_decoder_integrity_status>(CheckSectionIntegrity(data, size, section));
+}
+
+mlsdk_decoder_integrity_status mlsdk_decoder_check_integrity(const void *const data, const uint64_t size) {
+    return static_cast<mlsdk_decoder_integrity_status>(CheckIntegrity(data, size));
+}
+
 size_t mlsdk_decoder_module_table_decoder_mem_reqs() { return ModuleTableDecoderSize(); }
 
 mlsdk_decoder_module_table_decoder *
@@ -276,6 +308,20 @@ uint32_t mlsdk_decoder_binding_slot_mrt_index(const mlsdk_decoder_model_sequence
         ->getBindingSlotMrtIndex(from_c_handle(handle), slotIdx);
 }
 
+size_t mlsdk_decoder_binding_slot_get_infos(
+    [[maybe_unused]] const mlsdk_decoder_model_sequence_decoder *const modelSequenceDecoder,
+    mlsdk_decoder_binding_slots_handle handle, mlsdk_decoder_binding_slot_info *infos, size_t capacity) {
+    assert(modelSequenceDecoder != nullptr && "modelSequenceDecoder is null");
+    assert((infos != nullptr || capacity == 0) && "infos is null");
+    const BindingSlotsView slots(from_c_handle(handle));
+    const size_t count = std::min(slots.size(), capacity);
+    for (uint32_t i = 0; i < count; ++i) {
+        infos[i].binding = slots.binding(i);
+        infos[i].mrt_index = slots.mrtIndex(i);
+    }
+    return count;
+}
+
 /**********************************************************************************************************************/
 
 size_t
@@ -466,6 +512,31 @@ mlsdk_decoder_model_sequence_get_name(const mlsdk_decoder_model_sequence_decoder
         .data();
 }
 
+size_t mlsdk_decoder_model_sequence_get_segment_summaries(
+    const mlsdk_decoder_model_sequence_decoder *const modelSequenceDecoder, mlsdk_decoder_segment_summary *summaries,
+    size_t capacity) {
+    assert(modelSequenceDecoder != nullptr && "modelSequenceDecoder is null");
+    assert((summaries != nullptr || capacity == 0) && "summaries is null");
+    const auto *decoder = reinterpret_cast<const ModelSequenceTableDecoder *>(modelSequenceDecoder);
+    const size_t count = std::min(decoder->modelSequenceTableSize(), capacity);
+    for (uint32_t i = 0; i < count; ++i) {
+        const SegmentView segment = GetSegmentView(*decoder, i);
+        mlsdk_decoder_segment_summary &summary = summaries[i];
+        summary.type = static_cast<mlsdk_decoder_module_type>(segment.type());
+        summary.module_index = segment.moduleIndex();
+        summary.num_descriptor_set_infos = static_cast<uint32_t>(segment.descriptorSetInfosSize());
+        summary.num_inputs = static_cast<uint32_t>(segment.inputs().size());
+        summary.num_outputs = static_cast<uint32_t>(segment.outputs().size());
+        summary.num_constants = static_cast<uint32_t>(segment.constantIndexes().size());
+        summary.num_push_constant_ranges = static_cast<uint32_t>(segment.pushConstantRanges().size());
+        const DataView<uint32_t> shape = segment.dispatchShape();
+        for (uint32_t axis = 0; axis < 3; ++axis) {
+            summary.dispatch_shape.data[axis] = shape.size() == 3 ? shape[axis] : 0;
+        }
+    }
+    return count;
+}
+
 size_t mlsdk_decoder_model_resource_table_decoder_mem_reqs() { return ModelResourceTableDecoderSize(); }
 
 mlsdk_decoder_model_resource_table_decoder *
@@ -566,11 +637,41 @@ mlsdk_decoder_constant_table_get_sparsity_dimension(const mlsdk_decoder_constant
     return reinterpret_cast<const ConstantDecoder *>(constantDecoder)->getConstantSparsityDimension(constidx);
 }
 
+uint64_t mlsdk_decoder_constant_table_get_alignment(const mlsdk_decoder_constant_table_decoder *const constantDecoder,
+                                                   uint32_t constidx) {
+    assert(constantDecoder != nullptr && "constantDecoder is null");
+    return reinterpret_cast<const ConstantDecoder *>(constantDecoder)->getConstantAlignment(constidx);
+}
+
+bool mlsdk_decoder_constant_table_is_aligned(const mlsdk_decoder_constant_table_decoder *const constantDecoder,
+                                             uint32_t constidx, uint64_t sectionOffset, uint64_t alignment) {
+    assert(constantDecoder != nullptr && "constantDecoder is null");
+    return reinterpret_cast<const ConstantDecoder *>(constantDecoder)
+        ->isConstantAligned(constidx, sectionOffset, alignment);
+}
+
 size_t mlsdk_decoder_get_constant_table_num_entries(const mlsdk_decoder_constant_table_decoder *const constantDecoder) {
     assert(constantDecoder != nullptr && "constantDecoder is null");
     return reinterpret_cast<const ConstantDecoder *>(constantDecoder)->size();
 }
 
+namespace {
+ConstantChunkCallback to_chunk_callback(mlsdk_decoder_constant_chunk_callback callback, void *userData) {
+    assert(callback != nullptr && "callback is null");
+    return [callback, userData](uint64_t offset, DataView<uint8_t> chunk) {
+        return callback(userData, offset, chunk.begin(), chunk.size());
+    };
+}
+} // namespace
+
+bool mlsdk_decoder_constant_table_for_each_chunk(const mlsdk_decoder_constant_table_decoder *const constantDecoder,
+                                                 uint32_t constidx, uint64_t chunkSize,
+                                                 mlsdk_decoder_constant_chunk_callback callback, void *userData) {
+    assert(constantDecoder != nullptr && "constantDecoder is null");
+    return ForEachConstantChunk(*reinterpret_cast<const ConstantDecoder *>(constantDecoder), constidx, chunkSize,
+                                to_chunk_callback(callback, userData));
+}
+
 /**********************************************************************************************************************/
 namespace {
 inline mlsdk_decoder_mrt_category convert_resource_category(ResourceCategory category) {
@@ -617,6 +718,47 @@ void mlsdk_decoder_model_resource_table_get_tensor_strides(
     dimensions->size = tensorStrides.size();
 }
 
+bool mlsdk_decoder_model_resource_table_get_tensor_layout(
+    const mlsdk_decoder_model_resource_table_decoder *const modelResourceTableDecoder, uint32_t mrtIdx,
+    mlsdk_decoder_tensor_layout *layout) {
+    assert(modelResourceTableDecoder != nullptr && "modelResourceTableDecoder is null");
+    assert(layout != nullptr && "layout is null");
+    const std::optional<TensorLayout> tensorLayout =
+        reinterpret_cast<const ModelResourceTableDecoder *>(modelResourceTableDecoder)->getTensorLayout(mrtIdx);
+    if (!tensorLayout.has_value()) {
+        return false;
+    }
+    layout->element_count = tensorLayout->elementCount;
+    layout->element_size = tensorLayout->elementSize;
+    layout->packed_byte_size = tensorLayout->packedByteSize;
+    layout->span_byte_size = tensorLayout->spanByteSize;
+    layout->contiguous = tensorLayout->contiguous;
+    return true;
+}
+
+size_t mlsdk_decoder_model_resource_table_get_entry_infos(
+    const mlsdk_decoder_model_resource_table_decoder *const modelResourceTableDecoder,
+    mlsdk_decoder_mrt_entry_info *infos, size_t capacity) {
+    assert(modelResourceTableDecoder != nullptr && "modelResourceTableDecoder is null");
+    assert((infos != nullptr || capacity == 0) && "infos is null");
+    const auto *decoder = reinterpret_cast<const ModelResourceTableDecoder *>(modelResourceTableDecoder);
+    const size_t count = std::min(decoder->size(), capacity);
+    for (uint32_t i = 0; i < count; ++i) {
+        const ModelResourceEntryView entry = GetModelResourceEntryView(*decoder, i);
+        mlsdk_decoder_mrt_entry_info &info = infos[i];
+        info.vk_format = convert_vk_format(entry.vkFormat());
+        info.category = convert_resource_category(entry.category());
+        const std::optional<DescriptorType> descriptorType = entry.descriptorType();
+        info.has_descriptor_type = descriptorType.has_value();
+        info.descriptor_type = static_cast<mlsdk_vk_descriptor_type>(descriptorType.value_or(0));
+        const std::optional<AliasGroupId> aliasGroupId = entry.aliasGroupId();
+        info.has_alias_group_id = aliasGroupId.has_value();
+        info.alias_group_id = aliasGroupId.value_or(0);
+        info.rank = static_cast<uint32_t>(entry.tensorShape().size());
+    }
+    return count;
+}
+
 mlsdk_decoder_sampler_config_handle mlsdk_decoder_model_resource_table_get_sampler_config_handle(
     const mlsdk_decoder_model_resource_table_decoder *const modelResourceTableDecoder, uint32_t mrtIdx) {
     assert(modelResourceTableDecoder != nullptr && "modelResourceTableDecoder is null");
@@ -668,3 +810,342 @@ uint32_t mlsdk_decoder_model_resource_table_sampler_config_get_border_color(
     return reinterpret_cast<const ModelResourceTableDecoder *>(modelResourceTableDecoder)
         ->getSamplerConfigBorderColor(from_c_handle(handle));
 }
+
+size_t mlsdk_decoder_model_mem_reqs() { return VgfModelSize(); }
+
+mlsdk_decoder_model *mlsdk_decoder_create_model(const void *const data, const uint64_t size, void *modelMemory) {
+    assert(data != nullptr && "data is null");
+    assert(modelMemory != nullptr && "modelMemory is null");
+    return reinterpret_cast<mlsdk_decoder_model *>(CreateVgfModelInPlace(data, size, modelMemory));
+}
+
+const mlsdk_decoder_header_decoder *mlsdk_decoder_model_get_header_decoder(const mlsdk_decoder_model *const model) {
+    assert(model != nullptr && "model is null");
+    return reinterpret_cast<const mlsdk_decoder_header_decoder *>(
+        &reinterpret_cast<const VgfModel *>(model)->getHeaderDecoder());
+}
+
+const mlsdk_decoder_module_table_decoder *
+mlsdk_decoder_model_get_module_table_decoder(const mlsdk_decoder_model *const model) {
+    assert(model != nullptr && "model is null");
+    return reinterpret_cast<const mlsdk_decoder_module_table_decoder *>(
+        &reinterpret_cast<const VgfModel *>(model)->getModuleTableDecoder());
+}
+
+const mlsdk_decoder_model_sequence_decoder *
+mlsdk_decoder_model_get_model_sequence_decoder(const mlsdk_decoder_model *const model) {
+    assert(model != nullptr && "model is null");
+    return reinterpret_cast<const mlsdk_decoder_model_sequence_decoder *>(
+        &reinterpret_cast<const VgfModel *>(model)->getModelSequenceTableDecoder());
+}
+
+const mlsdk_decoder_model_resource_table_decoder *
+mlsdk_decoder_model_get_model_resource_table_decoder(const mlsdk_decoder_model *const model) {
+    assert(model != nullptr && "model is null");
+    return reinterpret_cast<const mlsdk_decoder_model_resource_table_decoder *>(
+        &reinterpret_cast<const VgfModel *>(model)->getModelResourceTableDecoder());
+}
+
+const mlsdk_decoder_constant_table_decoder *
+mlsdk_decoder_model_get_constant_table_decoder(const mlsdk_decoder_model *const model) {
+    assert(model != nullptr && "model is null");
+    return reinterpret_cast<const mlsdk_decoder_constant_table_decoder *>(
+        &reinterpret_cast<const VgfModel *>(model)->getConstantDecoder());
+}
+
+/**********************************************************************************************************************/
+namespace {
+/// A loader together with the reader of the file it owns
+struct FileLoader {
+    std::unique_ptr<RangeReader> reader;
+    std::unique_ptr<VgfLoader> loader;
+};
+
+const VgfLoader &to_loader(const mlsdk_decoder_loader *loader) {
+    assert(loader != nullptr && "loader is null");
+    return *reinterpret_cast<const FileLoader *>(loader)->loader;
+}
+} // namespace
+
+mlsdk_decoder_loader *mlsdk_decoder_create_file_loader(const char *const path) {
+    assert(path != nullptr && "path is null");
+    auto fileLoader = std::make_unique<FileLoader>();
+    fileLoader->reader = CreateFileRangeReader(path);
+    if (fileLoader->reader == nullptr) {
+        return nullptr;
+    }
+    fileLoader->loader = CreateVgfLoader(*fileLoader->reader);
+    if (fileLoader->loader == nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<mlsdk_decoder_loader *>(fileLoader.release());
+}
+
+void mlsdk_decoder_destroy_loader(mlsdk_decoder_loader *loader) { delete reinterpret_cast<FileLoader *>(loader); }
+
+const mlsdk_decoder_header_decoder *mlsdk_decoder_loader_get_header_decoder(const mlsdk_decoder_loader *const loader) {
+    return reinterpret_cast<const mlsdk_decoder_header_decoder *>(&to_loader(loader).getHeaderDecoder());
+}
+
+const mlsdk_decoder_module_table_decoder *
+mlsdk_decoder_loader_get_module_table_decoder(const mlsdk_decoder_loader *const loader) {
+    return reinterpret_cast<const mlsdk_decoder_module_table_decoder *>(&to_loader(loader).getModuleTableDecoder());
+}
+
+const mlsdk_decoder_model_sequence_decoder *
+mlsdk_decoder_loader_get_model_sequence_decoder(const mlsdk_decoder_loader *const loader) {
+    return reinterpret_cast<const mlsdk_decoder_model_sequence_decoder *>(
+        &to_loader(loader).getModelSequenceTableDecoder());
+}
+
+const mlsdk_decoder_model_resource_table_decoder *
+mlsdk_decoder_loader_get_model_resource_table_decoder(const mlsdk_decoder_loader *const loader) {
+    return reinterpret_cast<const mlsdk_decoder_model_resource_table_decoder *>(
+        &to_loader(loader).getModelResourceTableDecoder());
+}
+
+size_t mlsdk_decoder_loader_get_num_constants(const mlsdk_decoder_loader *const loader) {
+    return to_loader(loader).getNumConstants();
+}
+
+uint32_t mlsdk_decoder_loader_get_constant_mrt_index(const mlsdk_decoder_loader *const loader, uint32_t constidx) {
+    return to_loader(loader).getConstantMrtIndex(constidx);
+}
+
+uint64_t mlsdk_decoder_loader_get_constant_size(const mlsdk_decoder_loader *const loader, uint32_t constidx) {
+    return to_loader(loader).getConstantSize(constidx);
+}
+
+bool mlsdk_decoder_loader_read_constant(const mlsdk_decoder_loader *const loader, uint32_t constidx, void *dst,
+                                        uint64_t capacity) {
+    return to_loader(loader).readConstant(constidx, dst, capacity);
+}
+
+bool mlsdk_decoder_loader_for_each_constant_chunk(const mlsdk_decoder_loader *const loader, uint32_t constidx,
+                                                  void *staging, uint64_t stagingSize,
+                                                  mlsdk_decoder_constant_chunk_callback callback, void *userData) {
+    return to_loader(loader).forEachConstantChunk(constidx, staging, stagingSize,
+                                                  to_chunk_callback(callback, userData));
+}
+
+/**********************************************************************************************************************/
+
+size_t mlsdk_decoder_name_index_mem_reqs(const mlsdk_decoder_module_table_decoder *const moduleTableDecoder,
+                                         const mlsdk_decoder_model_sequence_decoder *const modelSequenceDecoder) {
+    assert(moduleTableDecoder != nullptr && "moduleTableDecoder is null");
+    assert(modelSequenceDecoder != nullptr && "modelSequenceDecoder is null");
+    return NameIndexSize(*reinterpret_cast<const ModuleTableDecoder *>(moduleTableDecoder),
+                         *reinterpret_cast<const ModelSequenceTableDecoder *>(modelSequenceDecoder));
+}
+
+mlsdk_decoder_name_index *
+mlsdk_decoder_create_name_index(const mlsdk_decoder_module_table_decoder *const moduleTableDecoder,
+                                const mlsdk_decoder_model_sequence_decoder *const modelSequenceDecoder,
+                                void *nameIndexMemory) {
+    assert(moduleTableDecoder != nullptr && "moduleTableDecoder is null");
+    assert(modelSequenceDecoder != nullptr && "modelSequenceDecoder is null");
+    assert(nameIndexMemory != nullptr && "nameIndexMemory is null");
+    return reinterpret_cast<mlsdk_decoder_name_index *>(
+        CreateNameIndexInPlace(*reinterpret_cast<const ModuleTableDecoder *>(moduleTableDecoder),
+                               *reinterpret_cast<const ModelSequenceTableDecoder *>(modelSequenceDecoder),
+                               nameIndexMemory));
+}
+
+namespace {
+bool to_c_index(std::optional<uint32_t> found, uint32_t *idx) {
+    assert(idx != nullptr && "idx is null");
+    if (!found.has_value()) {
+        return false;
+    }
+    *idx = *found;
+    return true;
+}
+} // namespace
+
+bool mlsdk_decoder_name_index_find_input_by_name(const mlsdk_decoder_name_index *const nameIndex, const char *name,
+                                                 uint32_t *idx) {
+    assert(nameIndex != nullptr && "nameIndex is null");
+    assert(name != nullptr && "name is null");
+    return to_c_index(reinterpret_cast<const NameIndex *>(nameIndex)->findInputByName(name), idx);
+}
+
+bool mlsdk_decoder_name_index_find_output_by_name(const mlsdk_decoder_name_index *const nameIndex, const char *name,
+                                                  uint32_t *idx) {
+    assert(nameIndex != nullptr && "nameIndex is null");
+    assert(name != nullptr && "name is null");
+    return to_c_index(reinterpret_cast<const NameIndex *>(nameIndex)->findOutputByName(name), idx);
+}
+
+bool mlsdk_decoder_name_index_find_module_by_name(const mlsdk_decoder_name_index *const nameIndex, const char *name,
+                                                  uint32_t *idx) {
+    assert(nameIndex != nullptr && "nameIndex is null");
+    assert(name != nullptr && "name is null");
+    return to_c_index(reinterpret_cast<const NameIndex *>(nameIndex)->findModuleByName(name), idx);
+}
+
+bool mlsdk_decoder_name_index_find_segment_by_name(const mlsdk_decoder_name_index *const nameIndex, const char *name,
+                                                   uint32_t *idx) {
+    assert(nameIndex != nullptr && "nameIndex is null");
+    assert(name != nullptr && "name is null");
+    return to_c_index(reinterpret_cast<const NameIndex *>(nameIndex)->findSegmentByName(name), idx);
+}
+
+/**********************************************************************************************************************/
+
+mlsdk_decoder_resource_index *
+mlsdk_decoder_create_resource_index(const mlsdk_decoder_model_sequence_decoder *const modelSequenceDecoder,
+                                    const mlsdk_decoder_model_resource_table_decoder *const modelResourceTableDecoder,
+                                    const mlsdk_decoder_constant_table_decoder *const constantDecoder) {
+    assert(modelSequenceDecoder != nullptr && "modelSequenceDecoder is null");
+    assert(modelResourceTableDecoder != nullptr && "modelResourceTableDecoder is null");
+    assert(constantDecoder != nullptr && "constantDecoder is null");
+    return reinterpret_cast<mlsdk_decoder_resource_index *>(
+        CreateResourceIndex(*reinterpret_cast<const ModelSequenceTableDecoder *>(modelSequenceDecoder),
+                            *reinterpret_cast<const ModelResourceTableDecoder *>(modelResourceTableDecoder),
+                            *reinterpret_cast<const ConstantDecoder *>(constantDecoder))
+            .release());
+}
+
+void mlsdk_decoder_destroy_resource_index(mlsdk_decoder_resource_index *resourceIndex) {
+    delete reinterpret_cast<ResourceIndex *>(resourceIndex);
+}
+
+namespace {
+void to_c_list(DataView<uint32_t> view, mlsdk_decoder_index_list *list) {
+    assert(list != nullptr && "list is null");
+    list->data = view.data();
+    list->size = view.size();
+}
+
+const ResourceIndex &to_resource_index(const mlsdk_decoder_resource_index *resourceIndex) {
+    assert(resourceIndex != nullptr && "resourceIndex is null");
+    return *reinterpret_cast<const ResourceIndex *>(resourceIndex);
+}
+} // namespace
+
+void mlsdk_decoder_resource_index_get_constants(const mlsdk_decoder_resource_index *resourceIndex, uint32_t mrtIdx,
+                                                mlsdk_decoder_index_list *constants) {
+    to_c_list(to_resource_index(resourceIndex).getConstants(mrtIdx), constants);
+}
+
+void mlsdk_decoder_resource_index_get_producer_segments(const mlsdk_decoder_resource_index *resourceIndex,
+                                                        uint32_t mrtIdx, mlsdk_decoder_index_list *segments) {
+    to_c_list(to_resource_index(resourceIndex).getProducerSegments(mrtIdx), segments);
+}
+
+void mlsdk_decoder_resource_index_get_consumer_segments(const mlsdk_decoder_resource_index *resourceIndex,
+                                                        uint32_t mrtIdx, mlsdk_decoder_index_list *segments) {
+    to_c_list(to_resource_index(resourceIndex).getConsumerSegments(mrtIdx), segments);
+}
+
+void mlsdk_decoder_resource_index_get_binding_segments(const mlsdk_decoder_resource_index *resourceIndex,
+                                                       uint32_t mrtIdx, mlsdk_decoder_index_list *segments) {
+    to_c_list(to_resource_index(resourceIndex).getBindingSegments(mrtIdx), segments);
+}
+
+void mlsdk_decoder_resource_index_get_alias_group_ids(const mlsdk_decoder_resource_index *resourceIndex,
+                                                      mlsdk_decoder_index_list *aliasGroupIds) {
+    to_c_list(to_resource_index(resourceIndex).getAliasGroupIds(), aliasGroupIds);
+}
+
+void mlsdk_decoder_resource_index_get_alias_group_members(const mlsdk_decoder_resource_index *resourceIndex,
+                                                          mlsdk_alias_group_id aliasGroupId,
+                                                          mlsdk_decoder_index_list *members) {
+    to_c_list(to_resource_index(resourceIndex).getAliasGroupMembers(aliasGroupId), members);
+}
+
+/**********************************************************************************************************************/
+
+mlsdk_decoder_segment_graph *
+mlsdk_decoder_create_segment_graph(const mlsdk_decoder_model_sequence_decoder *const modelSequenceDecoder) {
+    assert(modelSequenceDecoder != nullptr && "modelSequenceDecoder is null");
+    return reinterpret_cast<mlsdk_decoder_segment_graph *>(
+        CreateSegmentGraph(*reinterpret_cast<const ModelSequenceTableDecoder *>(modelSequenceDecoder)).release());
+}
+
+void mlsdk_decoder_destroy_segment_graph(mlsdk_decoder_segment_graph *segmentGraph) {
+    delete reinterpret_cast<SegmentGraph *>(segmentGraph);
+}
+
+namespace {
+const SegmentGraph &to_segment_graph(const mlsdk_decoder_segment_graph *segmentGraph) {
+    assert(segmentGraph != nullptr && "segmentGraph is null");
+    return *reinterpret_cast<const SegmentGraph *>(segmentGraph);
+}
+} // namespace
+
+void mlsdk_decoder_segment_graph_get_predecessors(const mlsdk_decoder_segment_graph *segmentGraph,
+                                                  uint32_t segmentIdx, mlsdk_decoder_index_list *segments) {
+    to_c_list(to_segment_graph(segmentGraph).getPredecessors(segmentIdx), segments);
+}
+
+void mlsdk_decoder_segment_graph_get_successors(const mlsdk_decoder_segment_graph *segmentGraph, uint32_t segmentIdx,
+                                                mlsdk_decoder_index_list *segments) {
+    to_c_list(to_segment_graph(segmentGraph).getSuccessors(segmentIdx), segments);
+}
+
+uint32_t mlsdk_decoder_segment_graph_get_level(const mlsdk_decoder_segment_graph *segmentGraph, uint32_t segmentIdx) {
+    return to_segment_graph(segmentGraph).getLevel(segmentIdx);
+}
+
+size_t mlsdk_decoder_segment_graph_get_num_levels(const mlsdk_decoder_segment_graph *segmentGraph) {
+    return to_segment_graph(segmentGraph).getNumLevels();
+}
+
+void mlsdk_decoder_segment_graph_get_level_segments(const mlsdk_decoder_segment_graph *segmentGraph, uint32_t level,
+                                                    mlsdk_decoder_index_list *segments) {
+    to_c_list(to_segment_graph(segmentGraph).getLevelSegments(level), segments);
+}
+
+void mlsdk_decoder_segment_graph_get_critical_path(const mlsdk_decoder_segment_graph *segmentGraph,
+                                                   mlsdk_decoder_index_list *segments) {
+    to_c_list(to_segment_graph(segmentGraph).getCriticalPath(), segments);
+}
+
+/**********************************************************************************************************************/
+
+bool mlsdk_decoder_plan_intermediate_memory(
+    const mlsdk_decoder_model_sequence_decoder *const modelSequenceDecoder,
+    const mlsdk_decoder_model_resource_table_decoder *const modelResourceTableDecoder, uint64_t alignment,
+    mlsdk_decoder_intermediate_allocation *allocations, size_t capacity, size_t *numAllocations, uint64_t *peakBytes) {
+    assert(modelSequenceDecoder != nullptr && "modelSequenceDecoder is null");
+    assert(modelResourceTableDecoder != nullptr && "modelResourceTableDecoder is null");
+    assert((allocations != nullptr || capacity == 0) && "allocations is null");
+    assert(numAllocations != nullptr && "numAllocations is null");
+    assert(peakBytes != nullptr && "peakBytes is null");
+    MemoryPlanOptions options;
+    options.alignment = alignment;
+    const std::optional<MemoryPlan> plan = PlanIntermediateMemory(
+        *reinterpret_cast<const ModelSequenceTableDecoder *>(modelSequenceDecoder),
+        *reinterpret_cast<const ModelResourceTableDecoder *>(modelResourceTableDecoder), options);
+    if (!plan.has_value()) {
+        return false;
+    }
+    const size_t count = std::min(capacity, plan->allocations.size());
+    for (size_t i = 0; i < count; ++i) {
+        const IntermediateAllocation &allocation = plan->allocations[i];
+        allocations[i] = {allocation.mrtIndex, allocation.offset, allocation.size, allocation.firstSegment,
+                          allocation.lastSegment};
+    }
+    *numAllocations = plan->allocations.size();
+    *peakBytes = plan->peakBytes;
+    return true;
+}
+
+/**********************************************************************************************************************/
+
+bool mlsdk_decoder_configure_verification_cache(bool enabled, const char *sidecarPath) {
+    VerificationCacheOptions options;
+    options.enabled = enabled;
+    options.sidecarPath = sidecarPath == nullptr ? "" : sidecarPath;
+    return ConfigureVerificationCache(options);
+}
+
+void mlsdk_decoder_invalidate_verification_cache() { InvalidateVerificationCache(); }
+
+void mlsdk_decoder_get_verification_cache_stats(mlsdk_decoder_verification_cache_stats *stats) {
+    assert(stats != nullptr && "stats is null");
+    const VerificationCacheStats cacheStats = GetVerificationCacheStats();
+    stats->hits = cacheStats.hits;
+    stats->misses = cacheStats.misses;
+}
@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "vgf/decoder.hpp"
+#include "vgf/decoder_views.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace mlsdk::vgflib {
+
+/// \brief Returns the view of a segment, verified as the decoder's own getters would
+///
+/// \param decoder Model sequence decoder created by this library
+/// \param segmentIdx Index of the segment
+SegmentView GetSegmentView(const ModelSequenceTableDecoder &decoder, uint32_t segmentIdx);
+
+/// \brief Returns the view of a model resource table entry, verified as the decoder's own getters would
+///
+/// \param decoder Model resource table decoder created by this library
+/// \param idx Index of the entry
+ModelResourceEntryView GetModelResourceEntryView(const ModelResourceTableDecoder &decoder, uint32_t idx);
+
+/// \brief Returns the size of the version, count and metadata records at the start of a constant section
+///
+/// \param prefix First CONSTANT_SECTION_METADATA_OFFSET bytes of the section
+/// \param sectionSize Size of the whole section
+/// \return std::nullopt for legacy sections, which cannot be read without their payload, or invalid counts
+std::optional<uint64_t> GetConstantMetaDataSize(const void *prefix, uint64_t sectionSize);
+
+/// \brief Returns a view over the metadata records of a constant section, verified against the size of the section
+///
+/// The payload is not read, so only the metadata accessors and dataOffset and dataSize of the view may be used.
+///
+/// \param metaData First GetConstantMetaDataSize bytes of the section
+/// \param sectionSize Size of the whole section
+std::optional<ConstantView> CreateConstantMetaDataView(const void *metaData, uint64_t sectionSize);
+
+} // namespace mlsdk::vgflib
@@ -114,6 +114,27 @@ void pyInitHeaderDecoder(py::module m) {
         },
         py::keep_alive<0, 1>(), py::arg("data"), py::arg("headerSize"), py::arg("fileSize"));
 
+    py::enum_<SectionName>(m, "SectionName")
+        .value("Modules", SectionName::MODULES)
+        .value("ModelSequence", SectionName::MODEL_SEQUENCE)
+        .value("Resources", SectionName::RESOURCES)
+        .value("Constants", SectionName::CONSTANTS);
+    py::enum_<IntegrityStatus>(m, "IntegrityStatus")
+        .value("Valid", IntegrityStatus::VALID)
+        .value("Corrupted", IntegrityStatus::CORRUPTED)
+        .value("NoChecksums", IntegrityStatus::NO_CHECKSUMS)
+        .value("InvalidFile", IntegrityStatus::INVALID_FILE);
+    m.def(
+        "CheckSectionIntegrity",
+        [](const py::buffer &buffer, uint64_t size, SectionName section) {
+            return CheckSectionIntegrity(buffer.request().ptr, size, section);
+        },
+        py::arg("data"), py::arg("size"), py::arg("section"));
+    m.def(
+        "CheckIntegrity",
+        [](const py::buffer &buffer, uint64_t size) { return CheckIntegrity(buffer.request().ptr, size); },
+        py::arg("data"), py::arg("size"));
+
     m.attr("HEADER_MAGIC_VALUE_OLD") = HEADER_MAGIC_VALUE_OLD;
     m.attr("HEADER_MAGIC_VALUE") = HEADER_MAGIC_VALUE;
     m.attr("HEADER_MAGIC_OFFSET") = HEADER_MAGIC_OFFSET;
@@ -248,8 +269,10 @@ void pyInitModuleTableDecoder(py::module m) {
     m.def("ModuleTableDecoderSize", &ModuleTableDecoderSize);
     m.def(
         "CreateModuleTableDecoder",
-        [](const py::buffer &buffer, uint64_t size) { return CreateModuleTableDecoder(buffer.request().ptr, size); },
-        py::keep_alive<0, 1>(), py::arg("data"), py::arg("size"));
+        [](const py::buffer &buffer, uint64_t size, VerificationMode mode) {
+            return CreateModuleTableDecoder(buffer.request().ptr, size, mode);
+        },
+        py::keep_alive<0, 1>(), py::arg("data"), py::arg("size"), py::arg("mode") = VerificationMode::FULL);
 }
 
 // Model Sequence Decoder
@@ -423,10 +446,10 @@ void pyInitModelSequenceTableDecoder(py::module m) {
     m.def("ModelSequenceTableDecoderSize", &ModelSequenceTableDecoderSize);
     m.def(
         "CreateModelSequenceTableDecoder",
-        [](const py::buffer &buffer, uint64_t size) {
-            return CreateModelSequenceTableDecoder(buffer.request().ptr, size);
+        [](const py::buffer &buffer, uint64_t size, VerificationMode mode) {
+            return CreateModelSequenceTableDecoder(buffer.request().ptr, size, mode);
         },
-        py::keep_alive<0, 1>(), py::arg("data"), py::arg("size"));
+        py::keep_alive<0, 1>(), py::arg("data"), py::arg("size"), py::arg("mode") = VerificationMode::FULL);
 }
 
 // Model Resource Table Decoder
@@ -461,6 +484,10 @@ class PyModelResourceTableDecoder final : public ModelResourceTableDecoder {
         PYBIND11_OVERRIDE_PURE(DataView<int64_t>, ModelResourceTableDecoder, getTensorStride, id);
     }
 
+    std::optional<TensorLayout> getTensorLayout(uint32_t id) const override {
+        PYBIND11_OVERRIDE_PURE(std::optional<TensorLayout>, ModelResourceTableDecoder, getTensorLayout, id);
+    }
+
     SamplerConfigHandle getSamplerConfigHandle(uint32_t id) const override {
         PYBIND11_OVERRIDE_PURE(SamplerConfigHandle, ModelResourceTableDecoder, getSamplerConfigHandle, id);
     }
@@ -487,6 +514,14 @@ class PyModelResourceTableDecoder final : public ModelResourceTableDecoder {
 };
 
 void pyInitModelResourceTableDecoder(py::module m) {
+    py::class_<TensorLayout>(m, "TensorLayout")
+        .def(py::init<>())
+        .def_readonly("elementCount", &TensorLayout::elementCount)
+        .def_readonly("elementSize", &TensorLayout::elementSize)
+        .def_readonly("packedByteSize", &TensorLayout::packedByteSize)
+        .def_readonly("spanByteSize", &TensorLayout::spanByteSize)
+        .def_readonly("contiguous", &TensorLayout::contiguous);
+
     py::class_<ModelResourceTableDecoder, PyModelResourceTableDecoder>(m, "ModelResourceTableDecoder")
         .def(py::init<>())
         .def("size", &ModelResourceTableDecoder::size)
@@ -506,6 +541,7 @@ void pyInitModelResourceTableDecoder(py::module m) {
                 return pyDataView<int64_t>(decoder.getTensorStride(id));
             },
             py::arg("id"))
+        .def("getTensorLayout", &ModelResourceTableDecoder::getTensorLayout, py::arg("id"))
         .def("getSamplerConfigHandle", &ModelResourceTableDecoder::getSamplerConfigHandle, py::arg("id"),
              py::return_value_policy::reference)
         .def("getSamplerConfigMinFilter", &ModelResourceTableDecoder::getSamplerConfigMinFilter, py::arg("handle"))
@@ -519,10 +555,10 @@ void pyInitModelResourceTableDecoder(py::module m) {
     m.def("ModelResourceTableDecoderSize", &ModelResourceTableDecoderSize);
     m.def(
         "CreateModelResourceTableDecoder",
-        [](const py::buffer &buffer, uint64_t size) {
-            return CreateModelResourceTableDecoder(buffer.request().ptr, size);
+        [](const py::buffer &buffer, uint64_t size, VerificationMode mode) {
+            return CreateModelResourceTableDecoder(buffer.request().ptr, size, mode);
         },
-        py::keep_alive<0, 1>(), py::arg("data"), py::arg("size"));
+        py::keep_alive<0, 1>(), py::arg("data"), py::arg("size"), py::arg("mode") = VerificationMode::FULL);
 }
 
 // Constant Decoder
@@ -548,6 +584,14 @@ class PyConstantDecoder final : public ConstantDecoder {
     DataView<uint8_t> getConstant(uint32_t idx) const override {
         PYBIND11_OVERRIDE_PURE(DataView<uint8_t>, ConstantDecoder, getConstant, idx);
     }
+
+    uint64_t getConstantAlignment(uint32_t idx) const override {
+        PYBIND11_OVERRIDE_PURE(uint64_t, ConstantDecoder, getConstantAlignment, idx);
+    }
+
+    bool isConstantAligned(uint32_t idx, uint64_t sectionOffset, uint64_t alignment) const override {
+        PYBIND11_OVERRIDE_PURE(bool, ConstantDecoder, isConstantAligned, idx, sectionOffset, alignment);
+    }
 };
 
 void pyInitConstantDecoder(py::module m) {
@@ -558,6 +602,9 @@ void pyInitConstantDecoder(py::module m) {
         .def("getConstantMrtIndex", &ConstantDecoder::getConstantMrtIndex, py::arg("idx"))
         .def("isSparseConstant", &ConstantDecoder::isSparseConstant, py::arg("idx"))
         .def("getConstantSparsityDimension", &ConstantDecoder::getConstantSparsityDimension, py::arg("idx"))
+        .def("getConstantAlignment", &ConstantDecoder::getConstantAlignment, py::arg("idx"))
+        .def("isConstantAligned", &ConstantDecoder::isConstantAligned, py::arg("idx"), py::arg("sectionOffset"),
+             py::arg("alignment"))
         .def(
             "getConstant",
             [&](const ConstantDecoder &decoder, uint32_t idx) { return pyDataView<uint8_t>(decoder.getConstant(idx)); },
@@ -570,6 +617,28 @@ void pyInitConstantDecoder(py::module m) {
         py::keep_alive<0, 1>(), py::arg("data"), py::arg("size"));
 }
 
+// Memory Planner
+
+void pyInitMemoryPlanner(py::module m) {
+    py::class_<MemoryPlanOptions>(m, "MemoryPlanOptions")
+        .def(py::init<>())
+        .def_readwrite("alignment", &MemoryPlanOptions::alignment);
+    py::class_<IntermediateAllocation>(m, "IntermediateAllocation")
+        .def(py::init<>())
+        .def_readonly("mrtIndex", &IntermediateAllocation::mrtIndex)
+        .def_readonly("offset", &IntermediateAllocation::offset)
+        .def_readonly("size", &IntermediateAllocation::size)
+        .def_readonly("firstSegment", &IntermediateAllocation::firstSegment)
+        .def_readonly("lastSegment", &IntermediateAllocation::lastSegment);
+    py::class_<MemoryPlan>(m, "MemoryPlan")
+        .def(py::init<>())
+        .def_readonly("allocations", &MemoryPlan::allocations)
+        .def_readonly("peakBytes", &MemoryPlan::peakBytes)
+        .def_readonly("totalBytes", &MemoryPlan::totalBytes);
+    m.def("PlanIntermediateMemory", &PlanIntermediateMemory, py::arg("modelSequenceTable"),
+          py::arg("modelResourceTable"), py::arg("options") = MemoryPlanOptions{});
+}
+
 // Python Binding Module Decoder Setup
 
 void pyInitDecoder(py::module m) {
@@ -579,9 +648,26 @@ void pyInitDecoder(py::module m) {
     py::class_<PushConstantRangeHandle_s>(m, "PushConstantRangeHandle_s").def(py::init<>());
     py::class_<SamplerConfigHandle_s>(m, "SamplerConfigHandle_s");
 
+    py::enum_<VerificationMode>(m, "VerificationMode")
+        .value("Full", VerificationMode::FULL)
+        .value("Lazy", VerificationMode::LAZY);
+
+    py::class_<VerificationCacheOptions>(m, "VerificationCacheOptions")
+        .def(py::init<>())
+        .def_readwrite("enabled", &VerificationCacheOptions::enabled)
+        .def_readwrite("sidecarPath", &VerificationCacheOptions::sidecarPath);
+    py::class_<VerificationCacheStats>(m, "VerificationCacheStats")
+        .def(py::init<>())
+        .def_readonly("hits", &VerificationCacheStats::hits)
+        .def_readonly("misses", &VerificationCacheStats::misses);
+    m.def("ConfigureVerificationCache", &ConfigureVerificationCache, py::arg("options"));
+    m.def("InvalidateVerificationCache", &InvalidateVerificationCache);
+    m.def("GetVerificationCacheStats", &GetVerificationCacheStats);
+
     pyInitHeaderDecoder(m);
     pyInitModuleTableDecoder(m);
     pyInitModelSequenceTableDecoder(m);
     pyInitModelResourceTableDecoder(m);
     pyInitConstantDecoder(m);
+    pyInitMemoryPlanner(m);
 }
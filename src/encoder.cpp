@@ -6,18 +6,24 @@
 #include "vgf/encoder.hpp"
 
 #include "constant.hpp"
+#include "crc32c.hpp"
 #include "header.hpp"
 #include "internal_logging.hpp"
 #include "internal_types.hpp"
+#include "positional_writer.hpp"
 #include "section_index_table.hpp"
 #include "utils.hpp"
 #include "vgf_generated.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <limits>
 #include <list>
+#include <memory>
+#include <unordered_map>
 
 namespace mlsdk::vgflib {
 
@@ -63,12 +69,32 @@ VGF::ResourceCategory toVGF(ResourceCategory category) {
     }
 }
 
+bool movePayload(std::iostream &stream, uint64_t offset, uint64_t size, uint64_t shift) {
+    constexpr uint64_t MOVE_CHUNK_SIZE = 1024 * 1024;
+    std::vector<char> chunk(static_cast<size_t>(std::min(size, MOVE_CHUNK_SIZE)));
+    // Copy from the end so the destination never overwrites data not yet moved
+    uint64_t remaining = size;
+    while (remaining > 0 && !stream.fail()) {
+        const uint64_t chunkSize = std::min<uint64_t>(remaining, chunk.size());
+        remaining -= chunkSize;
+        stream.seekg(static_cast<std::streamoff>(offset + remaining));
+        stream.read(chunk.data(), static_cast<std::streamsize>(chunkSize));
+        stream.seekp(static_cast<std::streamoff>(offset + remaining + shift));
+        stream.write(chunk.data(), static_cast<std::streamsize>(chunkSize));
+    }
+    return !stream.fail();
+}
+
 } // namespace
 
-class EncoderImpl : public Encoder {
+class EncoderImpl : public StreamingEncoder {
   public:
     explicit EncoderImpl(uint16_t vkHeaderVersion) : vkHeaderVersion_(vkHeaderVersion) {}
 
+    /// Streaming mode: constant payloads are appended to stream starting at streamPayloadOffset
+    EncoderImpl(uint16_t vkHeaderVersion, std::unique_ptr<std::fstream> stream, uint64_t streamPayloadOffset)
+        : stream_(std::move(stream)), streamPayloadOffset_(streamPayloadOffset), vkHeaderVersion_(vkHeaderVersion) {}
+
     ModuleRef AddModule(ModuleType type, const std::string &name, const std::string &entryPoint,
                         const std::vector<uint32_t> &code) override {
         assert(!finished_ && "cannot add modules when marked finished");
@@ -283,53 +309,426 @@ class EncoderImpl : public Encoder {
         resourceRecord.aliasGroupId = aliasGroupId;
     }
 
+    void SetConstantAlignment(uint64_t alignment) override {
+        assert(!finished_ && "cannot set constant alignment when marked finished");
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            logging::error("Constant alignment " + std::to_string(alignment) + " is not a power of two");
+            return;
+        }
+        constantAlignment_ = std::max(alignment, CONSTANT_DEFAULT_ALIGNMENT);
+    }
+
     ConstantRef AddConstant(ResourceRef resourceRef, const void *data, size_t sizeInBytes,
                             int64_t sparsityDimension) override {
         assert(!finished_ && "cannot add constants when marked finished");
         assert(data && "data pointer cannot be nullptr");
         assert(sizeInBytes > 0 && "sizeInBytes cannot be zero");
 
-        constexpr auto MIN_SPARSITY_DIM = INT32_MIN_VALUE;
-        constexpr auto MAX_SPARSITY_DIM = INT32_MAX_VALUE;
-        int32_t sparsityDim32{};
-        if (sparsityDimension < MIN_SPARSITY_DIM || sparsityDimension > MAX_SPARSITY_DIM) {
-            logging::error("sparsityDimension must fit in int32_t for on-disk metadata; clamping to range");
-            sparsityDim32 = static_cast<int32_t>(
-                std::clamp<int64_t>(sparsityDimension, int64_t{MIN_SPARSITY_DIM}, int64_t{MAX_SPARSITY_DIM}));
+        ConstantPayload payload;
+        payload.borrowedData = static_cast<const uint8_t *>(data);
+        return AppendConstant(resourceRef, sizeInBytes, sparsityDimension, std::move(payload), true);
+    }
+
+    ConstantRef AddBorrowedConstant(ResourceRef resourceRef, const void *data, size_t sizeInBytes,
+                                    int64_t sparsityDimension, std::shared_ptr<const void> owner) override {
+        assert(!finished_ && "cannot add constants when marked finished");
+        assert(data && "data pointer cannot be nullptr");
+        assert(sizeInBytes > 0 && "sizeInBytes cannot be zero");
+
+        ConstantPayload payload;
+        payload.borrowedData = static_cast<const uint8_t *>(data);
+        payload.owner = std::move(owner);
+        return AppendConstant(resourceRef, sizeInBytes, sparsityDimension, std::move(payload), false);
+    }
+
+    void SetParallelFinish(bool enable) override {
+        assert(!finished_ && "cannot set parallel finish when marked finished");
+        parallelFinish_ = enable;
+    }
+
+    void SetSectionChecksums(bool enable) override {
+        assert((stream_ == nullptr || constsMetaData_.empty()) &&
+               "streaming encoders must set section checksums before adding constants");
+        sectionChecksums_ = enable;
+    }
+
+    void Finish() override {
+        assert(!finished_ && "already marked finished");
+
+        // No constants can be added once finished, so the deduplication index is no longer needed
+        storedConstants_.clear();
+
+        if (parallelFinish_) {
+            // Each section has its own builder and only reads the recorded encoder state, so the output does not
+            // depend on how the threads are scheduled
+            auto modelResourceFinished = std::async(std::launch::async, [this] { FinishModelResourceSection(); });
+            auto modelSequenceFinished = std::async(std::launch::async, [this] { FinishModelSequenceSection(); });
+            FinishModuleSection();
+            modelResourceFinished.get();
+            modelSequenceFinished.get();
         } else {
-            sparsityDim32 = static_cast<int32_t>(sparsityDimension);
+            FinishModuleSection();
+            FinishModelResourceSection();
+            FinishModelSequenceSection();
         }
+        finished_ = true;
+    }
 
-        uint64_t nextDataOffset = constDataOffset_;
-        const auto constantDataRange =
-            appendAlignedByteRange(static_cast<uint64_t>(sizeInBytes), sizeof(uint64_t), nextDataOffset);
-        if (!constantDataRange.has_value()) {
-            logging::error("Constant data section size exceeds addressable on-disk metadata size");
-            encodingFailed_ = true;
-            return {UINT32_MAX_VALUE};
+    bool WriteTo(std::ostream &output) override {
+        assert(finished_ && "cannot write if encoding is not marked finished");
+        logging::debug("Writing VGF model to output stream");
+        FileLayout layout;
+        if (!CanWriteFile("WriteTo") || !CanWriteConstants("WriteTo") || !ComputeFileLayout(layout)) {
+            return false;
         }
-        const auto &[dataRange, paddedSize] = *constantDataRange;
+        const std::vector<uint8_t> constantMetaData = SerializeConstantSectionMetaData();
+        Header header(*layout.module, *layout.modelSequence, *layout.modelResource, *layout.constant,
+                      vkHeaderVersion_, ComputeSectionChecksums(constantMetaData));
 
-        constsMetaData_.emplace_back(ConstantMetaDataV00{
-            resourceRef.reference,
-            sparsityDim32,
-            dataRange.size,
-            dataRange.offset,
-        });
+        if (!layout.header->Write(output, &header)) {
+            logging::error("Failed to write header section");
+            return false;
+        }
+        if (!layout.module->Write(output, moduleBuilder_.GetBufferPointer())) {
+            logging::error("Failed to write module section");
+            return false;
+        }
+        if (!layout.modelSequence->Write(output, modelSequenceBuilder_.GetBufferPointer())) {
+            logging::error("Failed to write model sequence section");
+            return false;
+        }
+        if (!layout.modelResource->Write(output, modelResourceBuilder_.GetBufferPointer())) {
+            logging::error("Failed to write model resource section");
+            return false;
+        }
 
-        auto &constantData = constsData_.emplace_back(static_cast<size_t>(paddedSize), 0);
-        std::memcpy(constantData.data(), data, sizeInBytes);
-        constDataOffset_ = nextDataOffset;
+        output.write(reinterpret_cast<const char *>(constantMetaData.data()),
+                     static_cast<std::streamsize>(constantMetaData.size()));
+        constantsReleased_ = true;
+        for (auto &constsData : constsData_) {
+            writeZeroPadding(output, constsData.leadingPadding);
+            output.write(reinterpret_cast<const char *>(constsData.data()),
+                         static_cast<std::streamsize>(constsData.size));
+            writeZeroPadding(output, constsData.padding);
+            // Releasing each constant immediately after writing it to disk to release memory
+            constsData = {};
+            if (output.fail()) {
+                logging::error("Failed to write constant section, rdstate: " +
+                               std::string(rdStateToStr(output.rdstate())));
+                return false;
+            }
+        }
+        constsData_.clear();
 
-        return {static_cast<uint32_t>(constsMetaData_.size() - 1)};
+        return true;
     }
 
-    void Finish() override {
-        assert(!finished_ && "already marked finished");
+    bool WriteToFile(const std::string &path, uint32_t numThreads) override {
+        assert(finished_ && "cannot write if encoding is not marked finished");
+        logging::debug("Writing VGF model to " + path);
+        FileLayout layout;
+        if (!CanWriteFile("WriteToFile") || !CanWriteConstants("WriteToFile") || !ComputeFileLayout(layout)) {
+            return false;
+        }
+        const std::vector<uint8_t> constantMetaData = SerializeConstantSectionMetaData();
+        const Header header(*layout.module, *layout.modelSequence, *layout.modelResource, *layout.constant,
+                            vkHeaderVersion_, ComputeSectionChecksums(constantMetaData));
+
+        // Every offset is known up front, so each section and constant payload is written in place
+        const bool written = writeExtentsToFile(path, layout.constant->EndOfData(),
+                                                CollectWriteExtents(layout, header, constantMetaData), numThreads);
+        constsData_.clear();
+        constantsReleased_ = true;
+        return written;
+    }
+
+    uint64_t GetEncodedSize() const override {
+        assert(finished_ && "cannot compute the encoded size if encoding is not marked finished");
+        FileLayout layout;
+        if (!CanWriteFile("GetEncodedSize") || !ComputeFileLayout(layout)) {
+            return 0;
+        }
+        return layout.constant->EndOfData();
+    }
+
+    bool WriteTo(void *dst, size_t capacity) override {
+        assert(finished_ && "cannot write if encoding is not marked finished");
+        assert(dst != nullptr && "destination is null");
+        logging::debug("Writing VGF model to memory");
+        FileLayout layout;
+        if (!CanWriteFile("WriteTo") || !CanWriteConstants("WriteTo") || !ComputeFileLayout(layout)) {
+            return false;
+        }
+        const uint64_t encodedSize = layout.constant->EndOfData();
+        if (encodedSize > capacity) {
+            logging::error("Destination capacity " + std::to_string(capacity) + " is smaller than the encoded size " +
+                           std::to_string(encodedSize));
+            return false;
+        }
+        const std::vector<uint8_t> constantMetaData = SerializeConstantSectionMetaData();
+        const Header header(*layout.module, *layout.modelSequence, *layout.modelResource, *layout.constant,
+                            vkHeaderVersion_, ComputeSectionChecksums(constantMetaData));
+
+        auto *output = static_cast<uint8_t *>(dst);
+        uint64_t position = 0;
+        for (const auto &extent : CollectWriteExtents(layout, header, constantMetaData)) {
+            std::memset(output + position, 0, static_cast<size_t>(extent.offset - position));
+            std::memcpy(output + extent.offset, extent.data, static_cast<size_t>(extent.size));
+            position = extent.offset + extent.size;
+        }
+        std::memset(output + position, 0, static_cast<size_t>(encodedSize - position));
+        constsData_.clear();
+        constantsReleased_ = true;
+        return true;
+    }
+
+    bool Close() override {
+        assert(finished_ && "cannot close if encoding is not marked finished");
+        if (stream_ == nullptr) {
+            logging::error("Close is only supported by streaming encoders");
+            return false;
+        }
+        logging::debug("Closing streamed VGF model");
+        std::unique_ptr<std::fstream> stream = std::move(stream_);
+        if (encodingFailed_) {
+            logging::error("Cannot write VGF model after encoder failed");
+            return false;
+        }
+        std::fstream &output = *stream;
+
+        const auto constantHeaderAndMetadataSize = ConstantSectionMetaDataSize();
+        if (!constantHeaderAndMetadataSize.has_value()) {
+            logging::error("Constant section size exceeds addressable on-disk metadata size");
+            return false;
+        }
+
+        // Constant metadata must directly precede the payloads. If more constants were added than reserved for,
+        // move the streamed payloads once to make room.
+        uint64_t payloadOffset = streamPayloadOffset_;
+        const uint64_t reservedSize = payloadOffset - sizeof(Header);
+        if (*constantHeaderAndMetadataSize > reservedSize) {
+            // Keep the shift a multiple of every constant alignment
+            const auto shift = checkedAlignUp(*constantHeaderAndMetadataSize - reservedSize, maxConstantAlignment_);
+            if (!shift.has_value()) {
+                logging::error("Constant section size exceeds addressable on-disk metadata size");
+                return false;
+            }
+            logging::debug("Constant count exceeds the reserved metadata table, moving payloads by " +
+                           std::to_string(*shift) + " bytes");
+            if (!movePayload(output, payloadOffset, constDataOffset_, *shift)) {
+                logging::error("Failed to move streamed constant payloads, rdstate: " +
+                               std::string(rdStateToStr(output.rdstate())));
+                return false;
+            }
+            payloadOffset += *shift;
+        }
+        const uint64_t constantSectionOffset = payloadOffset - *constantHeaderAndMetadataSize;
+        const SectionEntry constantSection(constantSectionOffset, *constantHeaderAndMetadataSize + constDataOffset_);
+
+        // The header, reserved space and constants section are laid out first, the metadata sections follow
+        SectionIndexTable table;
+        const auto &streamedSection =
+            table.AddSection(payloadOffset + constDataOffset_, VGF_SECTION_ALIGNMENT_VALUE);
+        const auto &moduleSection = table.AddSection(moduleBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
+        const auto &modelSequenceSection =
+            table.AddSection(modelSequenceBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
+        const auto &modelResourceSection =
+            table.AddSection(modelResourceBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
+
+        // calculate alignments and offsets
+        table.Update();
+
+        const std::vector<uint8_t> constantMetaData = SerializeConstantSectionMetaData();
+        output.seekp(static_cast<std::streamoff>(constantSectionOffset));
+        output.write(reinterpret_cast<const char *>(constantMetaData.data()),
+                     static_cast<std::streamsize>(constantMetaData.size()));
+        if (output.fail()) {
+            logging::error("Failed to write constant section metadata, rdstate: " +
+                           std::string(rdStateToStr(output.rdstate())));
+            return false;
+        }
+
+        output.seekp(static_cast<std::streamoff>(streamedSection.NextOffset()));
+        if (!moduleSection.Write(output, moduleBuilder_.GetBufferPointer())) {
+            logging::error("Failed to write module section");
+            return false;
+        }
+        if (!modelSequenceSection.Write(output, modelSequenceBuilder_.GetBufferPointer())) {
+            logging::error("Failed to write model sequence section");
+            return false;
+        }
+        if (!modelResourceSection.Write(output, modelResourceBuilder_.GetBufferPointer())) {
+            logging::error("Failed to write model resource section");
+            return false;
+        }
+
+        Header header(moduleSection, modelSequenceSection, modelResourceSection, constantSection, vkHeaderVersion_,
+                      ComputeSectionChecksums(constantMetaData));
+        output.seekp(0);
+        output.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+        output.close();
+        if (output.fail()) {
+            logging::error("Failed to write header section, rdstate: " + std::string(rdStateToStr(output.rdstate())));
+            return false;
+        }
 
+        return true;
+    }
+
+  private:
+    /// Placement of the sections of a non-streamed VGF file. The section pointers refer into the table.
+    struct FileLayout {
+        SectionIndexTable table;
+        const SectionIndexTable::SectionIndex *header = nullptr;
+        const SectionIndexTable::SectionIndex *module = nullptr;
+        const SectionIndexTable::SectionIndex *modelSequence = nullptr;
+        const SectionIndexTable::SectionIndex *modelResource = nullptr;
+        const SectionIndexTable::SectionIndex *constant = nullptr;
+    };
+
+    /// Non-streamed output needs a healthy, non-streaming encoder
+    bool CanWriteFile(const std::string &operation) const {
+        if (stream_ != nullptr) {
+            logging::error(operation + " is not supported by streaming encoders, use Close instead");
+            return false;
+        }
+        if (encodingFailed_) {
+            logging::error("Cannot write VGF model after encoder failed");
+            return false;
+        }
+        return true;
+    }
+
+    /// The constant payloads are released as they are written, so the model can only be written once
+    bool CanWriteConstants(const std::string &operation) const {
+        if (constantsReleased_) {
+            logging::error(operation + " cannot write VGF model more than once, its constants were released");
+            return false;
+        }
+        return true;
+    }
+
+    /// Returns the sections and constant payloads with their file offsets, in file order
+    std::vector<WriteExtent> CollectWriteExtents(const FileLayout &layout, const Header &header,
+                                                 const std::vector<uint8_t> &constantMetaData) const {
+        std::vector<WriteExtent> extents{
+            {layout.header->GetOffset(), &header, sizeof(Header)},
+            {layout.module->GetOffset(), moduleBuilder_.GetBufferPointer(), moduleBuilder_.GetSize()},
+            {layout.modelSequence->GetOffset(), modelSequenceBuilder_.GetBufferPointer(),
+             modelSequenceBuilder_.GetSize()},
+            {layout.modelResource->GetOffset(), modelResourceBuilder_.GetBufferPointer(),
+             modelResourceBuilder_.GetSize()},
+            {layout.constant->GetOffset(), constantMetaData.data(), constantMetaData.size()},
+        };
+        extents.reserve(extents.size() + constsData_.size());
+        uint64_t payloadOffset = layout.constant->GetOffset() + constantMetaData.size();
+        for (const auto &constsData : constsData_) {
+            payloadOffset += constsData.leadingPadding;
+            extents.push_back({payloadOffset, constsData.data(), constsData.size});
+            payloadOffset += constsData.size + constsData.padding;
+        }
+        return extents;
+    }
+
+    bool ComputeFileLayout(FileLayout &layout) const {
+        SectionIndexTable &table = layout.table;
+        layout.header = &table.AddSection(sizeof(Header), VGF_SECTION_ALIGNMENT_VALUE);
+        layout.module = &table.AddSection(moduleBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
+        layout.modelSequence = &table.AddSection(modelSequenceBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
+        layout.modelResource = &table.AddSection(modelResourceBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
+
+        const auto constantHeaderAndMetadataSize = ConstantSectionMetaDataSize();
+        const auto constantSectionSize = constantHeaderAndMetadataSize.has_value()
+                                             ? checkedAdd(*constantHeaderAndMetadataSize, constDataOffset_)
+                                             : std::optional<uint64_t>{};
+        if (!constantSectionSize.has_value()) {
+            logging::error("Constant section size exceeds addressable on-disk metadata size");
+            return false;
+        }
+        // Align the start of the payloads, which the constant offsets are relative to
+        layout.constant =
+            &table.AddSection(*constantSectionSize, maxConstantAlignment_, *constantHeaderAndMetadataSize);
+
+        // calculate alignments and offsets
+        table.Update();
+        return true;
+    }
+
+    /// Returns the size of the constants section preceding the payloads: version, count and metadata table
+    std::optional<uint64_t> ConstantSectionMetaDataSize() const {
+        const auto constantMetadataSize = checkedMul(static_cast<uint64_t>(constsMetaData_.size()),
+                                                     UsesConstantAlignment() ? sizeof(ConstantMetaDataV01)
+                                                                             : sizeof(ConstantMetaDataV00));
+        return constantMetadataSize.has_value() ? checkedAdd(CONSTANT_SECTION_METADATA_OFFSET, *constantMetadataSize)
+                                                : std::optional<uint64_t>{};
+    }
+
+    /// The V01 layout is only needed when a constant requires more than the default alignment
+    bool UsesConstantAlignment() const { return maxConstantAlignment_ > CONSTANT_DEFAULT_ALIGNMENT; }
+
+    /// Returns the constants section preceding the payloads: version, count and metadata table
+    std::vector<uint8_t> SerializeConstantSectionMetaData() const {
+        const auto numConsts = static_cast<uint64_t>(constsMetaData_.size());
+        const bool aligned = UsesConstantAlignment();
+        const size_t recordSize = aligned ? sizeof(ConstantMetaDataV01) : sizeof(ConstantMetaDataV00);
+        std::vector<uint8_t> metaData(CONSTANT_SECTION_METADATA_OFFSET + constsMetaData_.size() * recordSize);
+
+        std::memcpy(metaData.data() + CONSTANT_SECTION_VERSION_OFFSET,
+                    aligned ? CONSTANT_SECTION_VERSION_V01 : CONSTANT_SECTION_VERSION, CONSTANT_SECTION_VERSION_SIZE);
+        std::memcpy(metaData.data() + CONSTANT_SECTION_COUNT_OFFSET, &numConsts, CONSTANT_SECTION_COUNT_SIZE);
+        uint8_t *records = metaData.data() + CONSTANT_SECTION_METADATA_OFFSET;
+        if (aligned) {
+            std::memcpy(records, constsMetaData_.data(), constsMetaData_.size() * sizeof(ConstantMetaDataV01));
+            return metaData;
+        }
+        for (const auto &record : constsMetaData_) {
+            const ConstantMetaDataV00 metaDataV00{record.mrtIndex, record.sparsityDimension, record.size,
+                                                  record.offset};
+            std::memcpy(records, &metaDataV00, sizeof(ConstantMetaDataV00));
+            records += sizeof(ConstantMetaDataV00);
+        }
+        return metaData;
+    }
+
+    /// Returns the header checksums of the sections, all zero when checksums are disabled
+    SectionChecksums ComputeSectionChecksums(const std::vector<uint8_t> &constantMetaData) const {
+        if (!sectionChecksums_) {
+            return {};
+        }
+        uint32_t payloadChecksum = streamPayloadChecksum_;
+        if (stream_ == nullptr) {
+            for (const auto &constsData : constsData_) {
+                payloadChecksum = crc32cZeros(payloadChecksum, constsData.leadingPadding);
+                payloadChecksum = crc32c(payloadChecksum, constsData.data(), constsData.size);
+                payloadChecksum = crc32cZeros(payloadChecksum, constsData.padding);
+            }
+        }
+
+        SectionChecksums checksums;
+        checksums.module = crc32c(0, moduleBuilder_.GetBufferPointer(), moduleBuilder_.GetSize());
+        checksums.sequence = crc32c(0, modelSequenceBuilder_.GetBufferPointer(), modelSequenceBuilder_.GetSize());
+        checksums.resource = crc32c(0, modelResourceBuilder_.GetBufferPointer(), modelResourceBuilder_.GetSize());
+        // The payloads directly follow the metadata in the constants section
+        checksums.constant = crc32cCombine(crc32c(0, constantMetaData.data(), constantMetaData.size()),
+                                           payloadChecksum, constDataOffset_);
+        checksums.type = HEADER_CHECKSUM_TYPE_CRC32C;
+        return checksums;
+    }
+
+    static uint32_t crc32cZeros(uint32_t crc, uint64_t size) {
+        static constexpr std::array<uint8_t, 4096> zeros{};
+        for (; size > 0; size -= std::min<uint64_t>(size, zeros.size())) {
+            crc = crc32c(crc, zeros.data(), std::min<uint64_t>(size, zeros.size()));
+        }
+        return crc;
+    }
+
+    void FinishModuleSection() {
         auto moduleSection = VGF::CreateModuleTable(moduleBuilder_, moduleBuilder_.CreateVector(modules_));
         moduleBuilder_.Finish(moduleSection);
+    }
 
+    void FinishModelResourceSection() {
         auto modelResourceTableEntries =
             modelResourceBuilder_.CreateVector<flatbuffers::Offset<VGF::ModelResourceTableEntry>>(
                 resourceRecords_.size(), [this](size_t i) {
@@ -356,7 +755,9 @@ class EncoderImpl : public Encoder {
                 });
         auto modelResourceTable = VGF::CreateModelResourceTable(modelResourceBuilder_, modelResourceTableEntries);
         modelResourceBuilder_.Finish(modelResourceTable);
+    }
 
+    void FinishModelSequenceSection() {
         auto modelSequenceInputOffsets = modelSequenceBuilder_.CreateVector<flatbuffers::Offset<VGF::BindingSlot>>(
             modelSequenceInputs_.size(), [this](size_t i) { return bindingSlots_[modelSequenceInputs_[i].reference]; });
 
@@ -375,82 +776,147 @@ class EncoderImpl : public Encoder {
             modelSequenceOutputOffsets, inputNamesOffsets, outputNamesOffsets);
 
         modelSequenceBuilder_.Finish(modelSequenceSection);
-        finished_ = true;
     }
 
-    bool WriteTo(std::ostream &output) override {
-        assert(finished_ && "cannot write if encoding is not marked finished");
-        logging::debug("Writing VGF model to output stream");
-        if (encodingFailed_) {
-            logging::error("Cannot write VGF model after encoder failed");
-            return false;
-        }
+    /// Constant payload, either copied into the encoder or borrowed from the caller. Padding is not stored.
+    struct ConstantPayload {
+        std::vector<uint8_t> ownedData;
+        const uint8_t *borrowedData = nullptr;
+        std::shared_ptr<const void> owner;
+        uint64_t leadingPadding = 0;
+        uint64_t size = 0;
+        uint64_t padding = 0;
 
-        SectionIndexTable table;
-        const auto &headerSection = table.AddSection(sizeof(Header), VGF_SECTION_ALIGNMENT_VALUE);
-        const auto &moduleSection = table.AddSection(moduleBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
-        const auto &modelSequenceSection =
-            table.AddSection(modelSequenceBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
-        const auto &modelResourceSection =
-            table.AddSection(modelResourceBuilder_.GetSize(), VGF_SECTION_ALIGNMENT_VALUE);
+        const uint8_t *data() const { return borrowedData != nullptr ? borrowedData : ownedData.data(); }
+    };
 
-        auto numConsts = static_cast<uint64_t>(constsMetaData_.size());
-        const auto constantMetadataSize = checkedMul(numConsts, sizeof(ConstantMetaDataV00));
-        const auto constantHeaderAndMetadataSize =
-            constantMetadataSize.has_value() ? checkedAdd(CONSTANT_SECTION_METADATA_OFFSET, *constantMetadataSize)
-                                             : std::optional<uint64_t>{};
-        const auto constantSectionSize = constantHeaderAndMetadataSize.has_value()
-                                             ? checkedAdd(*constantHeaderAndMetadataSize, constDataOffset_)
-                                             : std::optional<uint64_t>{};
-        if (!constantSectionSize.has_value()) {
-            logging::error("Constant section size exceeds addressable on-disk metadata size");
-            return false;
+    /// Payload already stored in the file, keyed by content hash for deduplication. payload is null when streaming.
+    struct StoredConstant {
+        uint32_t metaDataIndex;
+        const ConstantPayload *payload;
+    };
+
+    bool StoredPayloadEquals(const StoredConstant &stored, const uint8_t *data, uint64_t size) {
+        if (stored.payload != nullptr) {
+            return std::memcmp(stored.payload->data(), data, static_cast<size_t>(size)) == 0;
         }
-        const auto &constantSection = table.AddSection(*constantSectionSize, VGF_SECTION_ALIGNMENT_VALUE);
 
-        // calculate alignments and offsets
-        table.Update();
+        // The streamed payload is no longer in memory, so compare against the bytes already in the output file
+        constexpr uint64_t COMPARE_CHUNK_SIZE = 64 * 1024;
+        std::vector<char> chunk(static_cast<size_t>(std::min(size, COMPARE_CHUNK_SIZE)));
+        bool equal = true;
+        const uint64_t storedOffset = streamPayloadOffset_ + constsMetaData_[stored.metaDataIndex].offset;
+        stream_->seekg(static_cast<std::streamoff>(storedOffset));
+        for (uint64_t compared = 0; equal && compared < size;) {
+            const auto length = std::min<uint64_t>(size - compared, chunk.size());
+            stream_->read(chunk.data(), static_cast<std::streamsize>(length));
+            equal = !stream_->fail() && std::memcmp(chunk.data(), data + compared, static_cast<size_t>(length)) == 0;
+            compared += length;
+        }
+        stream_->clear();
+        stream_->seekp(0, std::ios::end);
+        return equal;
+    }
 
-        Header header(moduleSection, modelSequenceSection, modelResourceSection, constantSection, vkHeaderVersion_);
+    /// Find an identical payload that already satisfies the current constant alignment.
+    const ConstantMetaDataV01 *FindStoredConstant(uint64_t hash, const uint8_t *data, uint64_t size) {
+        const uint64_t payloadBase = stream_ != nullptr ? streamPayloadOffset_ : 0;
+        const auto [first, last] = storedConstants_.equal_range(hash);
+        for (auto it = first; it != last; ++it) {
+            const auto &metaData = constsMetaData_[it->second.metaDataIndex];
+            if (metaData.size == size && (payloadBase + metaData.offset) % constantAlignment_ == 0 &&
+                StoredPayloadEquals(it->second, data, size)) {
+                return &metaData;
+            }
+        }
+        return nullptr;
+    }
 
-        if (!headerSection.Write(output, &header)) {
-            logging::error("Failed to write header section");
-            return false;
+    ConstantRef AppendConstant(ResourceRef resourceRef, size_t sizeInBytes, int64_t sparsityDimension,
+                               ConstantPayload &&payload, bool copyData) {
+        constexpr auto MIN_SPARSITY_DIM = INT32_MIN_VALUE;
+        constexpr auto MAX_SPARSITY_DIM = INT32_MAX_VALUE;
+        int32_t sparsityDim32{};
+        if (sparsityDimension < MIN_SPARSITY_DIM || sparsityDimension > MAX_SPARSITY_DIM) {
+            logging::error("sparsityDimension must fit in int32_t for on-disk metadata; clamping to range");
+            sparsityDim32 = static_cast<int32_t>(
+                std::clamp<int64_t>(sparsityDimension, int64_t{MIN_SPARSITY_DIM}, int64_t{MAX_SPARSITY_DIM}));
+        } else {
+            sparsityDim32 = static_cast<int32_t>(sparsityDimension);
         }
-        if (!moduleSection.Write(output, moduleBuilder_.GetBufferPointer())) {
-            logging::error("Failed to write module section");
-            return false;
+
+        // Identical payloads are stored once and shared by several metadata records
+        const uint64_t hash = hashBytes(payload.data(), sizeInBytes);
+        if (const auto *stored = FindStoredConstant(hash, payload.data(), sizeInBytes); stored != nullptr) {
+            constsMetaData_.emplace_back(ConstantMetaDataV01{
+                resourceRef.reference,
+                sparsityDim32,
+                stored->size,
+                stored->offset,
+                constantAlignment_,
+            });
+            maxConstantAlignment_ = std::max(maxConstantAlignment_, constantAlignment_);
+            return {static_cast<uint32_t>(constsMetaData_.size() - 1)};
         }
-        if (!modelSequenceSection.Write(output, modelSequenceBuilder_.GetBufferPointer())) {
-            logging::error("Failed to write model sequence section");
-            return false;
+        if (copyData) {
+            payload.ownedData.assign(payload.borrowedData, payload.borrowedData + sizeInBytes);
+            payload.borrowedData = nullptr;
         }
-        if (!modelResourceSection.Write(output, modelResourceBuilder_.GetBufferPointer())) {
-            logging::error("Failed to write model resource section");
-            return false;
+
+        // Alignment applies to the file offset. Payloads are streamed from streamPayloadOffset_, otherwise WriteTo
+        // aligns the start of the payloads to maxConstantAlignment_.
+        const uint64_t payloadBase = stream_ != nullptr ? streamPayloadOffset_ : 0;
+        const auto alignedOffset = checkedAlignUp(payloadBase + constDataOffset_, constantAlignment_);
+        uint64_t nextDataOffset = alignedOffset.has_value() ? *alignedOffset - payloadBase : 0;
+        const auto constantDataRange =
+            alignedOffset.has_value()
+                ? appendAlignedByteRange(static_cast<uint64_t>(sizeInBytes), CONSTANT_DEFAULT_ALIGNMENT, nextDataOffset)
+                : std::nullopt;
+        if (!constantDataRange.has_value()) {
+            logging::error("Constant data section size exceeds addressable on-disk metadata size");
+            encodingFailed_ = true;
+            return {UINT32_MAX_VALUE};
         }
+        const auto &[dataRange, paddedSize] = *constantDataRange;
 
-        output.write(CONSTANT_SECTION_VERSION, CONSTANT_SECTION_VERSION_SIZE);
-        output.write(reinterpret_cast<const char *>(&numConsts), CONSTANT_SECTION_COUNT_SIZE);
-        output.write(reinterpret_cast<const char *>(constsMetaData_.data()),
-                     static_cast<std::streamsize>(numConsts * sizeof(ConstantMetaDataV00)));
-        for (auto &constsData : constsData_) {
-            output.write(reinterpret_cast<const char *>(constsData.data()),
-                         static_cast<std::streamsize>(constsData.size()));
-            // Erasing each constant immediately after writing it to disk to release memory
-            constsData.clear();
-            if (output.fail()) {
-                logging::error("Failed to write constant section, rdstate: " +
-                               std::string(rdStateToStr(output.rdstate())));
-                return false;
+        constsMetaData_.emplace_back(ConstantMetaDataV01{
+            resourceRef.reference,
+            sparsityDim32,
+            dataRange.size,
+            dataRange.offset,
+            constantAlignment_,
+        });
+        maxConstantAlignment_ = std::max(maxConstantAlignment_, constantAlignment_);
+
+        payload.leadingPadding = dataRange.offset - constDataOffset_;
+        payload.size = dataRange.size;
+        payload.padding = paddedSize - dataRange.size;
+        const auto metaDataIndex = static_cast<uint32_t>(constsMetaData_.size() - 1);
+        if (stream_ != nullptr) {
+            if (sectionChecksums_) {
+                // Streamed payloads are not kept in memory, so their checksum is accumulated as they are written
+                streamPayloadChecksum_ = crc32cZeros(streamPayloadChecksum_, payload.leadingPadding);
+                streamPayloadChecksum_ = crc32c(streamPayloadChecksum_, payload.data(), payload.size);
+                streamPayloadChecksum_ = crc32cZeros(streamPayloadChecksum_, payload.padding);
+            }
+            writeZeroPadding(*stream_, payload.leadingPadding);
+            stream_->write(reinterpret_cast<const char *>(payload.data()), static_cast<std::streamsize>(payload.size));
+            writeZeroPadding(*stream_, payload.padding);
+            if (stream_->fail()) {
+                logging::error("Failed to stream constant data, rdstate: " +
+                               std::string(rdStateToStr(stream_->rdstate())));
+                encodingFailed_ = true;
             }
+            storedConstants_.emplace(hash, StoredConstant{metaDataIndex, nullptr});
+        } else {
+            constsData_.emplace_back(std::move(payload));
+            storedConstants_.emplace(hash, StoredConstant{metaDataIndex, &constsData_.back()});
         }
-        constsData_.clear();
+        constDataOffset_ = nextDataOffset;
 
-        return true;
+        return {metaDataIndex};
     }
 
-  private:
     struct SamplerConfigRecord {
         uint32_t minFilter;
         uint32_t magFilter;
@@ -471,6 +937,9 @@ class EncoderImpl : public Encoder {
 
     bool finished_ = false;
     bool encodingFailed_ = false;
+    bool constantsReleased_ = false;
+    bool parallelFinish_ = false;
+    bool sectionChecksums_ = false;
     flatbuffers::FlatBufferBuilder moduleBuilder_;
     flatbuffers::FlatBufferBuilder modelSequenceBuilder_;
     flatbuffers::FlatBufferBuilder modelResourceBuilder_;
@@ -487,9 +956,16 @@ class EncoderImpl : public Encoder {
     std::vector<BindingSlotRef> modelSequenceOutputs_;
     std::vector<ModuleType> moduleRefToType_;
 
-    std::vector<ConstantMetaDataV00> constsMetaData_;
-    std::list<std::vector<uint8_t>> constsData_;
+    std::vector<ConstantMetaDataV01> constsMetaData_;
+    std::list<ConstantPayload> constsData_;
+    std::unordered_multimap<uint64_t, StoredConstant> storedConstants_;
     uint64_t constDataOffset_ = 0;
+    uint64_t constantAlignment_ = CONSTANT_DEFAULT_ALIGNMENT;
+    uint64_t maxConstantAlignment_ = CONSTANT_DEFAULT_ALIGNMENT;
+
+    std::unique_ptr<std::fstream> stream_;
+    uint64_t streamPayloadOffset_ = 0;
+    uint32_t streamPayloadChecksum_ = 0;
 
     uint16_t vkHeaderVersion_;
 };
@@ -498,4 +974,30 @@ std::unique_ptr<Encoder> CreateEncoder(uint16_t vkHeaderVersion) {
     return std::make_unique<EncoderImpl>(vkHeaderVersion);
 }
 
+std::unique_ptr<StreamingEncoder> CreateStreamingEncoder(const std::string &path, uint16_t vkHeaderVersion,
+                                                         uint64_t constantCountHint) {
+    const auto reservedMetadataSize = checkedMul(constantCountHint, sizeof(ConstantMetaDataV01));
+    constexpr uint64_t metadataOffset = sizeof(Header) + CONSTANT_SECTION_METADATA_OFFSET;
+    const auto payloadOffset = reservedMetadataSize.has_value() ? checkedAdd(metadataOffset, *reservedMetadataSize)
+                                                                : std::optional<uint64_t>{};
+    if (!payloadOffset.has_value() || !byteRangeCanBeAddressed({0, *payloadOffset})) {
+        logging::error("Constant count hint exceeds addressable on-disk metadata size");
+        return nullptr;
+    }
+
+    auto stream =
+        std::make_unique<std::fstream>(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!stream->is_open()) {
+        logging::error("Failed to open streaming encoder output " + path);
+        return nullptr;
+    }
+    // Placeholder for the header and the reserved constant metadata, both written by Close
+    writeZeroPadding(*stream, *payloadOffset);
+    if (stream->fail()) {
+        logging::error("Failed to write streaming encoder output " + path);
+        return nullptr;
+    }
+    return std::make_unique<EncoderImpl>(vkHeaderVersion, std::move(stream), *payloadOffset);
+}
+
 } // namespace mlsdk::vgflib
@@ -12,6 +12,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace mlsdk::vgflib;
@@ -20,6 +21,10 @@ struct mlsdk_encoder_s {
     explicit mlsdk_encoder_s(mlsdk_encoder_vk_header_version vkHeaderVersion)
         : encoder(CreateEncoder(vkHeaderVersion)) {}
 
+    explicit mlsdk_encoder_s(std::unique_ptr<StreamingEncoder> streamingEncoder)
+        : streaming(streamingEncoder.get()), encoder(std::move(streamingEncoder)) {}
+
+    StreamingEncoder *streaming = nullptr;
     std::unique_ptr<Encoder> encoder;
 };
 
@@ -104,6 +109,16 @@ mlsdk_encoder *mlsdk_encoder_create(mlsdk_encoder_vk_header_version vkHeaderVers
     return new mlsdk_encoder(vkHeaderVersion);
 }
 
+mlsdk_encoder *mlsdk_encoder_create_streaming(mlsdk_encoder_vk_header_version vkHeaderVersion, const char *path,
+                                              uint64_t constantCountHint) {
+    assert(path != nullptr && "path is null");
+    std::unique_ptr<StreamingEncoder> encoder = CreateStreamingEncoder(path, vkHeaderVersion, constantCountHint);
+    if (encoder == nullptr) {
+        return nullptr;
+    }
+    return new mlsdk_encoder(std::move(encoder));
+}
+
 void mlsdk_encoder_destroy(mlsdk_encoder *encoder) { delete encoder; }
 
 mlsdk_encoder_module_ref mlsdk_encoder_add_spirv_module(mlsdk_encoder *encoder, mlsdk_encoder_module_type type,
@@ -215,6 +230,11 @@ void mlsdk_encoder_set_alias_group(mlsdk_encoder *encoder, mlsdk_encoder_resourc
     encoder->encoder->SetAliasGroup(ResourceRef{resource.reference}, static_cast<AliasGroupId>(aliasGroupId));
 }
 
+void mlsdk_encoder_set_constant_alignment(mlsdk_encoder *encoder, uint64_t alignment) {
+    assert(encoder != nullptr && "encoder is null");
+    encoder->encoder->SetConstantAlignment(alignment);
+}
+
 mlsdk_encoder_constant_ref mlsdk_encoder_add_constant(mlsdk_encoder *encoder, mlsdk_encoder_resource_ref resource,
                                                       const void *data, size_t sizeInBytes, int64_t sparsityDimension) {
     assert(encoder != nullptr && "encoder is null");
@@ -222,6 +242,20 @@ mlsdk_encoder_constant_ref mlsdk_encoder_add_constant(mlsdk_encoder *encoder, ml
         encoder->encoder->AddConstant(ResourceRef{resource.reference}, data, sizeInBytes, sparsityDimension));
 }
 
+mlsdk_encoder_constant_ref mlsdk_encoder_add_borrowed_constant(mlsdk_encoder *encoder,
+                                                               mlsdk_encoder_resource_ref resource, const void *data,
+                                                               size_t sizeInBytes, int64_t sparsityDimension,
+                                                               mlsdk_encoder_release_callback release,
+                                                               void *userData) {
+    assert(encoder != nullptr && "encoder is null");
+    std::shared_ptr<const void> owner;
+    if (release != nullptr) {
+        owner = std::shared_ptr<const void>(userData, [release](const void *ptr) { release(const_cast<void *>(ptr)); });
+    }
+    return to_c_ref(encoder->encoder->AddBorrowedConstant(ResourceRef{resource.reference}, data, sizeInBytes,
+                                                          sparsityDimension, std::move(owner)));
+}
+
 mlsdk_encoder_binding_slot_ref mlsdk_encoder_add_binding_slot(mlsdk_encoder *encoder, uint32_t binding,
                                                               mlsdk_encoder_resource_ref resource) {
     assert(encoder != nullptr && "encoder is null");
@@ -280,6 +314,16 @@ void mlsdk_encoder_add_model_sequence_inputs_outputs(mlsdk_encoder *encoder,
         to_string_vector(outputNames, numOutputNames));
 }
 
+void mlsdk_encoder_set_parallel_finish(mlsdk_encoder *encoder, bool enable) {
+    assert(encoder != nullptr && "encoder is null");
+    encoder->encoder->SetParallelFinish(enable);
+}
+
+void mlsdk_encoder_set_section_checksums(mlsdk_encoder *encoder, bool enable) {
+    assert(encoder != nullptr && "encoder is null");
+    encoder->encoder->SetSectionChecksums(enable);
+}
+
 void mlsdk_encoder_finish(mlsdk_encoder *encoder) {
     assert(encoder != nullptr && "encoder is null");
     encoder->encoder->Finish();
@@ -288,6 +332,10 @@ void mlsdk_encoder_finish(mlsdk_encoder *encoder) {
 bool mlsdk_encoder_write_to_file(mlsdk_encoder *encoder, const char *path) {
     assert(encoder != nullptr && "encoder is null");
     assert(path != nullptr && "path is null");
+    if (encoder->streaming != nullptr) {
+        // Streaming encoders complete their own output file, see mlsdk_encoder_close
+        return false;
+    }
 
     std::ofstream output(path, std::ofstream::binary | std::ofstream::trunc);
     if (!output) {
@@ -295,3 +343,31 @@ bool mlsdk_encoder_write_to_file(mlsdk_encoder *encoder, const char *path) {
     }
     return encoder->encoder->WriteTo(output);
 }
+
+bool mlsdk_encoder_write_to_file_parallel(mlsdk_encoder *encoder, const char *path, uint32_t numThreads) {
+    assert(encoder != nullptr && "encoder is null");
+    assert(path != nullptr && "path is null");
+    if (encoder->streaming != nullptr) {
+        // Streaming encoders complete their own output file, see mlsdk_encoder_close
+        return false;
+    }
+
+    return encoder->encoder->WriteToFile(path, numThreads);
+}
+
+uint64_t mlsdk_encoder_get_encoded_size(mlsdk_encoder *encoder) {
+    assert(encoder != nullptr && "encoder is null");
+    return encoder->encoder->GetEncodedSize();
+}
+
+bool mlsdk_encoder_write_to_memory(mlsdk_encoder *encoder, void *dst, size_t capacity) {
+    assert(encoder != nullptr && "encoder is null");
+    assert(dst != nullptr && "dst is null");
+    return encoder->encoder->WriteTo(dst, capacity);
+}
+
+bool mlsdk_encoder_close(mlsdk_encoder *encoder) {
+    assert(encoder != nullptr && "encoder is null");
+    assert(encoder->streaming != nullptr && "encoder is not a streaming encoder");
+    return encoder->streaming->Close();
+}
@@ -5,15 +5,191 @@
 
 #include "vgf/encoder.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
 #include <limits>
+#include <memory>
+#include <ostream>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
-#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <vector>
+
+#ifdef _WIN32
+#    include <io.h>
+#else
+#    include <unistd.h>
+#endif
 
 namespace py = pybind11;
 
 using namespace mlsdk::vgflib;
 
+namespace {
+
+constexpr size_t WRITE_CHUNK_SIZE = 1024 * 1024;
+
+/// Stream buffer collecting small writes into a bounded buffer. Writes larger than the buffer bypass it, so
+/// constant payloads go to the sink straight from the encoder's memory.
+class ChunkedStreamBuf : public std::streambuf {
+  public:
+    ChunkedStreamBuf() : buffer_(WRITE_CHUNK_SIZE) { setp(buffer_.data(), buffer_.data() + buffer_.size()); }
+
+  protected:
+    /// Write all bytes to the sink, returning false on error
+    virtual bool WriteChunk(const char *data, size_t size) = 0;
+
+    int_type overflow(int_type ch) override {
+        if (!Flush()) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char *data, std::streamsize size) override {
+        if (size < epptr() - pptr()) {
+            std::memcpy(pptr(), data, static_cast<size_t>(size));
+            pbump(static_cast<int>(size));
+            return size;
+        }
+        if (!Flush()) {
+            return 0;
+        }
+        for (std::streamsize written = 0; written < size;) {
+            const auto chunk = std::min<std::streamsize>(size - written, WRITE_CHUNK_SIZE);
+            if (!WriteChunk(data + written, static_cast<size_t>(chunk))) {
+                return written;
+            }
+            written += chunk;
+        }
+        return size;
+    }
+
+    int sync() override { return Flush() ? 0 : -1; }
+
+  private:
+    bool Flush() {
+        const auto size = static_cast<size_t>(pptr() - pbase());
+        setp(buffer_.data(), buffer_.data() + buffer_.size());
+        return size == 0 || WriteChunk(buffer_.data(), size);
+    }
+
+    std::vector<char> buffer_;
+};
+
+/// Forwards chunks to the write() method of a Python IO object. Must be used with the GIL held.
+class PyIOStreamBuf final : public ChunkedStreamBuf {
+  public:
+    explicit PyIOStreamBuf(py::object write) : write_(std::move(write)) {}
+
+    /// Rethrow the exception raised by write(), if any
+    void RethrowError() const {
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+  protected:
+    bool WriteChunk(const char *data, size_t size) override {
+        if (error_) {
+            return false;
+        }
+        try {
+            while (size > 0) {
+                // The view is released after the call, so write() must not keep a reference to it
+                py::memoryview view = py::memoryview::from_memory(data, static_cast<py::ssize_t>(size));
+                py::object result = write_(view);
+                view.attr("release")();
+                // Raw IO objects may write fewer bytes than requested, or return None if a non-blocking write
+                // would block
+                if (result.is_none()) {
+                    throw std::runtime_error("IO stream write would block");
+                }
+                const auto written = result.cast<py::ssize_t>();
+                if (written <= 0 || static_cast<size_t>(written) > size) {
+                    throw std::runtime_error("IO stream write returned an invalid size");
+                }
+                data += written;
+                size -= static_cast<size_t>(written);
+            }
+        } catch (...) {
+            error_ = std::current_exception();
+            return false;
+        }
+        return true;
+    }
+
+  private:
+    py::object write_;
+    std::exception_ptr error_;
+};
+
+/// Writes chunks to a file descriptor. Does not need the GIL.
+class FdStreamBuf final : public ChunkedStreamBuf {
+  public:
+    explicit FdStreamBuf(int fd) : fd_(fd) {}
+
+    int Error() const { return error_; }
+
+  protected:
+    bool WriteChunk(const char *data, size_t size) override {
+        while (size > 0) {
+#ifdef _WIN32
+            const auto written = _write(fd_, data, static_cast<unsigned int>(size));
+#else
+            const auto written = ::write(fd_, data, size);
+#endif
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                error_ = written < 0 ? errno : EIO;
+                return false;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+  private:
+    int fd_;
+    int error_ = 0;
+};
+
+bool writeToPyIO(Encoder &encoder, const py::object &output) {
+    PyIOStreamBuf streamBuf(output.attr("write"));
+    std::ostream stream(&streamBuf);
+    const bool written = encoder.WriteTo(stream) && stream.flush().good();
+    streamBuf.RethrowError();
+    return written;
+}
+
+bool writeToFd(Encoder &encoder, int fd) {
+    FdStreamBuf streamBuf(fd);
+    std::ostream stream(&streamBuf);
+    bool written = false;
+    {
+        py::gil_scoped_release release;
+        written = encoder.WriteTo(stream) && stream.flush().good();
+    }
+    if (streamBuf.Error() != 0) {
+        errno = streamBuf.Error();
+        PyErr_SetFromErrno(PyExc_OSError);
+        throw py::error_already_set();
+    }
+    return written;
+}
+
+} // namespace
+
 class PyEncoder final : public Encoder {
   public:
     using Encoder::Encoder;
@@ -100,14 +276,40 @@ class PyEncoder final : public Encoder {
         PYBIND11_OVERRIDE_PURE(void, Encoder, SetAliasGroup, resource, aliasGroupId);
     }
 
+    void SetConstantAlignment(uint64_t alignment) override {
+        PYBIND11_OVERRIDE_PURE(void, Encoder, SetConstantAlignment, alignment);
+    }
+
     ConstantRef AddConstant(ResourceRef resourceRef, const void *data, size_t sizeInBytes,
                             int64_t sparsityDimension) override {
         PYBIND11_OVERRIDE_PURE(ConstantRef, Encoder, AddConstant, resourceRef, data, sizeInBytes, sparsityDimension);
     }
 
+    ConstantRef AddBorrowedConstant(ResourceRef resourceRef, const void *data, size_t sizeInBytes,
+                                    int64_t sparsityDimension, std::shared_ptr<const void> owner) override {
+        PYBIND11_OVERRIDE_PURE(ConstantRef, Encoder, AddBorrowedConstant, resourceRef, data, sizeInBytes,
+                               sparsityDimension, owner);
+    }
+
+    bool WriteToFile(const std::string &path, uint32_t numThreads) override {
+        PYBIND11_OVERRIDE_PURE(bool, Encoder, WriteToFile, path, numThreads);
+    }
+
+    void SetParallelFinish(bool enable) override { PYBIND11_OVERRIDE_PURE(void, Encoder, SetParallelFinish, enable); }
+
+    void SetSectionChecksums(bool enable) override {
+        PYBIND11_OVERRIDE_PURE(void, Encoder, SetSectionChecksums, enable);
+    }
+
     void Finish() override { PYBIND11_OVERRIDE_PURE(void, Encoder, Finish); }
 
     bool WriteTo(std::ostream &output) override { PYBIND11_OVERRIDE_PURE(bool, Encoder, WriteTo, output); }
+
+    uint64_t GetEncodedSize() const override { PYBIND11_OVERRIDE_PURE(uint64_t, Encoder, GetEncodedSize); }
+
+    bool WriteTo(void *dst, size_t capacity) override {
+        PYBIND11_OVERRIDE_PURE(bool, Encoder, WriteTo, dst, capacity);
+    }
 };
 
 void pyInitEncoder(py::module m) {
@@ -175,31 +377,85 @@ void pyInitEncoder(py::module m) {
              py::arg("samplerMagFilter"), py::arg("samplerAddressModeU"), py::arg("samplerAddressModeV"),
              py::arg("samplerBorderColor"))
         .def("SetAliasGroup", &Encoder::SetAliasGroup, py::arg("resource"), py::arg("aliasGroupId"))
+        .def("SetConstantAlignment", &Encoder::SetConstantAlignment, py::arg("alignment"))
         .def(
             "AddConstant",
-            [](Encoder &encoder, ResourceRef resRef, const py::buffer &buffer, int64_t sparsityDimension) {
-                return encoder.AddConstant(resRef, buffer.request().ptr,
-                                           size_t(buffer.request().itemsize) * size_t(buffer.request().size),
-                                           sparsityDimension);
+            [](Encoder &encoder, ResourceRef resRef, const py::buffer &buffer, int64_t sparsityDimension,
+               bool borrow) {
+                py::buffer_info info = buffer.request();
+                const size_t sizeInBytes = size_t(info.itemsize) * size_t(info.size);
+                if (!borrow) {
+                    return encoder.AddConstant(resRef, info.ptr, sizeInBytes, sparsityDimension);
+                }
+                // Keep the exporter's buffer alive (and its view acquired) until the encoder releases it
+                const void *data = info.ptr;
+                auto owner = std::shared_ptr<const void>(new py::buffer_info(std::move(info)), [](const void *ptr) {
+                    py::gil_scoped_acquire gil;
+                    delete static_cast<const py::buffer_info *>(ptr);
+                });
+                return encoder.AddBorrowedConstant(resRef, data, sizeInBytes, sparsityDimension, std::move(owner));
             },
-            py::arg("resourceRef"), py::arg("buffer"), py::arg("sparsityDimension") = CONSTANT_NOT_SPARSE_DIMENSION)
+            py::arg("resourceRef"), py::arg("buffer"), py::arg("sparsityDimension") = CONSTANT_NOT_SPARSE_DIMENSION,
+            py::arg("borrow") = false)
+        .def("SetParallelFinish", &Encoder::SetParallelFinish, py::arg("enable"))
+        .def("SetSectionChecksums", &Encoder::SetSectionChecksums, py::arg("enable"))
         .def("Finish", &Encoder::Finish)
         .def(
             "WriteTo",
-            [](Encoder &encoder, py::object &pyIOStream) {
-                if (!py::isinstance(pyIOStream, py::module::import("io").attr("IOBase"))) {
-                    throw std::runtime_error("Object is not an IO stream");
+            [](Encoder &encoder, const py::object &output) {
+                const py::module os = py::module::import("os");
+                if (py::isinstance<py::str>(output) || py::isinstance(output, os.attr("PathLike"))) {
+                    const auto path = os.attr("fsdecode")(output).cast<std::string>();
+                    py::gil_scoped_release release;
+                    return encoder.WriteToFile(path);
                 }
-
-                std::stringstream stream;
-                if (encoder.WriteTo(stream)) {
-                    pyIOStream.attr("write")(py::bytes(stream.str()));
-                    return true;
+                if (py::isinstance<py::int_>(output)) {
+                    return writeToFd(encoder, output.cast<int>());
                 }
-
-                return false;
+                if (py::isinstance(output, py::module::import("io").attr("IOBase"))) {
+                    return writeToPyIO(encoder, output);
+                }
+                if (PyObject_CheckBuffer(output.ptr()) != 0) {
+                    Py_buffer view;
+                    if (PyObject_GetBuffer(output.ptr(), &view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) != 0) {
+                        throw py::error_already_set();
+                    }
+                    std::unique_ptr<Py_buffer, decltype(&PyBuffer_Release)> viewGuard(&view, PyBuffer_Release);
+                    py::gil_scoped_release release;
+                    return encoder.WriteTo(view.buf, static_cast<size_t>(view.len));
+                }
+                throw py::type_error("output must be a path, a file descriptor, an IO stream or a writable buffer");
             },
-            py::arg("output"));
+            py::arg("output"))
+        .def("EncodeToMemoryView",
+             [](Encoder &encoder) {
+                 const uint64_t size = encoder.GetEncodedSize();
+                 if (size == 0 || size > static_cast<uint64_t>(std::numeric_limits<py::ssize_t>::max())) {
+                     throw std::runtime_error("Cannot allocate a buffer for the encoded VGF model");
+                 }
+                 auto buffer = py::reinterpret_steal<py::object>(
+                     PyByteArray_FromStringAndSize(nullptr, static_cast<py::ssize_t>(size)));
+                 if (!buffer) {
+                     throw py::error_already_set();
+                 }
+                 char *data = PyByteArray_AsString(buffer.ptr());
+                 bool written = false;
+                 {
+                     py::gil_scoped_release release;
+                     written = encoder.WriteTo(data, static_cast<size_t>(size));
+                 }
+                 if (!written) {
+                     throw std::runtime_error("Failed to encode the VGF model");
+                 }
+                 return py::memoryview(buffer);
+             })
+        .def("GetEncodedSize", &Encoder::GetEncodedSize)
+        .def("WriteToFile", &Encoder::WriteToFile, py::arg("path"), py::arg("numThreads") = 0,
+             py::call_guard<py::gil_scoped_release>());
+
+    py::class_<StreamingEncoder, Encoder>(m, "StreamingEncoder").def("Close", &StreamingEncoder::Close);
 
     m.def("CreateEncoder", &CreateEncoder, py::arg("vkHeaderVersion"));
+    m.def("CreateStreamingEncoder", &CreateStreamingEncoder, py::arg("path"), py::arg("vkHeaderVersion"),
+          py::arg("constantCountHint") = 1024);
 }
@@ -60,6 +60,25 @@ constexpr size_t HEADER_CONSTANT_SECTION_OFFSET_OFFSET =
     HEADER_CONSTANT_SECTION_OFFSET + offsetof(SectionEntry, offset);
 constexpr size_t HEADER_CONSTANT_SECTION_SIZE_OFFSET = HEADER_CONSTANT_SECTION_OFFSET + offsetof(SectionEntry, size);
 
+// Optional per-section checksums, stored in fields that older versions reserve and write as zero
+constexpr size_t HEADER_MODULE_CHECKSUM_OFFSET = HEADER_FOURTH_SECTION_OFFSET + sizeof(SectionEntry);
+constexpr size_t HEADER_MODEL_SEQUENCE_CHECKSUM_OFFSET = HEADER_MODULE_CHECKSUM_OFFSET + sizeof(uint64_t);
+constexpr size_t HEADER_MODEL_RESOURCE_CHECKSUM_OFFSET = HEADER_MODEL_SEQUENCE_CHECKSUM_OFFSET + sizeof(uint64_t);
+constexpr size_t HEADER_CONSTANT_CHECKSUM_OFFSET = HEADER_MODEL_RESOURCE_CHECKSUM_OFFSET + sizeof(uint64_t);
+constexpr size_t HEADER_CHECKSUM_TYPE_OFFSET = HEADER_CONSTANT_CHECKSUM_OFFSET + sizeof(uint64_t);
+
+constexpr uint64_t HEADER_CHECKSUM_TYPE_NONE = 0;
+constexpr uint64_t HEADER_CHECKSUM_TYPE_CRC32C = 1;
+
+/// CRC32C of each section, in the low 32 bits of the header fields
+struct SectionChecksums {
+    uint64_t module{0};
+    uint64_t sequence{0};
+    uint64_t resource{0};
+    uint64_t constant{0};
+    uint64_t type{HEADER_CHECKSUM_TYPE_NONE};
+};
+
 constexpr uint8_t HEADER_MAJOR_VERSION_VALUE = 0;
 constexpr uint8_t HEADER_MINOR_VERSION_VALUE = 4;
 constexpr uint8_t HEADER_PATCH_VERSION_VALUE = 3;
@@ -70,7 +89,7 @@ static_assert(HEADER_MAJOR_VERSION_VALUE == 0);
 
 struct Header {
     Header(const SectionEntry &moduleSection, const SectionEntry &sequenceSection, const SectionEntry &resourceSection,
-           const SectionEntry &constantSection, uint16_t vkHeaderVersion)
+           const SectionEntry &constantSection, uint16_t vkHeaderVersion, const SectionChecksums &checksums = {})
         : vkHeaderVersion(vkHeaderVersion),
           moduleSection{
               moduleSection.offset,
@@ -87,7 +106,8 @@ struct Header {
           constantSection{
               constantSection.offset,
               constantSection.size,
-          } {}
+          },
+          checksums(checksums) {}
 
     const FourCCValue magic = HEADER_MAGIC_VALUE;
     const uint16_t vkHeaderVersion{0};
@@ -99,11 +119,7 @@ struct Header {
     const SectionEntry sequenceSection;
     const SectionEntry resourceSection;
     const SectionEntry constantSection;
-    const uint64_t reserved3{0};
-    const uint64_t reserved4{0};
-    const uint64_t reserved5{0};
-    const uint64_t reserved6{0};
-    const uint64_t reserved7{0};
+    const SectionChecksums checksums;
     const uint64_t reserved8{0};
 };
 
@@ -136,4 +152,14 @@ static_assert(offsetof(Header, constantSection.offset) == HEADER_CONSTANT_SECTIO
               "Header constant section offset sub-field offset mismatched from spec.");
 static_assert(offsetof(Header, constantSection.size) == HEADER_CONSTANT_SECTION_SIZE_OFFSET,
               "Header constant section size sub-field offset mismatched from spec.");
+static_assert(offsetof(Header, checksums.module) == HEADER_MODULE_CHECKSUM_OFFSET,
+              "Header module checksum field offset mismatched from spec.");
+static_assert(offsetof(Header, checksums.sequence) == HEADER_MODEL_SEQUENCE_CHECKSUM_OFFSET,
+              "Header model sequence checksum field offset mismatched from spec.");
+static_assert(offsetof(Header, checksums.resource) == HEADER_MODEL_RESOURCE_CHECKSUM_OFFSET,
+              "Header model resource checksum field offset mismatched from spec.");
+static_assert(offsetof(Header, checksums.constant) == HEADER_CONSTANT_CHECKSUM_OFFSET,
+              "Header constant checksum field offset mismatched from spec.");
+static_assert(offsetof(Header, checksums.type) == HEADER_CHECKSUM_TYPE_OFFSET,
+              "Header checksum type field offset mismatched from spec.");
 } // namespace mlsdk::vgflib
@@ -0,0 +1,440 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "vgf/loader.hpp"
+#include "vgf/decoder_views.hpp"
+
+#include "constant.hpp"
+#include "decoder_internal.hpp"
+#include "internal_logging.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#    include <io.h>
+#    include <windows.h>
+#else
+#    include <unistd.h>
+#endif
+
+namespace mlsdk::vgflib {
+
+namespace {
+
+// Larger reads are split, as a single positional read transfers less than 2 GiB on Linux and Windows
+constexpr uint64_t MAX_READ_SIZE = 1024 * 1024 * 1024;
+
+bool rangeWithinFile(uint64_t offset, uint64_t size, uint64_t fileSize) {
+    return byteRangeWithinBounds({offset, size}, fileSize) && byteRangeCanBeAddressed({0, size});
+}
+
+class MemoryRangeReader final : public RangeReader {
+  public:
+    MemoryRangeReader(const void *data, uint64_t size) : data_(static_cast<const uint8_t *>(data)), size_(size) {}
+
+    [[nodiscard]] uint64_t size() const override { return size_; }
+
+    [[nodiscard]] bool read(uint64_t offset, void *dst, uint64_t size) const override {
+        if (!rangeWithinFile(offset, size, size_)) {
+            return false;
+        }
+        if (size != 0) {
+            std::memcpy(dst, data_ + static_cast<size_t>(offset), static_cast<size_t>(size));
+        }
+        return true;
+    }
+
+  private:
+    const uint8_t *data_;
+    uint64_t size_;
+};
+
+/// Reads the whole range, resuming after partial reads. Returns 0 or the errno of the failed read.
+int readAt(int fd, uint64_t offset, void *dst, uint64_t size) {
+    auto *bytes = static_cast<uint8_t *>(dst);
+    while (size > 0) {
+        const auto chunk = std::min(size, MAX_READ_SIZE);
+#ifdef _WIN32
+        const auto handle = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+        if (handle == INVALID_HANDLE_VALUE) {
+            return EBADF;
+        }
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD read = 0;
+        if (!ReadFile(handle, bytes, static_cast<DWORD>(chunk), &read, &overlapped)) {
+            return EIO;
+        }
+#else
+        const ssize_t read = pread(fd, bytes, static_cast<size_t>(chunk), static_cast<off_t>(offset));
+        if (read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+#endif
+        if (read == 0) {
+            // The file is shorter than when the reader was created
+            return EIO;
+        }
+        bytes += read;
+        offset += static_cast<uint64_t>(read);
+        size -= static_cast<uint64_t>(read);
+    }
+    return 0;
+}
+
+std::optional<uint64_t> fileSize(int fd) {
+#ifdef _WIN32
+    struct _stat64 st = {};
+    if (_fstat64(fd, &st) != 0) {
+        return std::nullopt;
+    }
+#else
+    struct stat st = {};
+    if (fstat(fd, &st) != 0) {
+        return std::nullopt;
+    }
+#endif
+    return static_cast<uint64_t>(st.st_size);
+}
+
+class FileDescriptorRangeReader final : public RangeReader {
+  public:
+    FileDescriptorRangeReader(int fd, uint64_t size, bool ownsFd) : fd_(fd), size_(size), ownsFd_(ownsFd) {}
+
+    FileDescriptorRangeReader(const FileDescriptorRangeReader &) = delete;
+    FileDescriptorRangeReader &operator=(const FileDescriptorRangeReader &) = delete;
+
+    ~FileDescriptorRangeReader() override {
+        if (ownsFd_) {
+#ifdef _WIN32
+            _close(fd_);
+#else
+            close(fd_);
+#endif
+        }
+    }
+
+    [[nodiscard]] uint64_t size() const override { return size_; }
+
+    [[nodiscard]] bool read(uint64_t offset, void *dst, uint64_t size) const override {
+        if (!rangeWithinFile(offset, size, size_)) {
+            return false;
+        }
+        if (const int error = readAt(fd_, offset, dst, size); error != 0) {
+            logging::error("Failed to read " + std::to_string(size) + " bytes at offset " + std::to_string(offset) +
+                           ": " + std::strerror(error));
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] int fileDescriptor() const override { return fd_; }
+
+  private:
+    int fd_;
+    uint64_t size_;
+    bool ownsFd_;
+};
+
+class CallbackRangeReader final : public RangeReader {
+  public:
+    CallbackRangeReader(uint64_t size, RangeReadCallback callback) : size_(size), callback_(std::move(callback)) {}
+
+    [[nodiscard]] uint64_t size() const override { return size_; }
+
+    [[nodiscard]] bool read(uint64_t offset, void *dst, uint64_t size) const override {
+        return rangeWithinFile(offset, size, size_) && callback_(offset, dst, size);
+    }
+
+  private:
+    uint64_t size_;
+    RangeReadCallback callback_;
+};
+
+/// Section of the file read into memory aligned for the FlatBuffers verifier
+class SectionBuffer {
+  public:
+    /// Rejects empty sections, which no decoder accepts and which would leave data() null
+    [[nodiscard]] bool read(const RangeReader &reader, uint64_t offset, uint64_t size) {
+        if (size == 0) {
+            logging::error("Section at offset " + std::to_string(offset) + " is empty");
+            return false;
+        }
+        if (!byteRangeCanBeAddressed({0, size})) {
+            logging::error("Section of " + std::to_string(size) + " bytes cannot be addressed");
+            return false;
+        }
+        words_.resize(static_cast<size_t>((size + sizeof(uint64_t) - 1) / sizeof(uint64_t)));
+        size_ = size;
+        if (!reader.read(offset, words_.data(), size)) {
+            logging::error("Failed to read the section at offset " + std::to_string(offset));
+            return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] const void *data() const { return words_.data(); }
+    [[nodiscard]] uint64_t size() const { return size_; }
+
+  private:
+    std::vector<uint64_t> words_;
+    uint64_t size_ = 0;
+};
+
+class VgfLoaderImpl final : public VgfLoader {
+  public:
+    static std::unique_ptr<VgfLoaderImpl> Create(const RangeReader &reader, VerificationMode mode) {
+        auto loader = std::unique_ptr<VgfLoaderImpl>(new VgfLoaderImpl(reader));
+        if (!loader->_load(mode)) {
+            return nullptr;
+        }
+        return loader;
+    }
+
+    [[nodiscard]] const HeaderDecoder &getHeaderDecoder() const override { return *header_; }
+    [[nodiscard]] const ModuleTableDecoder &getModuleTableDecoder() const override { return *moduleTable_; }
+    [[nodiscard]] const ModelSequenceTableDecoder &getModelSequenceTableDecoder() const override {
+        return *modelSequenceTable_;
+    }
+    [[nodiscard]] const ModelResourceTableDecoder &getModelResourceTableDecoder() const override {
+        return *modelResourceTable_;
+    }
+    [[nodiscard]] const RangeReader &getRangeReader() const override { return reader_; }
+
+    [[nodiscard]] size_t getNumConstants() const override { return constants_.size(); }
+
+    [[nodiscard]] uint32_t getConstantMrtIndex(uint32_t idx) const override {
+        return inRange(idx) ? constants_.mrtIndex(idx) : CONSTANT_INVALID_MRT_INDEX;
+    }
+
+    [[nodiscard]] int64_t getConstantSparsityDimension(uint32_t idx) const override {
+        return inRange(idx) ? constants_.sparsityDimension(idx) : CONSTANT_INVALID_SPARSITY_DIMENSION;
+    }
+
+    [[nodiscard]] uint64_t getConstantSize(uint32_t idx) const override {
+        return inRange(idx) ? constants_.dataSize(idx) : 0;
+    }
+
+    [[nodiscard]] uint64_t getConstantFileOffset(uint32_t idx) const override {
+        // The metadata checks keep every constant within the section, and the header keeps the section within the file
+        return inRange(idx) ? payloadOffset_ + constants_.dataOffset(idx) : 0;
+    }
+
+    [[nodiscard]] bool readConstant(uint32_t idx, void *dst, uint64_t capacity) const override {
+        if (!inRange(idx)) {
+            logging::error("Constant index " + std::to_string(idx) + " out of range");
+            return false;
+        }
+        const uint64_t size = constants_.dataSize(idx);
+        if (capacity < size) {
+            logging::error("Buffer of " + std::to_string(capacity) + " bytes cannot hold constant " +
+                           std::to_string(idx) + " of " + std::to_string(size) + " bytes");
+            return false;
+        }
+        if (size != 0 && dst == nullptr) {
+            logging::error("Constant destination is null");
+            return false;
+        }
+        return reader_.read(getConstantFileOffset(idx), dst, size);
+    }
+
+    [[nodiscard]] bool forEachConstantChunk(uint32_t idx, void *staging, uint64_t stagingSize,
+                                            const ConstantChunkCallback &callback) const override {
+        if (!inRange(idx)) {
+            logging::error("Constant index " + std::to_string(idx) + " out of range");
+            return false;
+        }
+        if (staging == nullptr || stagingSize == 0) {
+            logging::error("Constant staging buffer is empty");
+            return false;
+        }
+        const uint64_t size = constants_.dataSize(idx);
+        const uint64_t fileOffset = getConstantFileOffset(idx);
+        for (uint64_t offset = 0; offset < size;) {
+            const uint64_t chunkSize = std::min(stagingSize, size - offset);
+            if (!reader_.read(fileOffset + offset, staging, chunkSize) ||
+                !callback(offset, DataView<uint8_t>(static_cast<const uint8_t *>(staging),
+                                                    static_cast<size_t>(chunkSize)))) {
+                return false;
+            }
+            offset += chunkSize;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool forEachConstantChunk(uint32_t idx, uint64_t chunkSize,
+                                            const ConstantChunkCallback &callback) const override {
+        if (chunkSize == 0) {
+            logging::error("Constant chunk size is 0");
+            return false;
+        }
+        // The staging buffer is no larger than the constant, so small constants do not allocate whole chunks
+        const uint64_t stagingSize = std::min(chunkSize, std::max<uint64_t>(getConstantSize(idx), 1));
+        std::vector<uint8_t> staging(static_cast<size_t>(stagingSize));
+        return forEachConstantChunk(idx, staging.data(), staging.size(), callback);
+    }
+
+  private:
+    explicit VgfLoaderImpl(const RangeReader &reader) : reader_(reader) {}
+
+    [[nodiscard]] bool inRange(uint32_t idx) const { return static_cast<size_t>(idx) < constants_.size(); }
+
+    [[nodiscard]] bool _load(VerificationMode mode) {
+        const uint64_t fileSize = reader_.size();
+        if (fileSize < HeaderSize()) {
+            logging::error("VGF file is smaller than the header size");
+            return false;
+        }
+        // The header checks that every section lies within the file, so the sections can be read directly
+        if (!headerData_.read(reader_, 0, HeaderSize())) {
+            return false;
+        }
+        header_ = CreateHeaderDecoder(headerData_.data(), HeaderSize(), fileSize);
+        if (header_ == nullptr) {
+            return false;
+        }
+
+        if (!moduleTableData_.read(reader_, header_->GetModuleTableOffset(), header_->GetModuleTableSize())) {
+            return false;
+        }
+        moduleTable_ = CreateModuleTableDecoder(moduleTableData_.data(), moduleTableData_.size(), mode);
+        if (moduleTable_ == nullptr) {
+            return false;
+        }
+
+        if (!modelSequenceTableData_.read(reader_, header_->GetModelSequenceTableOffset(),
+                                          header_->GetModelSequenceTableSize())) {
+            return false;
+        }
+        modelSequenceTable_ =
+            CreateModelSequenceTableDecoder(modelSequenceTableData_.data(), modelSequenceTableData_.size(), mode);
+        if (modelSequenceTable_ == nullptr) {
+            return false;
+        }
+
+        if (!modelResourceTableData_.read(reader_, header_->GetModelResourceTableOffset(),
+                                          header_->GetModelResourceTableSize())) {
+            return false;
+        }
+        modelResourceTable_ =
+            CreateModelResourceTableDecoder(modelResourceTableData_.data(), modelResourceTableData_.size(), mode);
+        if (modelResourceTable_ == nullptr) {
+            return false;
+        }
+
+        return _loadConstantMetaData();
+    }
+
+    /// Reads the version and count of the Constants section, then its metadata records but not its payload
+    [[nodiscard]] bool _loadConstantMetaData() {
+        const uint64_t sectionOffset = header_->GetConstantsOffset();
+        const uint64_t sectionSize = header_->GetConstantsSize();
+        if (sectionSize < CONSTANT_SECTION_METADATA_OFFSET) {
+            logging::error("Constant section too small to contain metadata");
+            return false;
+        }
+        if (!constantMetaData_.read(reader_, sectionOffset, CONSTANT_SECTION_METADATA_OFFSET)) {
+            return false;
+        }
+        const auto metaDataSize = GetConstantMetaDataSize(constantMetaData_.data(), sectionSize);
+        if (!metaDataSize.has_value()) {
+            return false;
+        }
+        if (!constantMetaData_.read(reader_, sectionOffset, *metaDataSize)) {
+            return false;
+        }
+        const auto view = CreateConstantMetaDataView(constantMetaData_.data(), sectionSize);
+        if (!view.has_value()) {
+            return false;
+        }
+        constants_ = *view;
+        payloadOffset_ = sectionOffset + *metaDataSize;
+        return true;
+    }
+
+    const RangeReader &reader_;
+    SectionBuffer headerData_;
+    SectionBuffer moduleTableData_;
+    SectionBuffer modelSequenceTableData_;
+    SectionBuffer modelResourceTableData_;
+    SectionBuffer constantMetaData_;
+
+    std::unique_ptr<HeaderDecoder> header_;
+    std::unique_ptr<ModuleTableDecoder> moduleTable_;
+    std::unique_ptr<ModelSequenceTableDecoder> modelSequenceTable_;
+    std::unique_ptr<ModelResourceTableDecoder> modelResourceTable_;
+    ConstantView constants_;
+    uint64_t payloadOffset_ = 0;
+};
+
+} // namespace
+
+std::unique_ptr<RangeReader> CreateMemoryRangeReader(const void *const data, uint64_t size) {
+    if (data == nullptr && size != 0) {
+        logging::error("Range reader data is null");
+        return nullptr;
+    }
+    return std::make_unique<MemoryRangeReader>(data, size);
+}
+
+std::unique_ptr<RangeReader> CreateFileRangeReader(const std::string &path) {
+#ifdef _WIN32
+    const int fd = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#endif
+    if (fd < 0) {
+        logging::error("Failed to open file " + path + ": " + std::strerror(errno));
+        return nullptr;
+    }
+    const auto size = fileSize(fd);
+    if (!size.has_value()) {
+        logging::error("Failed to read the size of file " + path + ": " + std::strerror(errno));
+#ifdef _WIN32
+        _close(fd);
+#else
+        close(fd);
+#endif
+        return nullptr;
+    }
+    return std::make_unique<FileDescriptorRangeReader>(fd, *size, true);
+}
+
+std::unique_ptr<RangeReader> CreateFileDescriptorRangeReader(int fd) {
+    const auto size = fd < 0 ? std::nullopt : fileSize(fd);
+    if (!size.has_value()) {
+        logging::error("Failed to read the size of file descriptor " + std::to_string(fd));
+        return nullptr;
+    }
+    return std::make_unique<FileDescriptorRangeReader>(fd, *size, false);
+}
+
+std::unique_ptr<RangeReader> CreateCallbackRangeReader(uint64_t size, RangeReadCallback callback) {
+    if (!callback) {
+        logging::error("Range reader callback is empty");
+        return nullptr;
+    }
+    return std::make_unique<CallbackRangeReader>(size, std::move(callback));
+}
+
+std::unique_ptr<VgfLoader> CreateVgfLoader(const RangeReader &reader, VerificationMode mode) {
+    return VgfLoaderImpl::Create(reader, mode);
+}
+
+} // namespace mlsdk::vgflib
@@ -1,22 +1,46 @@
 /*
- * SPDX-FileCopyrightText: Copyright 2024-2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-FileCopyrightText: Copyright 2024-2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "internal_logging.hpp"
 
+#include <memory>
+#include <mutex>
+#include <utility>
+
 namespace mlsdk::vgflib::logging {
 
 namespace {
 void noLogging(LogLevel, const std::string &) {}
 
-LoggingCallback vgflibLoggingCallback = noLogging;
+std::shared_ptr<const LoggingCallback> vgflibLoggingCallback = std::make_shared<const LoggingCallback>(noLogging);
+
+// Decoders may log from several threads, e.g. during parallel verification, so callbacks are serialized. The mutex is
+// recursive so that a callback can log again, or call into the library, from the same thread.
+std::recursive_mutex &loggingMutex() {
+    static std::recursive_mutex mutex;
+    return mutex;
+}
 
-void log(LogLevel logLevel, const std::string &message) { vgflibLoggingCallback(logLevel, message); }
+void log(LogLevel logLevel, const std::string &message) {
+    const std::lock_guard<std::recursive_mutex> lock(loggingMutex());
+    // Called through a copy, so that the callback stays alive if it enables or disables logging
+    const std::shared_ptr<const LoggingCallback> callback = vgflibLoggingCallback;
+    (*callback)(logLevel, message);
+}
 } // namespace
 
-void EnableLogging(const LoggingCallback &callback) { vgflibLoggingCallback = callback; }
-void DisableLogging() { vgflibLoggingCallback = noLogging; }
+void EnableLogging(const LoggingCallback &callback) {
+    auto newCallback = std::make_shared<const LoggingCallback>(callback);
+    const std::lock_guard<std::recursive_mutex> lock(loggingMutex());
+    vgflibLoggingCallback = std::move(newCallback);
+}
+void DisableLogging() {
+    auto newCallback = std::make_shared<const LoggingCallback>(noLogging);
+    const std::lock_guard<std::recursive_mutex> lock(loggingMutex());
+    vgflibLoggingCallback = std::move(newCallback);
+}
 
 std::ostream &operator<<(std::ostream &os, const LogLevel &logLevel) {
     switch (logLevel) {
@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "vgf/decoder.hpp"
+
+#include "internal_logging.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mlsdk::vgflib {
+namespace {
+
+constexpr uint32_t NO_SEGMENT = std::numeric_limits<uint32_t>::max();
+
+/// Storage shared by an intermediate or by the intermediates of an alias group
+struct Storage {
+    uint64_t size = 0;
+    uint64_t offset = 0;
+    uint32_t firstSegment = NO_SEGMENT;
+    uint32_t lastSegment = 0;
+
+    bool overlaps(const Storage &other) const {
+        return firstSegment <= other.lastSegment && other.firstSegment <= lastSegment;
+    }
+};
+
+/// Extend the lifetimes of the resources bound to segmentIdx
+void MarkLive(const ModelSequenceTableDecoder &decoder, BindingSlotArrayHandle handle, uint32_t segmentIdx,
+              std::vector<uint32_t> &firstSegments, std::vector<uint32_t> &lastSegments) {
+    for (uint32_t slotIdx = 0; slotIdx < decoder.getBindingsSize(handle); ++slotIdx) {
+        const uint32_t mrtIdx = decoder.getBindingSlotMrtIndex(handle, slotIdx);
+        if (mrtIdx < firstSegments.size()) {
+            firstSegments[mrtIdx] = std::min(firstSegments[mrtIdx], segmentIdx);
+            lastSegments[mrtIdx] = std::max(lastSegments[mrtIdx], segmentIdx);
+        }
+    }
+}
+
+/// Place every storage at the smallest gap fitting it among the storages live at the same time, largest first
+void PlaceStorages(std::vector<Storage> &storages) {
+    std::vector<uint32_t> order(storages.size());
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](uint32_t lhs, uint32_t rhs) { return storages[lhs].size > storages[rhs].size; });
+
+    // Placed storages in increasing offset order
+    std::vector<uint32_t> placed;
+    placed.reserve(storages.size());
+    for (const uint32_t storageIdx : order) {
+        Storage &storage = storages[storageIdx];
+        uint64_t gapStart = 0;
+        std::optional<uint64_t> bestOffset;
+        uint64_t bestWaste = std::numeric_limits<uint64_t>::max();
+        for (const uint32_t placedIdx : placed) {
+            const Storage &other = storages[placedIdx];
+            if (!storage.overlaps(other)) {
+                continue;
+            }
+            if (other.offset >= gapStart) {
+                const uint64_t gap = other.offset - gapStart;
+                if (gap >= storage.size && gap - storage.size < bestWaste) {
+                    bestOffset = gapStart;
+                    bestWaste = gap - storage.size;
+                }
+            }
+            gapStart = std::max(gapStart, other.offset + other.size);
+        }
+        storage.offset = bestOffset.value_or(gapStart);
+
+        const auto position =
+            std::upper_bound(placed.begin(), placed.end(), storage.offset,
+                             [&](uint64_t offset, uint32_t idx) { return offset < storages[idx].offset; });
+        placed.insert(position, storageIdx);
+    }
+}
+
+} // namespace
+
+std::optional<MemoryPlan> PlanIntermediateMemory(const ModelSequenceTableDecoder &modelSequenceTable,
+                                                 const ModelResourceTableDecoder &modelResourceTable,
+                                                 const MemoryPlanOptions &options) {
+    if (options.alignment == 0 || (options.alignment & (options.alignment - 1)) != 0) {
+        logging::error("PlanIntermediateMemory: alignment " + std::to_string(options.alignment) +
+                       " is not a power of two");
+        return std::nullopt;
+    }
+
+    const size_t numEntries = modelResourceTable.size();
+    std::vector<uint32_t> firstSegments(numEntries, NO_SEGMENT);
+    std::vector<uint32_t> lastSegments(numEntries, 0);
+    for (uint32_t segmentIdx = 0; segmentIdx < modelSequenceTable.modelSequenceTableSize(); ++segmentIdx) {
+        MarkLive(modelSequenceTable, modelSequenceTable.getSegmentInputBindingSlotsHandle(segmentIdx), segmentIdx,
+                 firstSegments, lastSegments);
+        MarkLive(modelSequenceTable, modelSequenceTable.getSegmentOutputBindingSlotsHandle(segmentIdx), segmentIdx,
+                 firstSegments, lastSegments);
+        for (uint32_t descIdx = 0; descIdx < modelSequenceTable.getSegmentDescriptorSetInfosSize(segmentIdx);
+             ++descIdx) {
+            MarkLive(modelSequenceTable, modelSequenceTable.getDescriptorBindingSlotsHandle(segmentIdx, descIdx),
+                     segmentIdx, firstSegments, lastSegments);
+        }
+    }
+
+    MemoryPlan plan;
+    std::vector<Storage> storages;
+    std::vector<uint32_t> storageIndexes;
+    std::unordered_map<AliasGroupId, uint32_t> aliasGroupStorages;
+    for (uint32_t mrtIdx = 0; mrtIdx < numEntries; ++mrtIdx) {
+        if (modelResourceTable.getCategory(mrtIdx) != ResourceCategory::INTERMEDIATE ||
+            firstSegments[mrtIdx] == NO_SEGMENT) {
+            continue;
+        }
+        const std::optional<TensorLayout> layout = modelResourceTable.getTensorLayout(mrtIdx);
+        const std::optional<uint64_t> alignedSize =
+            layout.has_value() ? checkedAlignUp(layout->spanByteSize, options.alignment) : std::nullopt;
+        if (!alignedSize.has_value()) {
+            logging::error("PlanIntermediateMemory: intermediate " + std::to_string(mrtIdx) +
+                           " has no static byte size");
+            return std::nullopt;
+        }
+
+        uint32_t storageIdx = static_cast<uint32_t>(storages.size());
+        if (const std::optional<AliasGroupId> aliasGroupId = modelResourceTable.getAliasGroupId(mrtIdx)) {
+            storageIdx = aliasGroupStorages.emplace(*aliasGroupId, storageIdx).first->second;
+        }
+        if (storageIdx == storages.size()) {
+            storages.emplace_back();
+        }
+        Storage &storage = storages[storageIdx];
+        storage.size = std::max(storage.size, *alignedSize);
+        storage.firstSegment = std::min(storage.firstSegment, firstSegments[mrtIdx]);
+        storage.lastSegment = std::max(storage.lastSegment, lastSegments[mrtIdx]);
+
+        plan.allocations.push_back({mrtIdx, 0, 0, 0, 0});
+        storageIndexes.push_back(storageIdx);
+    }
+
+    PlaceStorages(storages);
+    for (const Storage &storage : storages) {
+        plan.peakBytes = std::max(plan.peakBytes, storage.offset + storage.size);
+        plan.totalBytes += storage.size;
+    }
+    for (size_t i = 0; i < plan.allocations.size(); ++i) {
+        const Storage &storage = storages[storageIndexes[i]];
+        IntermediateAllocation &allocation = plan.allocations[i];
+        allocation.offset = storage.offset;
+        allocation.size = storage.size;
+        allocation.firstSegment = storage.firstSegment;
+        allocation.lastSegment = storage.lastSegment;
+    }
+    return plan;
+}
+
+} // namespace mlsdk::vgflib
@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "positional_writer.hpp"
+
+#include "internal_logging.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#    include <fstream>
+#else
+#    include <climits>
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <sys/types.h>
+#    include <sys/uio.h>
+#    include <unistd.h>
+#endif
+
+namespace mlsdk::vgflib {
+
+#ifdef _WIN32
+
+bool writeExtentsToFile(const std::string &path, uint64_t fileSize, const std::vector<WriteExtent> &extents,
+                        uint32_t /*numThreads*/) {
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        logging::error("Failed to open output file " + path);
+        return false;
+    }
+
+    static constexpr std::array<char, 4096> zeros{};
+    uint64_t position = 0;
+    const auto writeZeros = [&](uint64_t end) {
+        for (; position < end && !output.fail();) {
+            const auto chunk = std::min<uint64_t>(end - position, zeros.size());
+            output.write(zeros.data(), static_cast<std::streamsize>(chunk));
+            position += chunk;
+        }
+    };
+    for (const auto &extent : extents) {
+        writeZeros(extent.offset);
+        output.write(static_cast<const char *>(extent.data), static_cast<std::streamsize>(extent.size));
+        position += extent.size;
+    }
+    writeZeros(fileSize);
+    output.close();
+    if (output.fail()) {
+        logging::error("Failed to write output file " + path);
+        return false;
+    }
+    return true;
+}
+
+#else
+
+namespace {
+
+#    ifdef IOV_MAX
+constexpr size_t MAX_IOVECS = std::min<size_t>(IOV_MAX, 256);
+#    else
+constexpr size_t MAX_IOVECS = 16;
+#    endif
+
+// Large extents are split so that several threads can share a single big constant payload
+constexpr uint64_t MAX_BATCH_SIZE = 64 * 1024 * 1024;
+
+// Small gaps are written from a zero buffer so neighbouring extents stay in one batch
+constexpr size_t MAX_MERGED_GAP = 4096;
+
+/// Consecutive bytes of the file written by a single pwritev call
+struct WriteBatch {
+    uint64_t offset;
+    uint64_t size;
+    std::vector<iovec> iovecs;
+};
+
+std::vector<WriteBatch> makeBatches(const std::vector<WriteExtent> &extents) {
+    static constexpr std::array<uint8_t, MAX_MERGED_GAP> zeros{};
+
+    std::vector<WriteBatch> batches;
+    const auto batchEnd = [&batches] { return batches.back().offset + batches.back().size; };
+    const auto append = [&batches](const void *data, uint64_t size) {
+        batches.back().iovecs.push_back({const_cast<void *>(data), static_cast<size_t>(size)});
+        batches.back().size += size;
+    };
+
+    for (const auto &extent : extents) {
+        const auto *data = static_cast<const uint8_t *>(extent.data);
+        uint64_t offset = extent.offset;
+        uint64_t remaining = extent.size;
+        while (remaining > 0) {
+            // The zero-filled gap counts towards the batch size, so that at least one byte of data still fits
+            const bool canExtend = !batches.empty() && batches.back().iovecs.size() + 2 <= MAX_IOVECS &&
+                                   batchEnd() <= offset && offset - batchEnd() <= MAX_MERGED_GAP &&
+                                   batches.back().size + (offset - batchEnd()) < MAX_BATCH_SIZE;
+            if (!canExtend) {
+                batches.push_back({offset, 0, {}});
+            } else if (offset > batchEnd()) {
+                append(zeros.data(), offset - batchEnd());
+            }
+
+            const uint64_t chunk = std::min(remaining, MAX_BATCH_SIZE - batches.back().size);
+            append(data, chunk);
+            data += chunk;
+            offset += chunk;
+            remaining -= chunk;
+        }
+    }
+    return batches;
+}
+
+/// Write the whole batch, resuming after partial writes. Returns 0 or the errno of the failed write.
+int writeBatch(int fd, WriteBatch &batch) {
+    iovec *iov = batch.iovecs.data();
+    size_t iovCount = batch.iovecs.size();
+    uint64_t offset = batch.offset;
+    while (iovCount > 0) {
+        const ssize_t written = pwritev(fd, iov, static_cast<int>(iovCount), static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        if (written == 0) {
+            return EIO;
+        }
+        offset += static_cast<uint64_t>(written);
+        auto consumed = static_cast<size_t>(written);
+        while (iovCount > 0 && consumed >= iov->iov_len) {
+            consumed -= iov->iov_len;
+            ++iov;
+            --iovCount;
+        }
+        if (iovCount > 0) {
+            iov->iov_base = static_cast<uint8_t *>(iov->iov_base) + consumed;
+            iov->iov_len -= consumed;
+        }
+    }
+    return 0;
+}
+
+/// Reserve the file blocks up front so writes at scattered offsets do not fragment the file
+bool preallocate(int fd, uint64_t fileSize) {
+    if (ftruncate(fd, static_cast<off_t>(fileSize)) != 0) {
+        return false;
+    }
+#    ifdef __linux__
+    // Best effort: not every file system supports preallocation, and the file already has its final size
+    if (fileSize > 0) {
+        (void)posix_fallocate(fd, 0, static_cast<off_t>(fileSize));
+    }
+#    endif
+    return true;
+}
+
+} // namespace
+
+bool writeExtentsToFile(const std::string &path, uint64_t fileSize, const std::vector<WriteExtent> &extents,
+                        uint32_t numThreads) {
+    const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (fd < 0) {
+        logging::error("Failed to open output file " + path + ": " + std::strerror(errno));
+        return false;
+    }
+    if (!preallocate(fd, fileSize)) {
+        logging::error("Failed to resize output file " + path + ": " + std::strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    std::vector<WriteBatch> batches = makeBatches(extents);
+    if (numThreads == 0) {
+        numThreads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    numThreads = static_cast<uint32_t>(std::min<size_t>(numThreads, batches.size()));
+
+    std::atomic<size_t> nextBatch{0};
+    std::atomic<int> firstError{0};
+    const auto writeBatches = [&] {
+        for (size_t i = nextBatch++; i < batches.size() && firstError == 0; i = nextBatch++) {
+            if (const int error = writeBatch(fd, batches[i]); error != 0) {
+                int expected = 0;
+                firstError.compare_exchange_strong(expected, error);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 1; i < numThreads; ++i) {
+        workers.emplace_back(writeBatches);
+    }
+    writeBatches();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    bool success = true;
+    if (firstError != 0) {
+        logging::error("Failed to write output file " + path + ": " + std::strerror(firstError));
+        success = false;
+    } else if (fsync(fd) != 0) {
+        logging::error("Failed to sync output file " + path + ": " + std::strerror(errno));
+        success = false;
+    }
+    if (close(fd) != 0 && success) {
+        logging::error("Failed to close output file " + path + ": " + std::strerror(errno));
+        success = false;
+    }
+    return success;
+}
+
+#endif
+
+} // namespace mlsdk::vgflib
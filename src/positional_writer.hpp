@@ -0,0 +1,35 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mlsdk::vgflib {
+
+/// Bytes to write at a known file offset
+struct WriteExtent {
+    uint64_t offset;
+    const void *data;
+    uint64_t size;
+};
+
+/// \brief Write extents to a new file of fileSize bytes at their offsets
+///
+/// The file is preallocated and zero filled, so gaps between extents are left as zero bytes. Extents are written
+/// with positional vectored writes from up to numThreads threads and the file is synced once at the end. On
+/// platforms without positional writes the extents are written in order through a file stream.
+///
+/// \param path Output file path. An existing file is truncated
+/// \param fileSize Final size of the file in bytes
+/// \param extents Non-overlapping extents, sorted by offset, all within fileSize
+/// \param numThreads Maximum number of writer threads, 0 to use the hardware concurrency
+/// \return True if all extents were written and the file was synced
+bool writeExtentsToFile(const std::string &path, uint64_t fileSize, const std::vector<WriteExtent> &extents,
+                        uint32_t numThreads);
+
+} // namespace mlsdk::vgflib
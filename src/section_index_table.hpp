@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <list>
 #include <ostream>
@@ -29,17 +31,28 @@ constexpr std::string_view rdStateToStr(std::ios::iostate state) {
     return "good";
 }
 
+/// Write zero bytes from a static buffer instead of allocating the padding
+inline void writeZeroPadding(std::ostream &output, uint64_t padding) {
+    static constexpr std::array<char, 64> zeros{};
+    while (padding > 0 && !output.fail()) {
+        const auto chunk = std::min<uint64_t>(padding, zeros.size());
+        output.write(zeros.data(), static_cast<std::streamsize>(chunk));
+        padding -= chunk;
+    }
+}
+
 class SectionIndexTable {
   public:
     class SectionIndex : public SectionEntry {
       public:
         /// Construct a section index table entry
-        SectionIndex(uint64_t size, uint64_t alignment) : SectionEntry(0, size), alignment_(alignment) {
+        SectionIndex(uint64_t size, uint64_t alignment, uint64_t alignmentOffset = 0)
+            : SectionEntry(0, size), alignment_(alignment), alignmentOffset_(alignmentOffset) {
             assert(alignment_ > 0);
         }
 
         /// Returned that the computed offset matches the required alignment
-        bool IsAligned() const { return offset % alignment_ == 0; }
+        bool IsAligned() const { return (offset + alignmentOffset_) % alignment_ == 0; }
 
         /// Returns the offset to the end of payload data
         uint64_t EndOfData() const { return offset + size; }
@@ -49,7 +62,7 @@ class SectionIndexTable {
 
         /// Update the padding by using the alignment requirement of the next section
         void UpdatePadding(const SectionIndex &next) {
-            padding_ = next.alignment_ - ((((EndOfData() - 1) % next.alignment_) + 1));
+            padding_ = (next.alignment_ - ((EndOfData() + next.alignmentOffset_) % next.alignment_)) % next.alignment_;
         }
 
         /// Update the offset by computing from the previous section
@@ -63,8 +76,7 @@ class SectionIndexTable {
                 return false;
             }
             if (padding_ != 0) {
-                std::vector<char> padArray(padding_, 0);
-                file.write(padArray.data(), static_cast<std::streamsize>(padArray.size()));
+                writeZeroPadding(file, padding_);
                 if (file.fail()) {
                     logging::error("Failed to write section index padding, rdstate: " +
                                    std::string(rdStateToStr(file.rdstate())));
@@ -80,14 +92,15 @@ class SectionIndexTable {
         uint64_t GetAlignment() const { return alignment_; }
 
       private:
-        uint64_t alignment_ = 1; //< Alignment requirement of the section
+        uint64_t alignment_ = 1;       //< Alignment requirement of the section
+        uint64_t alignmentOffset_ = 0; //< Offset into the section of the byte the alignment applies to
         uint64_t padding_ = 0;   //< Padding size (after the data)
     };
 
     /// Add a new section and return a reference to it
-    const SectionIndex &AddSection(uint64_t size, uint64_t alignment = 1) {
+    const SectionIndex &AddSection(uint64_t size, uint64_t alignment = 1, uint64_t alignmentOffset = 0) {
         assert(alignment != 0);
-        sections_.emplace_back(size, alignment);
+        sections_.emplace_back(size, alignment, alignmentOffset);
         return sections_.back();
     }
 
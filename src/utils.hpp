@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <optional>
 #include <utility>
@@ -121,4 +122,47 @@ constexpr std::optional<PaddedByteRange> appendAlignedByteRange(uint64_t size, u
     return std::pair{range, *paddedSize};
 }
 
+// Hash a byte buffer with four independent 64-bit lanes over 32-byte stripes so
+// the main loop pipelines (and vectorizes where the target allows) on large
+// payloads. Based on the xxHash64 round and avalanche steps. Not cryptographic:
+// callers must compare the bytes when hashes match.
+inline uint64_t hashBytes(const void *data, uint64_t size) {
+    constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t STRIPE_SIZE = 32;
+
+    const auto rotl = [](uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); };
+    const auto round = [&rotl](uint64_t acc, uint64_t input) { return rotl(acc + input * PRIME2, 31) * PRIME1; };
+    const auto read64 = [](const uint8_t *ptr) {
+        uint64_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    };
+
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    uint64_t lanes[4] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+    uint64_t remaining = size;
+    for (; remaining >= STRIPE_SIZE; remaining -= STRIPE_SIZE, bytes += STRIPE_SIZE) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            lanes[lane] = round(lanes[lane], read64(bytes + lane * sizeof(uint64_t)));
+        }
+    }
+
+    uint64_t hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18) + size;
+    for (; remaining >= sizeof(uint64_t); remaining -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+        hash = rotl(hash ^ round(0, read64(bytes)), 27) * PRIME1 + PRIME3;
+    }
+    for (; remaining > 0; --remaining, ++bytes) {
+        hash = rotl(hash ^ (*bytes * PRIME3), 11) * PRIME1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
 } // namespace mlsdk::vgflib
@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "verification_cache.hpp"
+
+#include "internal_logging.hpp"
+#include "utils.hpp"
+#include "vgf/decoder.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+
+namespace mlsdk::vgflib {
+namespace {
+
+constexpr char SIDECAR_MAGIC[8] = {'V', 'G', 'F', 'V', 'C', '0', '0', '1'};
+
+struct DigestLess {
+    bool operator()(const SectionDigest &lhs, const SectionDigest &rhs) const {
+        return std::tie(lhs.kind, lhs.size, lhs.hash) < std::tie(rhs.kind, rhs.size, rhs.hash);
+    }
+};
+
+class VerificationCache {
+  public:
+    static VerificationCache &instance() {
+        static VerificationCache cache;
+        return cache;
+    }
+
+    bool configure(const VerificationCacheOptions &options) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        digests_.clear();
+        hits_ = 0;
+        misses_ = 0;
+        sidecarPath_.clear();
+        enabled_ = options.enabled;
+        if (!options.enabled || options.sidecarPath.empty()) {
+            return true;
+        }
+
+        if (!_loadSidecar(options.sidecarPath)) {
+            digests_.clear();
+            return false;
+        }
+        sidecarPath_ = options.sidecarPath;
+        return true;
+    }
+
+    void invalidate() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        digests_.clear();
+        if (!sidecarPath_.empty() && !_createSidecar(sidecarPath_)) {
+            sidecarPath_.clear();
+        }
+    }
+
+    [[nodiscard]] VerificationCacheStats stats() const { return {hits_.load(), misses_.load()}; }
+
+    [[nodiscard]] bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] bool contains(const SectionDigest &digest) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        const bool cached = digests_.count(digest) != 0;
+        ++(cached ? hits_ : misses_);
+        return cached;
+    }
+
+    void insert(const SectionDigest &digest) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (!enabled_ || !digests_.insert(digest).second || sidecarPath_.empty()) {
+            return;
+        }
+        std::ofstream sidecar(sidecarPath_, std::ios::binary | std::ios::app);
+        sidecar.write(reinterpret_cast<const char *>(&digest), sizeof(digest));
+        if (!sidecar) {
+            logging::warning("Verification cache: could not append to " + sidecarPath_);
+        }
+    }
+
+  private:
+    VerificationCache() = default;
+
+    bool _loadSidecar(const std::string &path) {
+        std::ifstream sidecar(path, std::ios::binary);
+        if (!sidecar) {
+            return _createSidecar(path);
+        }
+
+        char magic[sizeof(SIDECAR_MAGIC)];
+        if (!sidecar.read(magic, sizeof(magic)) || std::memcmp(magic, SIDECAR_MAGIC, sizeof(magic)) != 0) {
+            logging::error("Verification cache: " + path + " is not a verification cache sidecar");
+            return false;
+        }
+        SectionDigest digest{};
+        while (sidecar.read(reinterpret_cast<char *>(&digest), sizeof(digest))) {
+            digests_.insert(digest);
+        }
+        if (sidecar.gcount() != 0) {
+            logging::error("Verification cache: " + path + " is truncated");
+            return false;
+        }
+        return true;
+    }
+
+    static bool _createSidecar(const std::string &path) {
+        std::ofstream sidecar(path, std::ios::binary | std::ios::trunc);
+        sidecar.write(SIDECAR_MAGIC, sizeof(SIDECAR_MAGIC));
+        if (!sidecar) {
+            logging::error("Verification cache: could not create " + path);
+            return false;
+        }
+        return true;
+    }
+
+    std::mutex mutex_;
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::string sidecarPath_;
+    std::set<SectionDigest, DigestLess> digests_;
+};
+
+} // namespace
+
+std::optional<SectionDigest> digestForVerificationCache(VerifiedSection kind, const void *data, uint64_t size,
+                                                        uint64_t digestedSize) {
+    if (!VerificationCache::instance().enabled()) {
+        return std::nullopt;
+    }
+    return SectionDigest{static_cast<uint32_t>(kind), 0, size, hashBytes(data, digestedSize)};
+}
+
+bool isVerificationCached(const SectionDigest &digest) { return VerificationCache::instance().contains(digest); }
+
+void recordVerification(const SectionDigest &digest) { VerificationCache::instance().insert(digest); }
+
+bool ConfigureVerificationCache(const VerificationCacheOptions &options) {
+    return VerificationCache::instance().configure(options);
+}
+
+void InvalidateVerificationCache() { VerificationCache::instance().invalidate(); }
+
+VerificationCacheStats GetVerificationCacheStats() { return VerificationCache::instance().stats(); }
+
+} // namespace mlsdk::vgflib
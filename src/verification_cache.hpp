@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace mlsdk::vgflib {
+
+/// Kind of verification whose result is cached. Values are persisted in sidecar files
+enum class VerifiedSection : uint32_t {
+    MODULE_TABLE = 1,
+    MODEL_SEQUENCE_TABLE = 2,
+    MODEL_RESOURCE_TABLE = 3,
+    CONSTANT_SECTION = 4,
+    CONSTANT_METADATA_V00 = 5,
+    CONSTANT_METADATA_V01 = 6,
+};
+
+/// Digest of the bytes a verification depends on
+struct SectionDigest {
+    uint32_t kind;
+    uint32_t reserved;
+    uint64_t size;
+    uint64_t hash;
+};
+
+/// \brief Digest the bytes of a section for the verification cache
+///
+/// \param kind Verification applied to the section
+/// \param data Start of the section
+/// \param size Size of the section in bytes
+/// \param digestedSize Number of leading bytes of the section that the verification reads
+/// \return The digest, or nullopt without reading the bytes when the cache is disabled
+std::optional<SectionDigest> digestForVerificationCache(VerifiedSection kind, const void *data, uint64_t size,
+                                                        uint64_t digestedSize);
+
+/// \brief Check whether a digest was recorded by an earlier successful verification, counting a hit or a miss
+bool isVerificationCached(const SectionDigest &digest);
+
+/// \brief Record the digest of a section that passed verification
+void recordVerification(const SectionDigest &digest);
+
+} // namespace mlsdk::vgflib
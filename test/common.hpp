@@ -6,7 +6,9 @@
 #pragma once
 
 #include "vgf-utils/temp_folder.hpp"
+#include "vgf/decoder.hpp"
 #include "vgf/encoder.h"
+#include "vgf/encoder.hpp"
 #include "vgf/logging.hpp"
 
 #include <algorithm>
@@ -16,6 +18,7 @@
 #include <fstream>
 #include <initializer_list>
 #include <iterator>
+#include <sstream>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -54,6 +57,15 @@ inline std::string ReadFile(const std::filesystem::path &path) {
     return {std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
 }
 
+/// Finishes the encoder and returns the encoded VGF file, or an empty string if it cannot be written
+inline std::string EncodeToString(Encoder &encoder) {
+    encoder.Finish();
+    std::stringstream buffer;
+    return encoder.WriteTo(buffer) ? buffer.str() : std::string{};
+}
+
+template <typename T> std::vector<T> ToVector(DataView<T> view) { return {view.begin(), view.end()}; }
+
 inline std::string FinishAndWriteCEncoder(mlsdk_encoder *encoder) {
     assert(encoder != nullptr && "encoder is null");
     TempFolder tempFolder("vgf_c_encoder_test");
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "vgf-utils/constant_prefetcher.hpp"
+#include "vgf-utils/memory_map.hpp"
+#include "vgf-utils/temp_folder.hpp"
+#include "vgf/decoder.hpp"
+#include "vgf/encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+using namespace mlsdk::vgfutils;
+
+namespace {
+
+constexpr FormatType VK_FORMAT_R8_UINT = 13;
+
+/// Three segments: constant 1 is used by segments 0 and 2, and constant 3 shares the payload of constant 0
+std::string WriteModel(const TempFolder &tempFolder) {
+    const size_t page = MemoryMap::pageSize();
+    const std::vector<std::vector<uint8_t>> payloads = {
+        std::vector<uint8_t>(3 * page, 1),
+        std::vector<uint8_t>(2 * page, 2),
+        std::vector<uint8_t>(2 * page + 100, 3),
+        std::vector<uint8_t>(3 * page, 1),
+    };
+    std::unique_ptr<Encoder> encoder = CreateEncoder(0);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "module", "main");
+    std::vector<ConstantRef> constants;
+    for (const std::vector<uint8_t> &payload : payloads) {
+        ResourceRef resource =
+            encoder->AddConstantResource(VK_FORMAT_R8_UINT, {static_cast<int64_t>(payload.size())}, {});
+        constants.push_back(encoder->AddConstant(resource, payload.data(), payload.size()));
+    }
+    encoder->AddSegmentInfo(module, "segment_0", {}, {}, {}, {constants[0], constants[1]});
+    encoder->AddSegmentInfo(module, "segment_1", {}, {}, {}, {constants[2]});
+    encoder->AddSegmentInfo(module, "segment_2", {}, {}, {}, {constants[1], constants[3]});
+    encoder->Finish();
+
+    const std::string filename = tempFolder.relative("model.vgf").string();
+    EXPECT_TRUE(encoder->WriteToFile(filename));
+    return filename;
+}
+
+bool Intersects(const MappedRange &lhs, const MappedRange &rhs) {
+    return lhs.offset < rhs.offset + rhs.size && rhs.offset < lhs.offset + lhs.size;
+}
+
+} // namespace
+
+TEST(ConstantPrefetcher, SegmentRanges) {
+    TempFolder tempFolder("constant_prefetcher_test");
+    MemoryMap mapped(WriteModel(tempFolder));
+    std::unique_ptr<VgfModel> model = CreateVgfModel(mapped.ptr(), mapped.size());
+    ASSERT_NE(model, nullptr);
+    const ModelSequenceTableDecoder &sequence = model->getModelSequenceTableDecoder();
+    const ConstantDecoder &constants = model->getConstantDecoder();
+
+    //! [ConstantPrefetcherSample0 begin]
+    ConstantPrefetcher prefetcher(mapped, sequence, constants);
+    constexpr uint32_t lookahead = 2;
+    prefetcher.prefetch(0, lookahead);
+    for (uint32_t segmentIdx = 0; segmentIdx < prefetcher.size(); ++segmentIdx) {
+        prefetcher.prefetch(segmentIdx + lookahead);
+        // Run the segment, then release the constants no later segment uses
+        prefetcher.evict(segmentIdx);
+    }
+    //! [ConstantPrefetcherSample0 end]
+
+    ASSERT_EQ(prefetcher.size(), 3);
+    const auto constantRange = [&](uint32_t constantIdx) {
+        const DataView<uint8_t> data = constants.getConstant(constantIdx);
+        return MappedRange{static_cast<size_t>(data.begin() - static_cast<const uint8_t *>(mapped.ptr())),
+                           data.size()};
+    };
+
+    // Every constant of a segment is covered by one of its ranges
+    for (uint32_t segmentIdx = 0; segmentIdx < prefetcher.size(); ++segmentIdx) {
+        const DataView<MappedRange> ranges = prefetcher.getSegmentRanges(segmentIdx);
+        ASSERT_FALSE(ranges.empty());
+        for (const uint32_t constantIdx : sequence.getSegmentConstantIndexes(segmentIdx)) {
+            const MappedRange constant = constantRange(constantIdx);
+            bool covered = false;
+            for (const MappedRange &range : ranges) {
+                covered = covered || (range.offset <= constant.offset &&
+                                      constant.offset + constant.size <= range.offset + range.size);
+            }
+            EXPECT_TRUE(covered) << "segment " << segmentIdx << " constant " << constantIdx;
+        }
+    }
+
+    // Evicted pages are whole and hold no constant of a later segment
+    const size_t page = MemoryMap::pageSize();
+    EXPECT_TRUE(prefetcher.getEvictionRanges(0).empty());
+    EXPECT_FALSE(prefetcher.getEvictionRanges(1).empty());
+    EXPECT_FALSE(prefetcher.getEvictionRanges(2).empty());
+    for (uint32_t segmentIdx = 0; segmentIdx < prefetcher.size(); ++segmentIdx) {
+        for (const MappedRange &range : prefetcher.getEvictionRanges(segmentIdx)) {
+            EXPECT_EQ(range.offset % page, 0);
+            EXPECT_EQ(range.size % page, 0);
+            for (uint32_t laterIdx = segmentIdx + 1; laterIdx < prefetcher.size(); ++laterIdx) {
+                for (const uint32_t constantIdx : sequence.getSegmentConstantIndexes(laterIdx)) {
+                    EXPECT_FALSE(Intersects(range, constantRange(constantIdx)))
+                        << "segment " << segmentIdx << " evicts constant " << constantIdx;
+                }
+            }
+        }
+    }
+
+    EXPECT_TRUE(prefetcher.getSegmentRanges(3).empty());
+    EXPECT_TRUE(prefetcher.getEvictionRanges(3).empty());
+}
+
+TEST(ConstantPrefetcher, EvictedConstantsReadBack) {
+    TempFolder tempFolder("constant_prefetcher_test");
+    MemoryMap mapped(WriteModel(tempFolder));
+    std::unique_ptr<VgfModel> model = CreateVgfModel(mapped.ptr(), mapped.size());
+    ASSERT_NE(model, nullptr);
+    const ConstantDecoder &constants = model->getConstantDecoder();
+    ConstantPrefetcher prefetcher(mapped, model->getModelSequenceTableDecoder(), constants);
+
+    EXPECT_TRUE(prefetcher.prefetch(0, prefetcher.size()));
+    EXPECT_TRUE(prefetcher.prefetch(2, 100));
+    for (uint32_t segmentIdx = 0; segmentIdx < prefetcher.size(); ++segmentIdx) {
+        EXPECT_TRUE(prefetcher.evict(segmentIdx));
+    }
+
+    // Pages dropped from the read only mapping are read back from the file
+    const DataView<uint8_t> constant = constants.getConstant(2);
+    ASSERT_EQ(constant.size(), 2 * MemoryMap::pageSize() + 100);
+    for (const uint8_t value : constant) {
+        ASSERT_EQ(value, 3);
+    }
+}
+
+TEST(ConstantPrefetcher, ConstantsOutsideMappingRejected) {
+    TempFolder tempFolder("constant_prefetcher_test");
+    MemoryMap mapped(WriteModel(tempFolder));
+    const std::string copy(static_cast<const char *>(mapped.ptr()), mapped.size());
+    std::unique_ptr<VgfModel> model = CreateVgfModel(copy.data(), copy.size());
+    ASSERT_NE(model, nullptr);
+
+    EXPECT_THROW(ConstantPrefetcher(mapped, model->getModelSequenceTableDecoder(), model->getConstantDecoder()),
+                 std::runtime_error);
+}
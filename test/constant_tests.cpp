@@ -17,6 +17,7 @@
 
 #include <array>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -107,6 +108,306 @@ TEST(CppEncodeDecode, AddNonSparseConstant) {
     ASSERT_TRUE(decoder->isSparseConstant(constantRef.reference) == false);
 }
 
+TEST(CppEncodeDecode, AddBorrowedConstant) {
+    std::stringstream buffer;
+
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+
+    ResourceRef resourceRef = {42};
+    auto constant = std::make_shared<std::vector<uint8_t>>(std::initializer_list<uint8_t>{'a', 'b', 'c'});
+    const std::vector<uint8_t> expected = *constant;
+    std::weak_ptr<std::vector<uint8_t>> observer = constant;
+
+    const uint8_t *constantData = constant->data();
+    ConstantRef borrowedRef =
+        encoder->AddBorrowedConstant(resourceRef, constantData, expected.size(), 1, std::move(constant));
+    const std::vector<uint8_t> copied{'d'};
+    ConstantRef copiedRef = encoder->AddConstant(resourceRef, copied.data(), copied.size());
+
+    encoder->Finish();
+    ASSERT_FALSE(observer.expired());
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+    ASSERT_TRUE(observer.expired());
+
+    std::string data = buffer.str();
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+
+    ASSERT_EQ(decoder->size(), 2);
+    ASSERT_TRUE(decoder->getConstant(borrowedRef.reference) == DataView<uint8_t>(expected.data(), expected.size()));
+    ASSERT_EQ(decoder->getConstantSparsityDimension(borrowedRef.reference), 1);
+    ASSERT_TRUE(decoder->getConstant(copiedRef.reference) == DataView<uint8_t>(copied.data(), copied.size()));
+    ASSERT_EQ(headerDecoder->GetConstantsSize(),
+              CONSTANT_SECTION_METADATA_OFFSET + 2 * sizeof(ConstantMetaDataV00) + 2 * sizeof(uint64_t));
+}
+
+TEST(CppEncodeDecode, BorrowedConstantReleasedOnDestroy) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+
+    auto constant = std::make_shared<std::vector<uint8_t>>(16, 7);
+    std::weak_ptr<std::vector<uint8_t>> observer = constant;
+    const uint8_t *constantData = constant->data();
+    encoder->AddBorrowedConstant({0}, constantData, 16, CONSTANT_NOT_SPARSE_DIMENSION, std::move(constant));
+
+    ASSERT_FALSE(observer.expired());
+    encoder.reset();
+    ASSERT_TRUE(observer.expired());
+}
+
+TEST(CppEncodeDecode, IdenticalConstantsShareStorage) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+
+    const std::vector<uint8_t> weight(100, 'w');
+    const std::vector<uint8_t> other(100, 'o');
+    auto borrowed = std::make_shared<std::vector<uint8_t>>(weight);
+    std::weak_ptr<std::vector<uint8_t>> observer = borrowed;
+    const uint8_t *borrowedData = borrowed->data();
+
+    encoder->AddConstant({0}, weight.data(), weight.size());
+    encoder->AddConstant({1}, other.data(), other.size());
+    encoder->AddConstant({2}, weight.data(), weight.size(), 1);
+    encoder->AddBorrowedConstant({3}, borrowedData, weight.size(), CONSTANT_NOT_SPARSE_DIMENSION, std::move(borrowed));
+    encoder->AddConstant({4}, weight.data(), weight.size() - 1);
+    // A shared payload is not retained, so the owner is released straight away
+    ASSERT_TRUE(observer.expired());
+
+    encoder->Finish();
+    std::stringstream buffer;
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+    std::string data = buffer.str();
+
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+
+    ASSERT_EQ(decoder->size(), 5);
+    const DataView<uint8_t> weightView(weight.data(), weight.size());
+    ASSERT_TRUE(decoder->getConstant(0) == weightView);
+    ASSERT_TRUE(decoder->getConstant(1) == DataView<uint8_t>(other.data(), other.size()));
+    ASSERT_TRUE(decoder->getConstant(2) == weightView);
+    ASSERT_TRUE(decoder->getConstant(3) == weightView);
+    ASSERT_TRUE(decoder->getConstant(4) == DataView<uint8_t>(weight.data(), weight.size() - 1));
+    ASSERT_EQ(decoder->getConstant(2).begin(), decoder->getConstant(0).begin());
+    ASSERT_EQ(decoder->getConstant(3).begin(), decoder->getConstant(0).begin());
+    ASSERT_NE(decoder->getConstant(4).begin(), decoder->getConstant(0).begin());
+    ASSERT_EQ(decoder->getConstantMrtIndex(2), 2);
+    ASSERT_EQ(decoder->getConstantSparsityDimension(2), 1);
+
+    // Only the three distinct payloads are stored, each padded to 8 bytes
+    const uint64_t expectedSize = CONSTANT_SECTION_METADATA_OFFSET + 5 * sizeof(ConstantMetaDataV00) + 3 * 104;
+    ASSERT_EQ(headerDecoder->GetConstantsSize(), expectedSize);
+}
+
+TEST(CppEncodeDecode, IdenticalConstantsWithStricterAlignmentNotShared) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+
+    const std::vector<uint8_t> weight(24, 'w');
+    encoder->AddConstant({0}, weight.data(), weight.size());
+    encoder->AddConstant({1}, weight.data(), weight.size());
+    encoder->SetConstantAlignment(64);
+    encoder->AddConstant({2}, weight.data(), weight.size());
+    encoder->AddConstant({3}, weight.data(), weight.size());
+
+    encoder->Finish();
+    std::stringstream buffer;
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+    std::string data = buffer.str();
+
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+
+    ASSERT_EQ(decoder->size(), 4);
+    ASSERT_EQ(decoder->getConstant(1).begin(), decoder->getConstant(0).begin());
+    // The first payload starts at a 64-byte boundary, so it can still be shared
+    ASSERT_EQ(decoder->getConstant(2).begin(), decoder->getConstant(0).begin());
+    ASSERT_EQ(decoder->getConstant(3).begin(), decoder->getConstant(0).begin());
+    for (uint32_t i = 0; i < 4; ++i) {
+        const uint64_t alignment = decoder->getConstantAlignment(i);
+        ASSERT_TRUE(decoder->isConstantAligned(i, headerDecoder->GetConstantsOffset(), alignment));
+    }
+
+    std::unique_ptr<Encoder> misaligned = CreateEncoder(pretendVulkanHeaderVersion);
+    const std::vector<uint8_t> other(8, 'o');
+    misaligned->AddConstant({0}, other.data(), other.size());
+    misaligned->AddConstant({1}, weight.data(), weight.size());
+    misaligned->SetConstantAlignment(64);
+    misaligned->AddConstant({2}, weight.data(), weight.size());
+    misaligned->Finish();
+    std::stringstream misalignedBuffer;
+    ASSERT_TRUE(misaligned->WriteTo(misalignedBuffer));
+    data = misalignedBuffer.str();
+
+    headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_NE(decoder->getConstant(2).begin(), decoder->getConstant(1).begin());
+    ASSERT_TRUE(decoder->getConstant(2) == DataView<uint8_t>(weight.data(), weight.size()));
+    ASSERT_TRUE(decoder->isConstantAligned(2, headerDecoder->GetConstantsOffset(), 64));
+}
+
+TEST(CppEncodeDecode, StreamingEncoderIdenticalConstantsShareStorage) {
+    TempFolder tempFolder("vgf_streaming_encoder_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+
+    std::vector<uint8_t> weight(200000);
+    for (size_t i = 0; i < weight.size(); ++i) {
+        weight[i] = static_cast<uint8_t>(i * 7);
+    }
+    std::vector<uint8_t> nearlyWeight = weight;
+    nearlyWeight.back() ^= 1;
+
+    std::unique_ptr<StreamingEncoder> encoder = CreateStreamingEncoder(path.string(), pretendVulkanHeaderVersion, 1);
+    ASSERT_NE(encoder, nullptr);
+    encoder->AddConstant({0}, weight.data(), weight.size());
+    encoder->AddConstant({1}, nearlyWeight.data(), nearlyWeight.size());
+    encoder->AddConstant({2}, weight.data(), weight.size());
+    encoder->Finish();
+    ASSERT_TRUE(encoder->Close());
+
+    const std::string data = testutils::ReadFile(path);
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+
+    ASSERT_EQ(decoder->size(), 3);
+    ASSERT_TRUE(decoder->getConstant(1) == DataView<uint8_t>(nearlyWeight.data(), nearlyWeight.size()));
+    ASSERT_TRUE(decoder->getConstant(2) == DataView<uint8_t>(weight.data(), weight.size()));
+    ASSERT_NE(decoder->getConstant(1).begin(), decoder->getConstant(0).begin());
+    ASSERT_EQ(decoder->getConstant(2).begin(), decoder->getConstant(0).begin());
+}
+
+TEST(CppEncodeDecode, WriteToFileMatchesWriteTo) {
+    TempFolder tempFolder("vgf_write_to_file_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+
+    const auto encode = [](std::unique_ptr<Encoder> &encoder, const std::vector<std::vector<uint8_t>> &constants) {
+        encoder = CreateEncoder(pretendVulkanHeaderVersion);
+        encoder->AddModule(ModuleType::GRAPH, "module", "main");
+        for (size_t i = 0; i < constants.size(); ++i) {
+            encoder->SetConstantAlignment(i % 2 == 0 ? CONSTANT_DEFAULT_ALIGNMENT : 4096);
+            encoder->AddConstant({static_cast<uint32_t>(i)}, constants[i].data(), constants[i].size());
+        }
+        encoder->Finish();
+    };
+
+    // The large constant is split between several positional writes
+    std::vector<std::vector<uint8_t>> constants{{1, 2, 3}, std::vector<uint8_t>(100 * 1024 * 1024), {4}, {5, 6}};
+    for (size_t i = 0; i < constants[1].size(); i += 4096) {
+        constants[1][i] = static_cast<uint8_t>(i / 4096);
+    }
+
+    std::unique_ptr<Encoder> encoder;
+    encode(encoder, constants);
+    std::stringstream buffer;
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+
+    encode(encoder, constants);
+    ASSERT_TRUE(encoder->WriteToFile(path.string(), 3));
+    ASSERT_TRUE(testutils::ReadFile(path) == buffer.str());
+}
+
+TEST(CppEncodeDecode, SecondWriteRejected) {
+    TempFolder tempFolder("vgf_write_to_file_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+    const std::vector<uint8_t> constant{1, 2, 3};
+    const auto encode = [&constant]() {
+        std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+        encoder->AddConstant({0}, constant.data(), constant.size());
+        encoder->Finish();
+        return encoder;
+    };
+
+    std::unique_ptr<Encoder> encoder = encode();
+    std::stringstream buffer;
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+    std::vector<uint8_t> memory(encoder->GetEncodedSize());
+    {
+        Logger logger;
+        ASSERT_FALSE(encoder->WriteTo(buffer));
+        ASSERT_FALSE(encoder->WriteTo(memory.data(), memory.size()));
+        ASSERT_FALSE(encoder->WriteToFile(path.string()));
+        ASSERT_TRUE(logger.contains({"more than once"}));
+    }
+
+    encoder = encode();
+    ASSERT_TRUE(encoder->WriteToFile(path.string()));
+    ASSERT_FALSE(encoder->WriteToFile(path.string()));
+    ASSERT_TRUE(testutils::ReadFile(path) == buffer.str());
+
+    encoder = encode();
+    ASSERT_TRUE(encoder->WriteTo(memory.data(), memory.size()));
+    ASSERT_FALSE(encoder->WriteTo(memory.data(), memory.size()));
+    ASSERT_TRUE(std::string(memory.begin(), memory.end()) == testutils::ReadFile(path));
+}
+
+TEST(CppEncodeDecode, WriteToFileBadPath) {
+    TempFolder tempFolder("vgf_write_to_file_test");
+    const std::filesystem::path path = tempFolder.relative("missing").append("model.vgf");
+
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    encoder->Finish();
+
+    Logger logger;
+    ASSERT_FALSE(encoder->WriteToFile(path.string()));
+    ASSERT_TRUE(logger.contains({"Failed to open output file"}));
+}
+
+TEST(CppEncodeDecode, WriteToMemory) {
+    const std::vector<uint8_t> constant{1, 2, 3};
+    const auto encode = [&constant]() {
+        std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+        encoder->AddModule(ModuleType::GRAPH, "module", "main");
+        encoder->AddConstant({0}, constant.data(), constant.size());
+        encoder->SetConstantAlignment(256);
+        encoder->AddConstant({1}, constant.data(), constant.size() - 1);
+        encoder->Finish();
+        return encoder;
+    };
+
+    // Constant data is released once written, so each write uses its own encoder
+    std::unique_ptr<Encoder> encoder = encode();
+    std::stringstream buffer;
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+    const std::string expected = buffer.str();
+
+    encoder = encode();
+    ASSERT_EQ(encoder->GetEncodedSize(), expected.size());
+
+    // Stale bytes in the destination must be overwritten, including padding
+    std::vector<uint8_t> memory(expected.size() + 16, 0xff);
+    ASSERT_TRUE(encoder->WriteTo(memory.data(), memory.size()));
+    ASSERT_EQ(std::memcmp(memory.data(), expected.data(), expected.size()), 0);
+    ASSERT_EQ(memory.back(), 0xff);
+}
+
+TEST(CppEncodeDecode, WriteToMemoryTooSmall) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    encoder->Finish();
+
+    std::vector<uint8_t> memory(encoder->GetEncodedSize() - 1);
+    Logger logger;
+    ASSERT_FALSE(encoder->WriteTo(memory.data(), memory.size()));
+    ASSERT_TRUE(logger.contains({"smaller than the encoded size"}));
+}
+
 TEST(CppEncodeDecode, AddManyLargeNonSparseConstant) {
     TempFolder tempFolder("vgf_lib_model");
     const std::string filename = tempFolder.relative("Model.bin").string();
@@ -116,13 +417,14 @@ TEST(CppEncodeDecode, AddManyLargeNonSparseConstant) {
     std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
 
     const size_t largeConstsSize = 25000000; // 25MB
-    const std::vector<uint8_t> largeConst(largeConstsSize, 'l');
+    // Identical constants share storage, so the large constants differ to keep the file above 2GB
+    std::vector<uint8_t> largeConst(largeConstsSize, 'l');
     const uint32_t numLargeConsts = 10;
     const size_t smallConstsSize = 2000; // 2KB
     const std::vector<uint8_t> smallConst(smallConstsSize, 's');
     const uint32_t numSmallConsts = 1000;
     const size_t veryLargeConstsSize = 500000000; // 500MB
-    const std::vector<uint8_t> veryLargeConst(veryLargeConstsSize, 'L');
+    std::vector<uint8_t> veryLargeConst(veryLargeConstsSize, 'L');
     const uint32_t numVeryLargeConsts = 4;
     const size_t verySmallConstsSize = 1; // 1B
     const std::vector<uint8_t> verySmallConst(verySmallConstsSize, 'S');
@@ -134,6 +436,7 @@ TEST(CppEncodeDecode, AddManyLargeNonSparseConstant) {
     uint32_t constantsIndex = 0;
     for (; constantsIndex < numLargeConsts; ++constantsIndex) {
         ResourceRef resourceRef = {constantsIndex};
+        largeConst[0] = static_cast<uint8_t>(constantsIndex);
         constants.push_back(encoder->AddConstant(resourceRef, largeConst.data(), largeConst.size()));
     }
 
@@ -144,6 +447,7 @@ TEST(CppEncodeDecode, AddManyLargeNonSparseConstant) {
 
     for (; constantsIndex < numLargeConsts + numSmallConsts + numVeryLargeConsts; ++constantsIndex) {
         ResourceRef resourceRef = {constantsIndex};
+        veryLargeConst[0] = static_cast<uint8_t>(constantsIndex);
         constants.push_back(encoder->AddConstant(resourceRef, veryLargeConst.data(), veryLargeConst.size()));
     }
 
@@ -171,6 +475,7 @@ TEST(CppEncodeDecode, AddManyLargeNonSparseConstant) {
     ASSERT_TRUE(decoder->size() == numLargeConsts + numSmallConsts + numVeryLargeConsts + numVerySmallConsts);
     const DataView<uint8_t> largeConstsDataView(largeConst.data(), largeConstsSize);
     for (uint32_t i = 0; i < numLargeConsts; ++i) {
+        largeConst[0] = static_cast<uint8_t>(i);
         ASSERT_TRUE(decoder->getConstant(i) == largeConstsDataView);
         ASSERT_TRUE(decoder->getConstantMrtIndex(i) == constants[i].reference);
         ASSERT_TRUE(decoder->isSparseConstant(i) == false);
@@ -183,6 +488,7 @@ TEST(CppEncodeDecode, AddManyLargeNonSparseConstant) {
     }
     const DataView<uint8_t> veryLargeConstsDataView(veryLargeConst.data(), veryLargeConstsSize);
     for (uint32_t i = numLargeConsts + numSmallConsts; i < numLargeConsts + numSmallConsts + numVeryLargeConsts; ++i) {
+        veryLargeConst[0] = static_cast<uint8_t>(i);
         ASSERT_TRUE(decoder->getConstant(i) == veryLargeConstsDataView);
         ASSERT_TRUE(decoder->getConstantMrtIndex(i) == constants[i].reference);
         ASSERT_TRUE(decoder->isSparseConstant(i) == false);
@@ -195,6 +501,223 @@ TEST(CppEncodeDecode, AddManyLargeNonSparseConstant) {
         ASSERT_TRUE(decoder->isSparseConstant(i) == false);
     }
 }
+namespace {
+
+std::string EncodeStreamed(const std::filesystem::path &path, uint64_t constantCountHint,
+                           const std::vector<std::vector<uint8_t>> &constants) {
+    std::unique_ptr<StreamingEncoder> encoder =
+        CreateStreamingEncoder(path.string(), pretendVulkanHeaderVersion, constantCountHint);
+    if (encoder == nullptr) {
+        return {};
+    }
+    encoder->AddModule(ModuleType::COMPUTE, "streamed", "main", {0x07230203});
+    for (size_t i = 0; i < constants.size(); ++i) {
+        ResourceRef resourceRef = encoder->AddConstantResource(0, {static_cast<int64_t>(constants[i].size())}, {});
+        encoder->AddConstant(resourceRef, constants[i].data(), constants[i].size());
+    }
+    encoder->Finish();
+    std::stringstream unused;
+    if (encoder->WriteTo(unused) || !encoder->Close()) {
+        return {};
+    }
+    return testutils::ReadFile(path);
+}
+
+void CheckStreamed(const std::string &data, const std::vector<std::vector<uint8_t>> &constants) {
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    ASSERT_EQ(headerDecoder->GetConstantsOffset() % VGF_SECTION_ALIGNMENT_VALUE, 0);
+    ASSERT_GT(headerDecoder->GetModuleTableOffset(), headerDecoder->GetConstantsOffset());
+
+    std::unique_ptr<ModuleTableDecoder> moduleDecoder = CreateModuleTableDecoder(
+        data.c_str() + headerDecoder->GetModuleTableOffset(), headerDecoder->GetModuleTableSize());
+    ASSERT_NE(moduleDecoder, nullptr);
+    ASSERT_EQ(moduleDecoder->size(), 1);
+    ASSERT_EQ(moduleDecoder->getModuleName(0), "streamed");
+
+    std::unique_ptr<ModelResourceTableDecoder> resourceDecoder = CreateModelResourceTableDecoder(
+        data.c_str() + headerDecoder->GetModelResourceTableOffset(), headerDecoder->GetModelResourceTableSize());
+    ASSERT_NE(resourceDecoder, nullptr);
+    ASSERT_EQ(resourceDecoder->size(), constants.size());
+
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_EQ(decoder->size(), constants.size());
+    for (uint32_t i = 0; i < constants.size(); ++i) {
+        ASSERT_TRUE(decoder->getConstant(i) == DataView<uint8_t>(constants[i].data(), constants[i].size()));
+        ASSERT_EQ(decoder->getConstantMrtIndex(i), i);
+    }
+}
+
+} // namespace
+
+TEST(CppEncodeDecode, StreamingEncoder) {
+    TempFolder tempFolder("vgf_streaming_encoder_test");
+    const std::vector<std::vector<uint8_t>> constants{{1, 2, 3}, std::vector<uint8_t>(4096, 7), {9}};
+
+    const std::string data = EncodeStreamed(tempFolder.relative("model.vgf"), 8, constants);
+    ASSERT_FALSE(data.empty());
+    CheckStreamed(data, constants);
+}
+
+TEST(CppEncodeDecode, StreamingEncoderExceedsConstantCountHint) {
+    TempFolder tempFolder("vgf_streaming_encoder_test");
+    std::vector<std::vector<uint8_t>> constants;
+    for (uint8_t i = 0; i < 5; ++i) {
+        constants.emplace_back(static_cast<size_t>(3 + 400 * i), i);
+    }
+
+    const std::string data = EncodeStreamed(tempFolder.relative("model.vgf"), 1, constants);
+    ASSERT_FALSE(data.empty());
+    CheckStreamed(data, constants);
+}
+
+TEST(CppEncodeDecode, StreamingEncoderEmpty) {
+    TempFolder tempFolder("vgf_streaming_encoder_test");
+
+    const std::string data = EncodeStreamed(tempFolder.relative("model.vgf"), 0, {});
+    ASSERT_FALSE(data.empty());
+    CheckStreamed(data, {});
+}
+
+TEST(CEncodeDecode, StreamingEncoder) {
+    TempFolder tempFolder("vgf_streaming_encoder_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+
+    mlsdk_encoder *encoder = mlsdk_encoder_create_streaming(pretendVulkanHeaderVersion, path.string().c_str(), 0);
+    ASSERT_NE(encoder, nullptr);
+    const std::vector<uint8_t> constant{'a', 'b'};
+    mlsdk_encoder_constant_ref constantRef = mlsdk_encoder_add_constant(
+        encoder, {3}, constant.data(), constant.size(), MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION);
+    mlsdk_encoder_finish(encoder);
+    ASSERT_TRUE(mlsdk_encoder_close(encoder));
+    mlsdk_encoder_destroy(encoder);
+
+    const std::string data = testutils::ReadFile(path);
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_TRUE(decoder->getConstant(constantRef.reference) == DataView<uint8_t>(constant.data(), constant.size()));
+    ASSERT_EQ(decoder->getConstantMrtIndex(constantRef.reference), 3);
+}
+
+TEST(CppEncodeDecode, DefaultConstantAlignment) {
+    std::stringstream buffer;
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    const std::vector<uint8_t> constant{1, 2, 3};
+    ConstantRef constantRef = encoder->AddConstant({0}, constant.data(), constant.size());
+    encoder->Finish();
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+
+    std::string data = buffer.str();
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    ASSERT_EQ(std::memcmp(data.c_str() + headerDecoder->GetConstantsOffset(), CONSTANT_SECTION_VERSION,
+                          CONSTANT_SECTION_VERSION_SIZE),
+              0);
+
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + headerDecoder->GetConstantsOffset(), headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_EQ(decoder->getConstantAlignment(constantRef.reference), CONSTANT_DEFAULT_ALIGNMENT);
+    ASSERT_TRUE(decoder->isConstantAligned(constantRef.reference, headerDecoder->GetConstantsOffset(),
+                                           CONSTANT_DEFAULT_ALIGNMENT));
+    ASSERT_EQ(decoder->getConstantAlignment(1), 0);
+    ASSERT_FALSE(decoder->isConstantAligned(1, headerDecoder->GetConstantsOffset(), CONSTANT_DEFAULT_ALIGNMENT));
+}
+
+namespace {
+
+void CheckAlignedConstants(const std::string &data, const std::vector<std::vector<uint8_t>> &constants,
+                           const std::vector<uint64_t> &alignments) {
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    const uint64_t sectionOffset = headerDecoder->GetConstantsOffset();
+    ASSERT_EQ(std::memcmp(data.c_str() + sectionOffset, CONSTANT_SECTION_VERSION_V01, CONSTANT_SECTION_VERSION_SIZE),
+              0);
+
+    std::unique_ptr<ConstantDecoder> decoder =
+        CreateConstantDecoder(data.c_str() + sectionOffset, headerDecoder->GetConstantsSize());
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_EQ(decoder->size(), constants.size());
+    for (uint32_t i = 0; i < constants.size(); ++i) {
+        ASSERT_TRUE(decoder->getConstant(i) == DataView<uint8_t>(constants[i].data(), constants[i].size()));
+        ASSERT_EQ(decoder->getConstantAlignment(i), alignments[i]);
+        ASSERT_TRUE(decoder->isConstantAligned(i, sectionOffset, alignments[i]));
+        const auto *payload = reinterpret_cast<const char *>(decoder->getConstant(i).begin());
+        const auto fileOffset = static_cast<uint64_t>(payload - data.c_str());
+        ASSERT_EQ(fileOffset % alignments[i], 0);
+    }
+}
+
+} // namespace
+
+TEST(CppEncodeDecode, ConfigurableConstantAlignment) {
+    std::stringstream buffer;
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+
+    const std::vector<std::vector<uint8_t>> constants{{1, 2, 3}, std::vector<uint8_t>(5000, 4), {5}, {6, 7}};
+    const std::vector<uint64_t> alignments{CONSTANT_DEFAULT_ALIGNMENT, 4096, 64, CONSTANT_DEFAULT_ALIGNMENT};
+    for (size_t i = 0; i < constants.size(); ++i) {
+        encoder->SetConstantAlignment(i == 3 ? 1 : alignments[i]);
+        encoder->AddConstant({static_cast<uint32_t>(i)}, constants[i].data(), constants[i].size());
+    }
+    encoder->Finish();
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+
+    CheckAlignedConstants(buffer.str(), constants, alignments);
+}
+
+TEST(CppEncodeDecode, NonPowerOfTwoConstantAlignmentRejected) {
+    std::stringstream buffer;
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+
+    const std::vector<std::vector<uint8_t>> constants{{1, 2, 3}, {4, 5}, {6}};
+    const std::vector<uint64_t> alignments{64, 64, 64};
+    encoder->SetConstantAlignment(64);
+    encoder->AddConstant({0}, constants[0].data(), constants[0].size());
+    {
+        Logger logger;
+        encoder->SetConstantAlignment(12);
+        ASSERT_TRUE(logger.contains({"alignment", "12", "power of two"}));
+        encoder->SetConstantAlignment(0);
+        ASSERT_TRUE(logger.contains({"alignment", "0", "power of two"}));
+    }
+    for (size_t i = 1; i < constants.size(); ++i) {
+        encoder->AddConstant({static_cast<uint32_t>(i)}, constants[i].data(), constants[i].size());
+    }
+    encoder->Finish();
+    ASSERT_TRUE(encoder->WriteTo(buffer));
+
+    // The previous alignment is kept, so the file still verifies
+    CheckAlignedConstants(buffer.str(), constants, alignments);
+}
+
+TEST(CppEncodeDecode, StreamingEncoderConstantAlignment) {
+    TempFolder tempFolder("vgf_streaming_encoder_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+
+    const std::vector<std::vector<uint8_t>> constants{{1, 2, 3}, std::vector<uint8_t>(5000, 4), {5}};
+    const std::vector<uint64_t> alignments{4096, 4096, 16};
+    std::unique_ptr<StreamingEncoder> encoder = CreateStreamingEncoder(path.string(), pretendVulkanHeaderVersion, 1);
+    ASSERT_NE(encoder, nullptr);
+    for (size_t i = 0; i < constants.size(); ++i) {
+        encoder->SetConstantAlignment(alignments[i]);
+        encoder->AddConstant({static_cast<uint32_t>(i)}, constants[i].data(), constants[i].size());
+    }
+    encoder->Finish();
+    ASSERT_TRUE(encoder->Close());
+
+    CheckAlignedConstants(testutils::ReadFile(path), constants, alignments);
+}
+
 TEST(CppVerify, BadData) {
 
     uint8_t badData[16] = {0xde, 0xad, 0xbe, 0xef, 0xba, 0xad, 0xf0, 0x0d,
@@ -277,6 +800,22 @@ TEST(CppVerify, OutOfRangeOffsetsRejected) {
     EXPECT_TRUE(logger.contains({"VerifyConstant", "Constant metadata offset/size exceeds section bounds at index 0"}));
 }
 
+TEST(CppVerify, OverlappingConstantRangesAccepted) {
+    const std::vector<ConstantMetaDataV00> vecMetaData = {
+        ConstantMetaDataV00{0, -1, 8, 0},
+        ConstantMetaDataV00{1, -1, 8, 0},
+        ConstantMetaDataV00{2, -1, 4, 4},
+    };
+    const std::vector<uint8_t> constant = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+    std::vector<uint8_t> section = MakeConstantSectionV00(vecMetaData.size(), vecMetaData, constant);
+
+    std::unique_ptr<ConstantDecoder> decoder = CreateConstantDecoder(section.data(), section.size());
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_TRUE(decoder->getConstant(0) == DataView<uint8_t>(constant.data(), 8));
+    ASSERT_TRUE(decoder->getConstant(1) == DataView<uint8_t>(constant.data(), 8));
+    ASSERT_TRUE(decoder->getConstant(2) == DataView<uint8_t>(constant.data() + 4, 4));
+}
+
 TEST(CppVerify, BadSparsityDimensionRejected) {
     Logger logger;
     const uint64_t declaredCount = 1;
@@ -294,6 +833,25 @@ TEST(CppVerify, BadSparsityDimensionRejected) {
     EXPECT_TRUE(logger.contains({"VerifyConstant", "Constant sparsity dimension is invalid at index 0"}));
 }
 
+TEST(CppVerify, BadConstantAlignmentRejected) {
+    std::vector<uint8_t> buffer(CONSTANT_SECTION_METADATA_OFFSET + sizeof(ConstantMetaDataV01) + 8, 0);
+    std::memcpy(buffer.data(), CONSTANT_SECTION_VERSION_V01, CONSTANT_SECTION_VERSION_SIZE);
+    const uint64_t count = 1;
+    std::memcpy(buffer.data() + CONSTANT_SECTION_COUNT_OFFSET, &count, sizeof(count));
+    ConstantMetaDataV01 metaData{0, static_cast<int32_t>(CONSTANT_NOT_SPARSE_DIMENSION), 8, 0, 24};
+    std::memcpy(buffer.data() + CONSTANT_SECTION_METADATA_OFFSET, &metaData, sizeof(metaData));
+
+    Logger logger;
+    ASSERT_EQ(CreateConstantDecoder(buffer.data(), buffer.size()), nullptr);
+    ASSERT_TRUE(logger.contains({"VerifyConstant", "alignment is invalid at index 0"}));
+
+    metaData.alignment = 32;
+    std::memcpy(buffer.data() + CONSTANT_SECTION_METADATA_OFFSET, &metaData, sizeof(metaData));
+    std::unique_ptr<ConstantDecoder> decoder = CreateConstantDecoder(buffer.data(), buffer.size());
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_EQ(decoder->getConstantAlignment(0), 32);
+}
+
 TEST(CppVerify, EmptyConstantSection) {
     std::stringstream buffer;
 
@@ -418,6 +976,47 @@ TEST(CEncodeDecode, AddConstant) {
                 DataView<uint8_t>(constant.data(), constant.size()));
 }
 
+namespace {
+void CountRelease(void *userData) { ++*static_cast<int *>(userData); }
+} // namespace
+
+TEST(CEncodeDecode, AddBorrowedConstant) {
+    mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
+
+    mlsdk_encoder_resource_ref resourceRef = {42};
+    const std::vector<uint8_t> constant{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i'};
+    int releaseCount = 0;
+
+    mlsdk_encoder_constant_ref constantRef =
+        mlsdk_encoder_add_borrowed_constant(encoder, resourceRef, constant.data(), constant.size(),
+                                            MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION, CountRelease, &releaseCount);
+    ASSERT_EQ(releaseCount, 0);
+
+    std::string data = testutils::FinishAndWriteCEncoder(encoder);
+    ASSERT_EQ(releaseCount, 1);
+    ASSERT_TRUE(data.size() >= mlsdk_decoder_header_size());
+
+    std::vector<uint8_t> headerDecoderMemory(mlsdk_decoder_header_decoder_mem_reqs());
+    mlsdk_decoder_header_decoder *headerDecoder =
+        mlsdk_decoder_create_header_decoder(data.c_str(), static_cast<uint64_t>(mlsdk_decoder_header_size()),
+                                            static_cast<uint64_t>(data.size()), headerDecoderMemory.data());
+    ASSERT_TRUE(mlsdk_decoder_is_header_valid(headerDecoder));
+
+    mlsdk_decoder_vgf_section_info modelConstantsSection;
+    mlsdk_decoder_get_header_section_info(headerDecoder, mlsdk_decoder_section_constants, &modelConstantsSection);
+
+    std::vector<uint8_t> constantDecoderMemory(mlsdk_decoder_constant_table_decoder_mem_reqs());
+    mlsdk_decoder_constant_table_decoder *decoder = mlsdk_decoder_create_constant_table_decoder(
+        data.c_str() + modelConstantsSection.offset, modelConstantsSection.size, constantDecoderMemory.data());
+    ASSERT_NE(decoder, nullptr);
+
+    mlsdk_decoder_constant_data constantData;
+    mlsdk_decoder_constant_table_get_data(decoder, constantRef.reference, &constantData);
+    ASSERT_FALSE(mlsdk_decoder_constant_table_is_sparse(decoder, constantRef.reference));
+    ASSERT_TRUE(DataView<uint8_t>(constantData.data, constantData.size) ==
+                DataView<uint8_t>(constant.data(), constant.size()));
+}
+
 TEST(CEncodeDecode, AddNonSparseConstant) {
     mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
 
@@ -476,13 +1075,14 @@ TEST(CEncodeDecode, AddManyLargeNonSparseConstant) {
     mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
 
     const size_t largeConstsSize = 25000000; // 25MB
-    const std::vector<uint8_t> largeConst(largeConstsSize, 'l');
+    // Identical constants share storage, so the large constants differ to keep the file above 2GB
+    std::vector<uint8_t> largeConst(largeConstsSize, 'l');
     const uint32_t numLargeConsts = 10;
     const size_t smallConstsSize = 2000; // 2KB
     const std::vector<uint8_t> smallConst(smallConstsSize, 's');
     const uint32_t numSmallConsts = 1000;
     const size_t veryLargeConstsSize = 500000000; // 500MB
-    const std::vector<uint8_t> veryLargeConst(veryLargeConstsSize, 'L');
+    std::vector<uint8_t> veryLargeConst(veryLargeConstsSize, 'L');
     const uint32_t numVeryLargeConsts = 4;
     const size_t verySmallConstsSize = 1; // 1B
     const std::vector<uint8_t> verySmallConst(verySmallConstsSize, 'S');
@@ -494,6 +1094,7 @@ TEST(CEncodeDecode, AddManyLargeNonSparseConstant) {
     uint32_t constantsIndex = 0;
     for (; constantsIndex < numLargeConsts; ++constantsIndex) {
         mlsdk_encoder_resource_ref resourceRef = {constantsIndex};
+        largeConst[0] = static_cast<uint8_t>(constantsIndex);
         constants.push_back(mlsdk_encoder_add_constant(encoder, resourceRef, largeConst.data(), largeConst.size(),
                                                        MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION));
     }
@@ -506,6 +1107,7 @@ TEST(CEncodeDecode, AddManyLargeNonSparseConstant) {
 
     for (; constantsIndex < numLargeConsts + numSmallConsts + numVeryLargeConsts; ++constantsIndex) {
         mlsdk_encoder_resource_ref resourceRef = {constantsIndex};
+        veryLargeConst[0] = static_cast<uint8_t>(constantsIndex);
         constants.push_back(mlsdk_encoder_add_constant(encoder, resourceRef, veryLargeConst.data(),
                                                        veryLargeConst.size(),
                                                        MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION));
@@ -560,6 +1162,7 @@ TEST(CEncodeDecode, AddManyLargeNonSparseConstant) {
     mlsdk_decoder_constant_data constantData;
     const DataView<uint8_t> largeConstsDataView(largeConst.data(), largeConstsSize);
     for (uint32_t i = 0; i < numLargeConsts; ++i) {
+        largeConst[0] = static_cast<uint8_t>(i);
         mlsdk_decoder_constant_table_get_data(decoder, i, &constantData);
         ASSERT_TRUE(DataView<uint8_t>(constantData.data, constantData.size) == largeConstsDataView);
     }
@@ -570,6 +1173,7 @@ TEST(CEncodeDecode, AddManyLargeNonSparseConstant) {
     }
     const DataView<uint8_t> veryLargeConstsDataView(veryLargeConst.data(), veryLargeConstsSize);
     for (uint32_t i = numLargeConsts + numSmallConsts; i < numLargeConsts + numSmallConsts + numVeryLargeConsts; ++i) {
+        veryLargeConst[0] = static_cast<uint8_t>(i);
         mlsdk_decoder_constant_table_get_data(decoder, i, &constantData);
         ASSERT_TRUE(DataView<uint8_t>(constantData.data, constantData.size) == veryLargeConstsDataView);
     }
@@ -581,6 +1185,91 @@ TEST(CEncodeDecode, AddManyLargeNonSparseConstant) {
     }
 }
 
+TEST(CEncodeDecode, ConstantAlignment) {
+    mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
+    const std::vector<uint8_t> constant{'a', 'b'};
+    mlsdk_encoder_add_constant(encoder, {0}, constant.data(), constant.size(),
+                               MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION);
+    mlsdk_encoder_set_constant_alignment(encoder, 256);
+    mlsdk_encoder_constant_ref constantRef = mlsdk_encoder_add_constant(
+        encoder, {1}, constant.data(), constant.size(), MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION);
+
+    std::string data = testutils::FinishAndWriteCEncoder(encoder);
+
+    std::vector<uint8_t> headerDecoderMemory(mlsdk_decoder_header_decoder_mem_reqs());
+    mlsdk_decoder_header_decoder *headerDecoder =
+        mlsdk_decoder_create_header_decoder(data.c_str(), static_cast<uint64_t>(mlsdk_decoder_header_size()),
+                                            static_cast<uint64_t>(data.size()), headerDecoderMemory.data());
+    ASSERT_NE(headerDecoder, nullptr);
+    mlsdk_decoder_vgf_section_info modelConstantsSection;
+    mlsdk_decoder_get_header_section_info(headerDecoder, mlsdk_decoder_section_constants, &modelConstantsSection);
+
+    std::vector<uint8_t> constantDecoderMemory(mlsdk_decoder_constant_table_decoder_mem_reqs());
+    mlsdk_decoder_constant_table_decoder *decoder = mlsdk_decoder_create_constant_table_decoder(
+        data.c_str() + modelConstantsSection.offset, modelConstantsSection.size, constantDecoderMemory.data());
+    ASSERT_NE(decoder, nullptr);
+
+    ASSERT_EQ(mlsdk_decoder_constant_table_get_alignment(decoder, 0), 8);
+    ASSERT_EQ(mlsdk_decoder_constant_table_get_alignment(decoder, constantRef.reference), 256);
+    ASSERT_TRUE(
+        mlsdk_decoder_constant_table_is_aligned(decoder, constantRef.reference, modelConstantsSection.offset, 256));
+    ASSERT_FALSE(
+        mlsdk_decoder_constant_table_is_aligned(decoder, constantRef.reference, modelConstantsSection.offset + 8, 256));
+}
+
+TEST(CEncodeDecode, WriteToFileParallel) {
+    TempFolder tempFolder("vgf_c_encoder_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+    const std::vector<uint8_t> constant(10000, 'c');
+    const auto encode = [&constant]() {
+        mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
+        mlsdk_encoder_set_constant_alignment(encoder, 4096);
+        mlsdk_encoder_add_constant(encoder, {0}, constant.data(), constant.size(),
+                                   MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION);
+        return encoder;
+    };
+
+    const std::string expected = testutils::FinishAndWriteCEncoder(encode());
+    ASSERT_FALSE(expected.empty());
+
+    mlsdk_encoder *encoder = encode();
+    mlsdk_encoder_finish(encoder);
+    ASSERT_TRUE(mlsdk_encoder_write_to_file_parallel(encoder, path.string().c_str(), 2));
+    mlsdk_encoder_destroy(encoder);
+    ASSERT_TRUE(testutils::ReadFile(path) == expected);
+}
+
+TEST(CEncodeDecode, WriteToMemory) {
+    mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
+    const std::vector<uint8_t> constant{'a', 'b', 'c'};
+    mlsdk_encoder_constant_ref constantRef = mlsdk_encoder_add_constant(
+        encoder, {0}, constant.data(), constant.size(), MLSDK_ENCODER_CONSTANT_NOT_SPARSE_DIMENSION);
+    mlsdk_encoder_finish(encoder);
+
+    const uint64_t size = mlsdk_encoder_get_encoded_size(encoder);
+    ASSERT_GT(size, 0);
+    std::vector<uint8_t> memory(size);
+    ASSERT_FALSE(mlsdk_encoder_write_to_memory(encoder, memory.data(), memory.size() - 1));
+    ASSERT_TRUE(mlsdk_encoder_write_to_memory(encoder, memory.data(), memory.size()));
+    mlsdk_encoder_destroy(encoder);
+
+    std::vector<uint8_t> headerDecoderMemory(mlsdk_decoder_header_decoder_mem_reqs());
+    mlsdk_decoder_header_decoder *headerDecoder = mlsdk_decoder_create_header_decoder(
+        memory.data(), static_cast<uint64_t>(mlsdk_decoder_header_size()), size, headerDecoderMemory.data());
+    ASSERT_NE(headerDecoder, nullptr);
+    mlsdk_decoder_vgf_section_info constantsSection;
+    mlsdk_decoder_get_header_section_info(headerDecoder, mlsdk_decoder_section_constants, &constantsSection);
+
+    std::vector<uint8_t> constantDecoderMemory(mlsdk_decoder_constant_table_decoder_mem_reqs());
+    mlsdk_decoder_constant_table_decoder *decoder = mlsdk_decoder_create_constant_table_decoder(
+        memory.data() + constantsSection.offset, constantsSection.size, constantDecoderMemory.data());
+    ASSERT_NE(decoder, nullptr);
+    mlsdk_decoder_constant_data constantData;
+    mlsdk_decoder_constant_table_get_data(decoder, constantRef.reference, &constantData);
+    ASSERT_TRUE(DataView<uint8_t>(constantData.data, constantData.size) ==
+                DataView<uint8_t>(constant.data(), constant.size()));
+}
+
 TEST(CVerify, BadData) {
 
     uint8_t badData[16] = {0xde, 0xad, 0xbe, 0xef, 0xba, 0xad, 0xf0, 0x0d,
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "crc32c.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+
+namespace {
+
+std::vector<uint8_t> PatternData(size_t size) {
+    std::vector<uint8_t> data(size);
+    uint32_t state = 0x12345678;
+    for (auto &byte : data) {
+        state = state * 1664525 + 1013904223;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST(Crc32c, CheckValue) {
+    const std::string data = "123456789";
+    ASSERT_EQ(crc32c(0, data.data(), data.size()), 0xE3069283);
+    ASSERT_EQ(crc32c(0, nullptr, 0), 0);
+}
+
+TEST(Crc32c, ChainingMatchesOneShot) {
+    // Large enough to use the interleaved hardware path
+    const std::vector<uint8_t> data = PatternData(3 * 4096 * 2 + 123);
+    const uint32_t expected = crc32c(0, data.data(), data.size());
+
+    uint32_t chained = 0;
+    for (const uint8_t byte : data) {
+        chained = crc32c(chained, &byte, 1);
+    }
+    ASSERT_EQ(chained, expected);
+
+    const size_t split = 5001;
+    ASSERT_EQ(crc32c(crc32c(0, data.data(), split), data.data() + split, data.size() - split), expected);
+}
+
+TEST(Crc32c, CombineMatchesOneShot) {
+    const std::vector<uint8_t> data = PatternData(20000);
+    const uint32_t expected = crc32c(0, data.data(), data.size());
+
+    for (const size_t split : {size_t{0}, size_t{1}, size_t{4096}, size_t{12345}, data.size()}) {
+        const uint32_t first = crc32c(0, data.data(), split);
+        const uint32_t second = crc32c(0, data.data() + split, data.size() - split);
+        ASSERT_EQ(crc32cCombine(first, second, data.size() - split), expected);
+    }
+}
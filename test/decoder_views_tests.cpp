@@ -0,0 +1,241 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.hpp"
+#include "vgf/decoder.hpp"
+#include "vgf/decoder_views.hpp"
+#include "vgf/encoder.hpp"
+#include "vgf/types.hpp"
+
+#include "header.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+using logging::utils::Logger;
+
+const uint16_t pretendVulkanHeaderVersion = 123;
+
+namespace {
+
+std::string EncodeModel() {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    ModuleRef spirv = encoder->AddModule(ModuleType::COMPUTE, "spirv_module", "main", {0x07230203, 1, 2, 3});
+    encoder->AddModule(ModuleType::GRAPH, "glsl_module", "entry", ShaderType::GLSL, "void main() {}");
+    encoder->AddModule(ModuleType::COMPUTE, "hlsl_module", "main", ShaderType::HLSL, "[numthreads(1,1,1)]");
+
+    ResourceRef input = encoder->AddInputResource(1, 2, {1, 4}, {16, 4}, AliasGroupId{7});
+    ResourceRef output = encoder->AddOutputResource(3, 4, {1, 4}, {});
+    ResourceRef weights = encoder->AddConstantResource(5, {4}, {});
+    encoder->AddSamplerConfig(input, 1, 2, 3, 4, 5);
+
+    const std::vector<uint8_t> weightsData{1, 2, 3, 4};
+    ConstantRef constant = encoder->AddConstant(weights, weightsData.data(), weightsData.size());
+    encoder->SetConstantAlignment(64);
+    ConstantRef sparse = encoder->AddConstant(weights, weightsData.data(), 2, 0);
+
+    BindingSlotRef inputSlot = encoder->AddBindingSlot(0, input);
+    BindingSlotRef outputSlot = encoder->AddBindingSlot(1, output);
+    DescriptorSetInfoRef unindexed = encoder->AddDescriptorSetInfo({inputSlot, outputSlot});
+    DescriptorSetInfoRef indexed = encoder->AddDescriptorSetInfo({outputSlot}, 5);
+    PushConstRangeRef range = encoder->AddPushConstRange(16, 8, 12);
+    encoder->AddSegmentInfo(spirv, "segment", {unindexed, indexed}, {inputSlot}, {outputSlot}, {constant, sparse},
+                            {2, 3, 4}, {range});
+    encoder->AddModelSequenceInputsOutputs({inputSlot}, {"input"}, {outputSlot}, {"output"});
+    return testutils::EncodeToString(*encoder);
+}
+
+struct Sections {
+    const char *modules;
+    uint64_t modulesSize;
+    const char *sequence;
+    uint64_t sequenceSize;
+    const char *resources;
+    uint64_t resourcesSize;
+    const char *constants;
+    uint64_t constantsSize;
+    uint64_t constantsOffset;
+};
+
+Sections GetSections(const std::string &data) {
+    std::unique_ptr<HeaderDecoder> header =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    EXPECT_NE(header, nullptr);
+    return {data.c_str() + header->GetModuleTableOffset(),
+            header->GetModuleTableSize(),
+            data.c_str() + header->GetModelSequenceTableOffset(),
+            header->GetModelSequenceTableSize(),
+            data.c_str() + header->GetModelResourceTableOffset(),
+            header->GetModelResourceTableSize(),
+            data.c_str() + header->GetConstantsOffset(),
+            header->GetConstantsSize(),
+            header->GetConstantsOffset()};
+}
+
+} // namespace
+
+TEST(CppDecoderViews, ModelSequenceViewMatchesDecoder) {
+    const std::string data = EncodeModel();
+    const Sections sections = GetSections(data);
+
+    //! [ModelSequenceViewSample0 begin]
+    std::optional<ModelSequenceView> view = CreateModelSequenceView(sections.sequence, sections.sequenceSize);
+    ASSERT_TRUE(view.has_value());
+    for (uint32_t segmentIdx = 0; segmentIdx < view->size(); ++segmentIdx) {
+        const SegmentView segment = view->segment(segmentIdx);
+        const BindingSlotsView inputs = segment.inputs();
+        for (uint32_t slotIdx = 0; slotIdx < inputs.size(); ++slotIdx) {
+            ASSERT_EQ(inputs.binding(slotIdx), 0);
+            ASSERT_EQ(inputs.mrtIndex(slotIdx), 0);
+        }
+    }
+    //! [ModelSequenceViewSample0 end]
+
+    std::unique_ptr<ModelSequenceTableDecoder> decoder =
+        CreateModelSequenceTableDecoder(sections.sequence, sections.sequenceSize);
+    ASSERT_NE(decoder, nullptr);
+    ASSERT_EQ(view->size(), decoder->modelSequenceTableSize());
+
+    const SegmentView segment = view->segment(0);
+    ASSERT_EQ(segment.name(), "segment");
+    ASSERT_EQ(segment.name(), decoder->getSegmentName(0));
+    ASSERT_EQ(segment.type(), ModuleType::COMPUTE);
+    ASSERT_EQ(segment.moduleIndex(), 0);
+    ASSERT_EQ(segment.descriptorSetInfosSize(), 2);
+    ASSERT_EQ(segment.descriptorSetIndex(0), 0);
+    ASSERT_EQ(segment.descriptorSetIndex(1), 5);
+    ASSERT_EQ(segment.descriptorSetIndex(1), decoder->getSegmentDescriptorSetIndex(0, 1));
+    ASSERT_EQ(segment.descriptorBindingSlots(0).size(), 2);
+    ASSERT_EQ(segment.descriptorBindingSlots(0).binding(1), 1);
+    ASSERT_EQ(segment.descriptorBindingSlots(0).mrtIndex(1), 1);
+    ASSERT_EQ(segment.descriptorBindingSlots(0).data(), decoder->getDescriptorBindingSlotsHandle(0, 0));
+    ASSERT_EQ(segment.inputs().data(), decoder->getSegmentInputBindingSlotsHandle(0));
+    ASSERT_EQ(segment.outputs().binding(0), 1);
+    ASSERT_EQ(segment.constantIndexes(), decoder->getSegmentConstantIndexes(0));
+    ASSERT_EQ(segment.constantIndexes().size(), 2);
+    ASSERT_EQ(segment.dispatchShape(), decoder->getSegmentDispatchShape(0));
+    ASSERT_EQ(segment.dispatchShape()[2], 4);
+
+    const PushConstantRangesView ranges = segment.pushConstantRanges();
+    ASSERT_EQ(ranges.data(), decoder->getSegmentPushConstRange(0));
+    ASSERT_EQ(ranges.size(), 1);
+    ASSERT_EQ(ranges.stageFlags(0), 16);
+    ASSERT_EQ(ranges.offset(0), 8);
+    ASSERT_EQ(ranges.rangeSize(0), 12);
+
+    ASSERT_EQ(view->inputs().size(), 1);
+    ASSERT_EQ(view->outputs().binding(0), 1);
+    ASSERT_EQ(view->inputNames().size(), 1);
+    ASSERT_EQ(view->inputNames().name(0), "input");
+    ASSERT_EQ(view->outputNames().name(0), "output");
+    ASSERT_EQ(view->outputNames().data(), decoder->getModelSequenceOutputNamesHandle());
+}
+
+TEST(CppDecoderViews, ModuleTableView) {
+    const std::string data = EncodeModel();
+    const Sections sections = GetSections(data);
+
+    std::optional<ModuleTableView> view = CreateModuleTableView(sections.modules, sections.modulesSize);
+    ASSERT_TRUE(view.has_value());
+    ASSERT_EQ(view->size(), 3);
+
+    const ModuleView spirv = view->module(0);
+    ASSERT_EQ(spirv.name(), "spirv_module");
+    ASSERT_EQ(spirv.entryPoint(), "main");
+    ASSERT_EQ(spirv.type(), ModuleType::COMPUTE);
+    ASSERT_TRUE(spirv.isSPIRV());
+    ASSERT_FALSE(spirv.isGLSL());
+    ASSERT_EQ(spirv.spirvCode().size(), 4);
+    ASSERT_EQ(spirv.spirvCode()[0], 0x07230203);
+    ASSERT_TRUE(spirv.glslCode().empty());
+
+    const ModuleView glsl = view->module(1);
+    ASSERT_EQ(glsl.type(), ModuleType::GRAPH);
+    ASSERT_TRUE(glsl.isGLSL());
+    ASSERT_EQ(glsl.glslCode(), "void main() {}");
+    ASSERT_TRUE(glsl.spirvCode().empty());
+
+    const ModuleView hlsl = view->module(2);
+    ASSERT_TRUE(hlsl.isHLSL());
+    ASSERT_EQ(hlsl.hlslCode(), "[numthreads(1,1,1)]");
+}
+
+TEST(CppDecoderViews, ModelResourceView) {
+    const std::string data = EncodeModel();
+    const Sections sections = GetSections(data);
+
+    std::optional<ModelResourceView> view = CreateModelResourceView(sections.resources, sections.resourcesSize);
+    ASSERT_TRUE(view.has_value());
+    ASSERT_EQ(view->size(), 3);
+
+    const ModelResourceEntryView input = view->entry(0);
+    ASSERT_EQ(input.category(), ResourceCategory::INPUT);
+    ASSERT_EQ(input.descriptorType(), 1);
+    ASSERT_EQ(input.vkFormat(), 2);
+    ASSERT_EQ(input.aliasGroupId(), AliasGroupId{7});
+    ASSERT_EQ(input.tensorShape().size(), 2);
+    ASSERT_EQ(input.tensorShape()[1], 4);
+    ASSERT_EQ(input.tensorStride()[0], 16);
+    const SamplerConfigView sampler = input.samplerConfig();
+    ASSERT_TRUE(sampler.valid());
+    ASSERT_EQ(sampler.minFilter(), 1);
+    ASSERT_EQ(sampler.magFilter(), 2);
+    ASSERT_EQ(sampler.addressModeU(), 3);
+    ASSERT_EQ(sampler.addressModeV(), 4);
+    ASSERT_EQ(sampler.borderColor(), 5);
+
+    const ModelResourceEntryView output = view->entry(1);
+    ASSERT_EQ(output.category(), ResourceCategory::OUTPUT);
+    ASSERT_FALSE(output.aliasGroupId().has_value());
+    ASSERT_TRUE(output.tensorStride().empty());
+    ASSERT_FALSE(output.samplerConfig().valid());
+
+    const ModelResourceEntryView weights = view->entry(2);
+    ASSERT_EQ(weights.category(), ResourceCategory::CONSTANT);
+    ASSERT_FALSE(weights.descriptorType().has_value());
+}
+
+TEST(CppDecoderViews, ConstantView) {
+    const std::string data = EncodeModel();
+    const Sections sections = GetSections(data);
+
+    std::optional<ConstantView> view = CreateConstantView(sections.constants, sections.constantsSize);
+    ASSERT_TRUE(view.has_value());
+    std::unique_ptr<ConstantDecoder> decoder = CreateConstantDecoder(sections.constants, sections.constantsSize);
+    ASSERT_NE(decoder, nullptr);
+
+    ASSERT_EQ(view->size(), 2);
+    for (uint32_t idx = 0; idx < view->size(); ++idx) {
+        ASSERT_EQ(view->data(idx), decoder->getConstant(idx));
+        ASSERT_EQ(view->mrtIndex(idx), decoder->getConstantMrtIndex(idx));
+        ASSERT_EQ(view->sparsityDimension(idx), decoder->getConstantSparsityDimension(idx));
+        ASSERT_EQ(view->isSparse(idx), decoder->isSparseConstant(idx));
+        ASSERT_EQ(view->alignment(idx), decoder->getConstantAlignment(idx));
+    }
+    ASSERT_FALSE(view->isSparse(0));
+    ASSERT_TRUE(view->isSparse(1));
+    ASSERT_EQ(view->alignment(1), 64);
+    const auto *section = reinterpret_cast<const uint8_t *>(sections.constants);
+    ASSERT_EQ((sections.constantsOffset + static_cast<uint64_t>(view->data(1).data() - section)) % 64, 0);
+}
+
+TEST(CppDecoderViews, InvalidSectionsRejected) {
+    Logger logger;
+    std::string data = EncodeModel();
+    const Sections sections = GetSections(data);
+    const auto offset = static_cast<size_t>(sections.resources - data.c_str());
+    std::memset(data.data() + offset, 0xFF, static_cast<size_t>(sections.resourcesSize));
+
+    ASSERT_FALSE(CreateModelResourceView(data.c_str() + offset, sections.resourcesSize).has_value());
+    ASSERT_TRUE(logger.contains({"Model resource table could not be decoded safely"}));
+
+    const std::vector<uint8_t> legacy(64, 0);
+    ASSERT_FALSE(CreateConstantView(legacy.data(), legacy.size()).has_value());
+    ASSERT_TRUE(logger.contains({"Legacy constant sections are not supported"}));
+}
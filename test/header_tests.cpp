@@ -183,3 +183,120 @@ TEST(CDecode, TruncatedHeaderRejected) {
                                             static_cast<uint64_t>(data.size()), decoderMemory.data());
     ASSERT_TRUE(nullptr == decoder);
 }
+
+namespace {
+
+std::unique_ptr<Encoder> EncodeWithChecksums(bool checksums) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    encoder->SetSectionChecksums(checksums);
+    encoder->AddModule(ModuleType::COMPUTE, "test_module", "main", {0x07230203, 1, 2, 3});
+    ResourceRef weights = encoder->AddConstantResource(FormatType{}, {4}, {});
+    const std::vector<uint8_t> small{1, 2, 3};
+    encoder->AddConstant(weights, small.data(), small.size());
+    encoder->SetConstantAlignment(4096);
+    const std::vector<uint8_t> large(10000, 0x5A);
+    encoder->AddConstant(weights, large.data(), large.size());
+    encoder->Finish();
+    return encoder;
+}
+
+std::string WriteWithChecksums(bool checksums) {
+    std::stringstream buffer;
+    EXPECT_TRUE(EncodeWithChecksums(checksums)->WriteTo(buffer));
+    return buffer.str();
+}
+
+} // namespace
+
+TEST(CppDecode, IntegrityValid) {
+    const std::string data = WriteWithChecksums(true);
+
+    //! [IntegrityCheckSample0 begin]
+    IntegrityStatus status = CheckIntegrity(data.c_str(), static_cast<uint64_t>(data.size()));
+    //! [IntegrityCheckSample0 end]
+    ASSERT_EQ(status, IntegrityStatus::VALID);
+    for (const auto section :
+         {SectionName::MODULES, SectionName::MODEL_SEQUENCE, SectionName::RESOURCES, SectionName::CONSTANTS}) {
+        ASSERT_EQ(CheckSectionIntegrity(data.c_str(), static_cast<uint64_t>(data.size()), section),
+                  IntegrityStatus::VALID);
+    }
+
+    std::unique_ptr<Encoder> encoder = EncodeWithChecksums(true);
+    std::vector<uint8_t> buffer(encoder->GetEncodedSize());
+    ASSERT_TRUE(encoder->WriteTo(buffer.data(), buffer.size()));
+    ASSERT_EQ(std::string(buffer.begin(), buffer.end()), data);
+
+    TempFolder tempFolder("vgf_integrity_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+    ASSERT_TRUE(EncodeWithChecksums(true)->WriteToFile(path.string(), 2));
+    ASSERT_EQ(testutils::ReadFile(path), data);
+}
+
+TEST(CppDecode, IntegrityNoChecksums) {
+    const std::string data = WriteWithChecksums(false);
+    ASSERT_EQ(CheckIntegrity(data.c_str(), static_cast<uint64_t>(data.size())), IntegrityStatus::NO_CHECKSUMS);
+    ASSERT_EQ(CheckSectionIntegrity(data.c_str(), static_cast<uint64_t>(data.size()), SectionName::CONSTANTS),
+              IntegrityStatus::NO_CHECKSUMS);
+}
+
+TEST(CppDecode, IntegrityCorrupted) {
+    logging::utils::Logger logger;
+    std::string data = WriteWithChecksums(true);
+    std::unique_ptr<HeaderDecoder> decoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(decoder, nullptr);
+    data[decoder->GetConstantsOffset() + decoder->GetConstantsSize() - 1] ^= 0x01;
+
+    ASSERT_EQ(CheckIntegrity(data.c_str(), static_cast<uint64_t>(data.size())), IntegrityStatus::CORRUPTED);
+    ASSERT_TRUE(logger.contains({"Constants section checksum mismatch"}));
+    ASSERT_EQ(CheckSectionIntegrity(data.c_str(), static_cast<uint64_t>(data.size()), SectionName::MODULES),
+              IntegrityStatus::VALID);
+}
+
+TEST(CppDecode, IntegrityInvalidFile) {
+    const std::string data = WriteWithChecksums(true);
+    ASSERT_EQ(CheckIntegrity(data.c_str(), HeaderSize() - 1), IntegrityStatus::INVALID_FILE);
+    ASSERT_EQ(CheckIntegrity(data.c_str(), static_cast<uint64_t>(data.size() - 1)), IntegrityStatus::INVALID_FILE);
+}
+
+TEST(CppDecode, IntegrityStreamingEncoder) {
+    TempFolder tempFolder("vgf_integrity_test");
+    const std::filesystem::path path = tempFolder.relative("model.vgf");
+
+    // A hint below the constant count moves the payloads when closing
+    std::unique_ptr<StreamingEncoder> encoder = CreateStreamingEncoder(path.string(), pretendVulkanHeaderVersion, 1);
+    ASSERT_NE(encoder, nullptr);
+    encoder->SetSectionChecksums(true);
+    ResourceRef weights = encoder->AddConstantResource(FormatType{}, {4}, {});
+    for (uint8_t i = 0; i < 3; ++i) {
+        const std::vector<uint8_t> constant(static_cast<size_t>(100 + 1000 * i), i);
+        encoder->AddConstant(weights, constant.data(), constant.size());
+        encoder->SetConstantAlignment(64);
+    }
+    encoder->Finish();
+    ASSERT_TRUE(encoder->Close());
+
+    const std::string data = testutils::ReadFile(path);
+    ASSERT_EQ(CheckIntegrity(data.c_str(), static_cast<uint64_t>(data.size())), IntegrityStatus::VALID);
+}
+
+TEST(CDecode, Integrity) {
+    std::string data = WriteWithChecksums(true);
+    ASSERT_EQ(mlsdk_decoder_check_integrity(data.c_str(), static_cast<uint64_t>(data.size())),
+              mlsdk_decoder_integrity_valid);
+
+    std::unique_ptr<HeaderDecoder> decoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(decoder, nullptr);
+    data[decoder->GetModuleTableOffset()] ^= 0x01;
+    ASSERT_EQ(mlsdk_decoder_check_section_integrity(data.c_str(), static_cast<uint64_t>(data.size()),
+                                                    mlsdk_decoder_section_modules),
+              mlsdk_decoder_integrity_corrupted);
+    ASSERT_EQ(mlsdk_decoder_check_section_integrity(data.c_str(), static_cast<uint64_t>(data.size()),
+                                                    mlsdk_decoder_section_constants),
+              mlsdk_decoder_integrity_valid);
+
+    const std::string unchecked = WriteWithChecksums(false);
+    ASSERT_EQ(mlsdk_decoder_check_integrity(unchecked.c_str(), static_cast<uint64_t>(unchecked.size())),
+              mlsdk_decoder_integrity_no_checksums);
+}
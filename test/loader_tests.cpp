@@ -0,0 +1,553 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.hpp"
+#include "vgf-utils/temp_folder.hpp"
+#include "vgf/decoder.h"
+#include "vgf/decoder.hpp"
+#include "vgf/encoder.hpp"
+#include "vgf/loader.hpp"
+
+#include "header.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+using logging::utils::Logger;
+
+namespace {
+
+constexpr FormatType VK_FORMAT_R8_UINT = 13;
+
+std::string EncodeModel() {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(0);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "module", "main");
+    std::vector<ConstantRef> constants;
+    for (uint32_t i = 0; i < 4; ++i) {
+        std::vector<uint8_t> payload(1000 * (i + 1));
+        for (size_t j = 0; j < payload.size(); ++j) {
+            payload[j] = static_cast<uint8_t>(i * 31 + j);
+        }
+        ResourceRef resource =
+            encoder->AddConstantResource(VK_FORMAT_R8_UINT, {static_cast<int64_t>(payload.size())}, {});
+        constants.push_back(encoder->AddConstant(resource, payload.data(), payload.size(), i == 2 ? 1 : -1));
+    }
+    encoder->AddSegmentInfo(module, "segment", {}, {}, {}, constants);
+    return testutils::EncodeToString(*encoder);
+}
+
+std::string WriteFile(const TempFolder &tempFolder, const std::string &content) {
+    const std::string filename = tempFolder.relative("model.vgf").string();
+    std::ofstream file(filename, std::ios::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return filename;
+}
+
+void ExpectMatchesModel(const VgfLoader &loader, const std::string &content) {
+    std::unique_ptr<VgfModel> model = CreateVgfModel(content.data(), content.size());
+    ASSERT_NE(model, nullptr);
+    const ConstantDecoder &constants = model->getConstantDecoder();
+
+    EXPECT_EQ(loader.getModuleTableDecoder().getModuleName(0), "module");
+    EXPECT_EQ(loader.getModelSequenceTableDecoder().getSegmentName(0), "segment");
+    EXPECT_EQ(loader.getModelResourceTableDecoder().size(), model->getModelResourceTableDecoder().size());
+    ASSERT_EQ(loader.getNumConstants(), constants.size());
+    for (uint32_t idx = 0; idx < constants.size(); ++idx) {
+        const DataView<uint8_t> expected = constants.getConstant(idx);
+        EXPECT_EQ(loader.getConstantMrtIndex(idx), constants.getConstantMrtIndex(idx));
+        EXPECT_EQ(loader.getConstantSparsityDimension(idx), constants.getConstantSparsityDimension(idx));
+        EXPECT_EQ(loader.getConstantSize(idx), expected.size());
+        EXPECT_EQ(loader.getConstantFileOffset(idx),
+                  static_cast<uint64_t>(expected.begin() - reinterpret_cast<const uint8_t *>(content.data())));
+
+        std::vector<uint8_t> data(expected.size());
+        ASSERT_TRUE(loader.readConstant(idx, data.data(), data.size()));
+        EXPECT_EQ(DataView<uint8_t>(data.data(), data.size()), expected);
+    }
+}
+
+} // namespace
+
+TEST(RangeReader, Memory) {
+    const std::string content = "0123456789";
+    std::unique_ptr<RangeReader> reader = CreateMemoryRangeReader(content.data(), content.size());
+    ASSERT_NE(reader, nullptr);
+    ASSERT_EQ(reader->size(), content.size());
+
+    char data[4] = {};
+    ASSERT_TRUE(reader->read(6, data, 4));
+    EXPECT_EQ(std::string(data, 4), "6789");
+    EXPECT_TRUE(reader->read(10, data, 0));
+    EXPECT_FALSE(reader->read(7, data, 4));
+    EXPECT_FALSE(reader->read(UINT64_MAX, data, 2));
+}
+
+TEST(RangeReader, Callback) {
+    uint32_t calls = 0;
+    const RangeReadCallback callback = [&](uint64_t offset, void *dst, uint64_t size) {
+        ++calls;
+        std::memset(dst, static_cast<int>(offset), static_cast<size_t>(size));
+        return true;
+    };
+    std::unique_ptr<RangeReader> reader = CreateCallbackRangeReader(100, callback);
+    ASSERT_NE(reader, nullptr);
+    ASSERT_EQ(reader->size(), 100);
+
+    uint8_t data[8] = {};
+    ASSERT_TRUE(reader->read(42, data, sizeof(data)));
+    EXPECT_EQ(data[7], 42);
+    EXPECT_FALSE(reader->read(96, data, sizeof(data)));
+    EXPECT_EQ(calls, 1);
+
+    EXPECT_EQ(CreateCallbackRangeReader(100, nullptr), nullptr);
+}
+
+TEST(RangeReader, SharedFileDescriptor) {
+    TempFolder tempFolder("loader_test");
+    std::string content(1 << 20, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>(i * 13);
+    }
+    const std::string filename = WriteFile(tempFolder, content);
+
+    std::FILE *file = std::fopen(filename.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    std::unique_ptr<RangeReader> first = CreateFileDescriptorRangeReader(fileno(file));
+    std::unique_ptr<RangeReader> second = CreateFileDescriptorRangeReader(fileno(file));
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(first->size(), content.size());
+
+    // Threads read interleaved chunks through both readers, so their reads race on the descriptor
+    constexpr uint32_t numThreads = 4;
+    constexpr size_t chunkSize = 4096;
+    std::atomic<uint32_t> mismatches{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            const RangeReader &reader = t % 2 == 0 ? *first : *second;
+            std::vector<char> chunk(chunkSize);
+            for (size_t offset = t * chunkSize; offset < content.size(); offset += numThreads * chunkSize) {
+                if (!reader.read(offset, chunk.data(), chunkSize) ||
+                    std::memcmp(chunk.data(), content.data() + offset, chunkSize) != 0) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches, 0);
+
+    first.reset();
+    second.reset();
+    // The readers borrow the descriptor, so it is still open
+    char byte = 0;
+    EXPECT_EQ(std::fread(&byte, 1, 1, file), 1);
+    EXPECT_EQ(byte, content[0]);
+    std::fclose(file);
+}
+
+TEST(RangeReader, MissingFile) {
+    TempFolder tempFolder("loader_test");
+    EXPECT_EQ(CreateFileRangeReader(tempFolder.relative("missing.vgf").string()), nullptr);
+}
+
+TEST(VgfLoader, File) {
+    TempFolder tempFolder("loader_test");
+    const std::string content = EncodeModel();
+    const std::string filename = WriteFile(tempFolder, content);
+
+    //! [VgfLoaderSample0 begin]
+    std::unique_ptr<RangeReader> reader = CreateFileRangeReader(filename);
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+    std::vector<uint8_t> staging;
+    for (uint32_t idx = 0; idx < loader->getNumConstants(); ++idx) {
+        staging.resize(loader->getConstantSize(idx));
+        loader->readConstant(idx, staging.data(), staging.size());
+        // Upload staging to the resource loader->getConstantMrtIndex(idx)
+    }
+    //! [VgfLoaderSample0 end]
+
+    ASSERT_NE(loader, nullptr);
+    ExpectMatchesModel(*loader, content);
+}
+
+TEST(VgfLoader, Memory) {
+    const std::string content = EncodeModel();
+    std::unique_ptr<RangeReader> reader = CreateMemoryRangeReader(content.data(), content.size());
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader, VerificationMode::LAZY);
+    ASSERT_NE(loader, nullptr);
+    EXPECT_EQ(&loader->getRangeReader(), reader.get());
+    ExpectMatchesModel(*loader, content);
+}
+
+TEST(VgfLoader, ConstantsNotReadOnLoad) {
+    const std::string content = EncodeModel();
+    std::unique_ptr<VgfModel> model = CreateVgfModel(content.data(), content.size());
+    ASSERT_NE(model, nullptr);
+    const ConstantDecoder &constants = model->getConstantDecoder();
+    const auto payloadBegin =
+        static_cast<uint64_t>(constants.getConstant(0).begin() - reinterpret_cast<const uint8_t *>(content.data()));
+
+    bool payloadRead = false;
+    std::unique_ptr<RangeReader> reader =
+        CreateCallbackRangeReader(content.size(), [&](uint64_t offset, void *dst, uint64_t size) {
+            payloadRead = payloadRead || offset + size > payloadBegin;
+            std::memcpy(dst, content.data() + offset, static_cast<size_t>(size));
+            return true;
+        });
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+    ASSERT_NE(loader, nullptr);
+    EXPECT_FALSE(payloadRead);
+
+    std::vector<uint8_t> data(loader->getConstantSize(1));
+    ASSERT_TRUE(loader->readConstant(1, data.data(), data.size()));
+    EXPECT_TRUE(payloadRead);
+}
+
+TEST(VgfLoader, ReadConstantRejected) {
+    const std::string content = EncodeModel();
+    std::unique_ptr<RangeReader> reader = CreateMemoryRangeReader(content.data(), content.size());
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+    ASSERT_NE(loader, nullptr);
+
+    std::vector<uint8_t> data(loader->getConstantSize(0));
+    EXPECT_FALSE(loader->readConstant(0, data.data(), data.size() - 1));
+    const auto numConstants = static_cast<uint32_t>(loader->getNumConstants());
+    EXPECT_FALSE(loader->readConstant(numConstants, data.data(), data.size()));
+    EXPECT_EQ(loader->getConstantSize(numConstants), 0);
+    EXPECT_EQ(loader->getConstantMrtIndex(numConstants), CONSTANT_INVALID_MRT_INDEX);
+    EXPECT_EQ(loader->getConstantSparsityDimension(numConstants), CONSTANT_INVALID_SPARSITY_DIMENSION);
+}
+
+TEST(VgfLoader, InvalidFileRejected) {
+    const std::string content = EncodeModel();
+    std::unique_ptr<RangeReader> truncated = CreateMemoryRangeReader(content.data(), content.size() - 1);
+    EXPECT_EQ(CreateVgfLoader(*truncated), nullptr);
+
+    std::unique_ptr<RangeReader> failing =
+        CreateCallbackRangeReader(content.size(), [](uint64_t, void *, uint64_t) { return false; });
+    EXPECT_EQ(CreateVgfLoader(*failing), nullptr);
+
+    // A constant extending past the end of the section fails the metadata checks
+    std::unique_ptr<VgfModel> model = CreateVgfModel(content.data(), content.size());
+    ASSERT_NE(model, nullptr);
+    std::string corrupt = content;
+    const uint64_t constantsOffset = model->getHeaderDecoder().GetConstantsOffset();
+    const uint64_t hugeSize = UINT64_MAX / 2;
+    // Size of the first metadata record, after the version, the count and the record's MRT index and sparsity
+    std::memcpy(&corrupt[constantsOffset + 16 + 8], &hugeSize, sizeof(hugeSize));
+    std::unique_ptr<RangeReader> corrupted = CreateMemoryRangeReader(corrupt.data(), corrupt.size());
+    EXPECT_EQ(CreateVgfLoader(*corrupted), nullptr);
+}
+
+TEST(VgfLoader, EmptySectionRejected) {
+    const std::string content = EncodeModel();
+    for (const size_t sizeOffset : {HEADER_MODULE_SECTION_SIZE_OFFSET, HEADER_MODEL_SEQUENCE_SECTION_SIZE_OFFSET,
+                                    HEADER_MODEL_RESOURCE_SECTION_SIZE_OFFSET}) {
+        SCOPED_TRACE(sizeOffset);
+        Logger logger;
+        std::string truncated = content;
+        const uint64_t emptySize = 0;
+        std::memcpy(&truncated[sizeOffset], &emptySize, sizeof(emptySize));
+        std::unique_ptr<RangeReader> reader = CreateMemoryRangeReader(truncated.data(), truncated.size());
+        EXPECT_EQ(CreateVgfLoader(*reader), nullptr);
+        EXPECT_TRUE(logger.contains({"Section at offset", "is empty"}));
+    }
+}
+
+namespace {
+
+/// Loads every constant twice in reverse order, checking that each request completes once with the data of the model
+void ExpectLoadedConstants(const VgfLoader &loader, const std::string &content, const LoadConstantsOptions &options) {
+    std::unique_ptr<VgfModel> model = CreateVgfModel(content.data(), content.size());
+    ASSERT_NE(model, nullptr);
+    const ConstantDecoder &constants = model->getConstantDecoder();
+
+    std::vector<ConstantLoadRequest> requests;
+    std::vector<std::vector<uint8_t>> buffers;
+    for (uint32_t round = 0; round < 2; ++round) {
+        for (uint32_t idx = static_cast<uint32_t>(constants.size()); idx-- > 0;) {
+            buffers.emplace_back(constants.getConstant(idx).size());
+            requests.push_back({idx, buffers.back().data(), buffers.back().size()});
+        }
+    }
+    std::vector<uint32_t> completions(requests.size(), 0);
+    const bool loaded = LoadConstants(
+        loader, requests,
+        [&](size_t requestIdx, bool success) {
+            EXPECT_TRUE(success);
+            ++completions[requestIdx];
+        },
+        options);
+    ASSERT_TRUE(loaded);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(completions[i], 1);
+        EXPECT_EQ(DataView<uint8_t>(buffers[i].data(), buffers[i].size()), constants.getConstant(requests[i].idx));
+    }
+}
+
+} // namespace
+
+TEST(LoadConstants, ThreadPool) {
+    TempFolder tempFolder("loader_test");
+    const std::string content = EncodeModel();
+    std::unique_ptr<RangeReader> reader = CreateFileRangeReader(WriteFile(tempFolder, content));
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+    ASSERT_NE(loader, nullptr);
+
+    LoadConstantsOptions options;
+    options.backend = LoadBackend::THREAD_POOL;
+    options.numThreads = 3;
+    ExpectLoadedConstants(*loader, content, options);
+    // Without merging, and with every merged read split
+    options.maxMergedGap = 0;
+    ExpectLoadedConstants(*loader, content, options);
+    options.maxMergedGap = 4096;
+    options.maxMergedReadSize = 1;
+    ExpectLoadedConstants(*loader, content, options);
+}
+
+TEST(LoadConstants, IoUring) {
+    if (!IsIoUringSupported()) {
+        GTEST_SKIP() << "io_uring is not supported";
+    }
+    TempFolder tempFolder("loader_test");
+    const std::string content = EncodeModel();
+    std::unique_ptr<RangeReader> reader = CreateFileRangeReader(WriteFile(tempFolder, content));
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+    ASSERT_NE(loader, nullptr);
+
+    LoadConstantsOptions options;
+    options.backend = LoadBackend::IO_URING;
+    ExpectLoadedConstants(*loader, content, options);
+    // A queue shallower than the number of reads
+    options.queueDepth = 1;
+    options.maxMergedGap = 0;
+    ExpectLoadedConstants(*loader, content, options);
+    // An empty queue still reads one batch at a time
+    options.queueDepth = 0;
+    ExpectLoadedConstants(*loader, content, options);
+}
+
+TEST(LoadConstants, MemoryReader) {
+    const std::string content = EncodeModel();
+    std::unique_ptr<RangeReader> reader = CreateMemoryRangeReader(content.data(), content.size());
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+    ASSERT_NE(loader, nullptr);
+    ExpectLoadedConstants(*loader, content, {});
+
+    // Only readers with a file descriptor can use io_uring
+    LoadConstantsOptions options;
+    options.backend = LoadBackend::IO_URING;
+    std::vector<uint8_t> data(loader->getConstantSize(0));
+    uint32_t completions = 0;
+    EXPECT_FALSE(LoadConstants(
+        *loader, {{0, data.data(), data.size()}}, [&](size_t, bool) { ++completions; }, options));
+    EXPECT_EQ(completions, 0);
+}
+
+TEST(LoadConstants, InvalidRequests) {
+    TempFolder tempFolder("loader_test");
+    const std::string content = EncodeModel();
+    std::unique_ptr<RangeReader> reader = CreateFileRangeReader(WriteFile(tempFolder, content));
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+    ASSERT_NE(loader, nullptr);
+
+    std::vector<uint8_t> data(loader->getConstantSize(1));
+    std::vector<uint8_t> other(loader->getConstantSize(0));
+    const auto numConstants = static_cast<uint32_t>(loader->getNumConstants());
+    //! [LoadConstantsSample0 begin]
+    const std::vector<ConstantLoadRequest> requests = {
+        {1, data.data(), data.size()},
+        {numConstants, data.data(), data.size()},
+        {0, other.data(), other.size() - 1},
+        {0, other.data(), other.size()},
+    };
+    std::vector<int> results(requests.size(), -1);
+    const bool loaded = LoadConstants(*loader, requests, [&](size_t requestIdx, bool success) {
+        // Start the upload of requests[requestIdx].dst while the other constants are still being read
+        results[requestIdx] = success ? 1 : 0;
+    });
+    //! [LoadConstantsSample0 end]
+    EXPECT_FALSE(loaded);
+    EXPECT_EQ(results, (std::vector<int>{1, 0, 0, 1}));
+
+    std::vector<uint8_t> expected(data.size());
+    ASSERT_TRUE(loader->readConstant(1, expected.data(), expected.size()));
+    EXPECT_EQ(data, expected);
+}
+
+namespace {
+
+/// Collects the chunks of a constant, checking that they are contiguous and at most 'chunkSize' bytes
+struct ChunkCollector {
+    explicit ChunkCollector(uint64_t maxChunkSize) : chunkSize(maxChunkSize) {}
+
+    uint64_t chunkSize;
+    std::vector<uint8_t> data;
+    size_t numChunks = 0;
+
+    bool add(uint64_t offset, const uint8_t *chunk, size_t size) {
+        EXPECT_EQ(offset, data.size());
+        EXPECT_GT(size, 0);
+        EXPECT_LE(size, chunkSize);
+        data.insert(data.end(), chunk, chunk + size);
+        ++numChunks;
+        return true;
+    }
+};
+
+bool CollectChunk(void *userData, uint64_t offset, const uint8_t *chunk, size_t size) {
+    return static_cast<ChunkCollector *>(userData)->add(offset, chunk, size);
+}
+
+} // namespace
+
+TEST(ConstantChunks, ConstantDecoder) {
+    const std::string content = EncodeModel();
+    std::unique_ptr<VgfModel> model = CreateVgfModel(content.data(), content.size());
+    ASSERT_NE(model, nullptr);
+    const ConstantDecoder &constants = model->getConstantDecoder();
+
+    // Constant 1 is 2000 bytes, the last chunk is partial
+    ChunkCollector collector(768);
+    ASSERT_TRUE(ForEachConstantChunk(constants, 1, collector.chunkSize, [&](uint64_t offset, DataView<uint8_t> chunk) {
+        // The chunks are views of the constant table
+        EXPECT_EQ(chunk.begin(), constants.getConstant(1).begin() + offset);
+        return collector.add(offset, chunk.begin(), chunk.size());
+    }));
+    EXPECT_EQ(collector.numChunks, 3);
+    EXPECT_EQ(DataView<uint8_t>(collector.data.data(), collector.data.size()), constants.getConstant(1));
+
+    // A chunk larger than the constant
+    ChunkCollector whole(1 << 20);
+    ASSERT_TRUE(ForEachConstantChunk(constants, 0, whole.chunkSize, [&](uint64_t offset, DataView<uint8_t> chunk) {
+        return whole.add(offset, chunk.begin(), chunk.size());
+    }));
+    EXPECT_EQ(whole.numChunks, 1);
+
+    size_t numCalls = 0;
+    const ConstantChunkCallback stop = [&](uint64_t, DataView<uint8_t>) { return ++numCalls < 2; };
+    EXPECT_FALSE(ForEachConstantChunk(constants, 3, 1000, stop));
+    EXPECT_EQ(numCalls, 2);
+    EXPECT_FALSE(ForEachConstantChunk(constants, 0, 0, stop));
+    EXPECT_FALSE(ForEachConstantChunk(constants, static_cast<uint32_t>(constants.size()), 1000, stop));
+    EXPECT_EQ(numCalls, 2);
+}
+
+TEST(ConstantChunks, Loader) {
+    TempFolder tempFolder("loader_test");
+    const std::string content = EncodeModel();
+    std::unique_ptr<VgfModel> model = CreateVgfModel(content.data(), content.size());
+    ASSERT_NE(model, nullptr);
+    const ConstantDecoder &constants = model->getConstantDecoder();
+    std::unique_ptr<RangeReader> fileReader = CreateFileRangeReader(WriteFile(tempFolder, content));
+    std::unique_ptr<RangeReader> memoryReader = CreateMemoryRangeReader(content.data(), content.size());
+
+    for (const RangeReader *reader : {fileReader.get(), memoryReader.get()}) {
+        std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*reader);
+        ASSERT_NE(loader, nullptr);
+        for (uint32_t idx = 0; idx < loader->getNumConstants(); ++idx) {
+            ChunkCollector collector(1000 - 3 * idx);
+            ASSERT_TRUE(
+                loader->forEachConstantChunk(idx, collector.chunkSize, [&](uint64_t offset, DataView<uint8_t> chunk) {
+                    return collector.add(offset, chunk.begin(), chunk.size());
+                }));
+            EXPECT_EQ(DataView<uint8_t>(collector.data.data(), collector.data.size()), constants.getConstant(idx));
+        }
+    }
+
+    std::unique_ptr<VgfLoader> loader = CreateVgfLoader(*fileReader);
+    ASSERT_NE(loader, nullptr);
+    //! [ForEachConstantChunkSample0 begin]
+    // A fixed size staging buffer, whatever the size of the constants
+    std::vector<uint8_t> staging(512);
+    for (uint32_t idx = 0; idx < loader->getNumConstants(); ++idx) {
+        const ConstantChunkCallback upload = [&](uint64_t, DataView<uint8_t>) {
+            // Upload the chunk at its offset in resource loader->getConstantMrtIndex(idx), then reuse the staging
+            return true;
+        };
+        loader->forEachConstantChunk(idx, staging.data(), staging.size(), upload);
+    }
+    //! [ForEachConstantChunkSample0 end]
+
+    size_t numCalls = 0;
+    const ConstantChunkCallback stop = [&](uint64_t, DataView<uint8_t> chunk) {
+        EXPECT_EQ(chunk.begin(), staging.data());
+        return ++numCalls < 2;
+    };
+    EXPECT_FALSE(loader->forEachConstantChunk(3, staging.data(), staging.size(), stop));
+    EXPECT_EQ(numCalls, 2);
+    EXPECT_FALSE(loader->forEachConstantChunk(0, staging.data(), 0, stop));
+    EXPECT_FALSE(loader->forEachConstantChunk(0, 0, stop));
+    EXPECT_FALSE(loader->forEachConstantChunk(static_cast<uint32_t>(loader->getNumConstants()), 512, stop));
+    EXPECT_EQ(numCalls, 2);
+}
+
+TEST(ConstantChunks, CConstantTable) {
+    const std::string content = EncodeModel();
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    const mlsdk_decoder_model *model =
+        mlsdk_decoder_create_model(content.data(), static_cast<uint64_t>(content.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+    const mlsdk_decoder_constant_table_decoder *constantDecoder = mlsdk_decoder_model_get_constant_table_decoder(model);
+
+    mlsdk_decoder_constant_data expected;
+    mlsdk_decoder_constant_table_get_data(constantDecoder, 2, &expected);
+    ChunkCollector collector(1024);
+    ASSERT_TRUE(mlsdk_decoder_constant_table_for_each_chunk(constantDecoder, 2, collector.chunkSize, CollectChunk,
+                                                            &collector));
+    EXPECT_EQ(collector.numChunks, 3);
+    EXPECT_EQ(DataView<uint8_t>(collector.data.data(), collector.data.size()),
+              DataView<uint8_t>(expected.data, expected.size));
+    EXPECT_FALSE(mlsdk_decoder_constant_table_for_each_chunk(constantDecoder, 2, 0, CollectChunk, &collector));
+}
+
+TEST(ConstantChunks, CLoader) {
+    TempFolder tempFolder("loader_test");
+    const std::string content = EncodeModel();
+    const std::string filename = WriteFile(tempFolder, content);
+    std::unique_ptr<VgfModel> model = CreateVgfModel(content.data(), content.size());
+    ASSERT_NE(model, nullptr);
+    const ConstantDecoder &constants = model->getConstantDecoder();
+
+    //! [CForEachConstantChunkSample0 begin]
+    mlsdk_decoder_loader *loader = mlsdk_decoder_create_file_loader(filename.c_str());
+    std::vector<uint8_t> staging(512);
+    ChunkCollector collector(staging.size());
+    ASSERT_TRUE(mlsdk_decoder_loader_for_each_constant_chunk(loader, 3, staging.data(), staging.size(), CollectChunk,
+                                                             &collector));
+    //! [CForEachConstantChunkSample0 end]
+    EXPECT_EQ(DataView<uint8_t>(collector.data.data(), collector.data.size()), constants.getConstant(3));
+
+    ASSERT_EQ(mlsdk_decoder_loader_get_num_constants(loader), constants.size());
+    EXPECT_EQ(mlsdk_decoder_get_module_table_num_entries(mlsdk_decoder_loader_get_module_table_decoder(loader)), 1);
+    EXPECT_EQ(mlsdk_decoder_get_model_sequence_table_size(mlsdk_decoder_loader_get_model_sequence_decoder(loader)), 1);
+    EXPECT_EQ(mlsdk_decoder_get_model_resource_table_num_entries(
+                  mlsdk_decoder_loader_get_model_resource_table_decoder(loader)),
+              model->getModelResourceTableDecoder().size());
+    EXPECT_NE(mlsdk_decoder_loader_get_header_decoder(loader), nullptr);
+    EXPECT_EQ(mlsdk_decoder_loader_get_constant_mrt_index(loader, 1), constants.getConstantMrtIndex(1));
+    std::vector<uint8_t> data(mlsdk_decoder_loader_get_constant_size(loader, 1));
+    ASSERT_TRUE(mlsdk_decoder_loader_read_constant(loader, 1, data.data(), data.size()));
+    EXPECT_EQ(DataView<uint8_t>(data.data(), data.size()), constants.getConstant(1));
+    EXPECT_FALSE(mlsdk_decoder_loader_read_constant(loader, 1, data.data(), data.size() - 1));
+    EXPECT_EQ(mlsdk_decoder_loader_get_constant_size(loader, 4), 0);
+    mlsdk_decoder_destroy_loader(loader);
+
+    EXPECT_EQ(mlsdk_decoder_create_file_loader(tempFolder.relative("missing.vgf").string().c_str()), nullptr);
+}
@@ -41,6 +41,23 @@ TEST(CppLogging, EnableDisable) {
     ASSERT_TRUE(std::equal(entries.begin(), entries.end(), expected.begin(), expected.end()));
 }
 
+TEST(CppLogging, ReentrantCallback) {
+    std::vector<LogEntry> entries;
+    EnableLogging([&entries](LogLevel logLevel, const std::string &message) {
+        entries.emplace_back(logLevel, message);
+        if (logLevel == LogLevel::ERROR) {
+            // Logging again and replacing the callback from within the callback must not deadlock
+            warning("Nested message");
+            DisableLogging();
+        }
+    });
+    error("Error message");
+    info("Another test message");
+
+    std::vector<LogEntry> expected = {{LogLevel::ERROR, "Error message"}, {LogLevel::WARNING, "Nested message"}};
+    ASSERT_TRUE(std::equal(entries.begin(), entries.end(), expected.begin(), expected.end()));
+}
+
 TEST(CppLogging, StringConversion) {
     auto asStr = [](LogLevel logLevel) {
         std::stringstream output;
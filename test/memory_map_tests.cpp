@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "vgf-utils/memory_map.hpp"
+#include "vgf-utils/temp_folder.hpp"
+#include "vgf/decoder.hpp"
+#include "vgf/encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+
+namespace {
+
+constexpr FormatType VK_FORMAT_R32_SFLOAT = 100;
+
+/// Content spanning several pages, with a partial last page
+std::vector<char> WriteTestFile(const std::string &filename) {
+    std::vector<char> content(3 * 4096 + 100);
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>(i * 7);
+    }
+    std::ofstream file(filename, std::ios::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return content;
+}
+
+void ExpectContent(const MemoryMap &mapped, const std::vector<char> &content) {
+    ASSERT_EQ(mapped.size(), content.size());
+    EXPECT_EQ(std::memcmp(mapped.ptr(), content.data(), content.size()), 0);
+}
+
+} // namespace
+
+TEST(MemoryMap, DefaultOptions) {
+    TempFolder tempFolder("memory_map_test");
+    const std::string filename = tempFolder.relative("data.bin").string();
+    const std::vector<char> content = WriteTestFile(filename);
+
+    MemoryMap mapped(filename);
+    ExpectContent(mapped, content);
+}
+
+TEST(MemoryMap, LoadingPolicies) {
+    TempFolder tempFolder("memory_map_test");
+    const std::string filename = tempFolder.relative("data.bin").string();
+    const std::vector<char> content = WriteTestFile(filename);
+
+    //! [MemoryMapSample0 begin]
+    MemoryMapOptions options;
+    options.populate = true;
+    options.shared = true;
+    options.advice = MemoryMapAdvice::WILLNEED;
+    options.lock = true;
+    MemoryMap mapped(filename, options);
+    //! [MemoryMapSample0 end]
+    ExpectContent(mapped, content);
+
+    for (const MemoryMapAdvice advice : {MemoryMapAdvice::SEQUENTIAL, MemoryMapAdvice::RANDOM,
+                                         MemoryMapAdvice::HUGEPAGE, MemoryMapAdvice::NORMAL}) {
+        MemoryMapOptions adviceOptions;
+        adviceOptions.advice = advice;
+        MemoryMap advised(filename, adviceOptions);
+        ExpectContent(advised, content);
+    }
+}
+
+TEST(MemoryMap, Ranges) {
+    TempFolder tempFolder("memory_map_test");
+    const std::string filename = tempFolder.relative("data.bin").string();
+    const std::vector<char> content = WriteTestFile(filename);
+    MemoryMap mapped(filename);
+
+    // Ranges are widened to pages and clamped to the file
+    EXPECT_TRUE(mapped.advise(4097, 10, MemoryMapAdvice::SEQUENTIAL));
+    EXPECT_TRUE(mapped.advise(100, content.size() * 2, MemoryMapAdvice::WILLNEED));
+    EXPECT_FALSE(mapped.advise(content.size(), 1, MemoryMapAdvice::WILLNEED));
+
+    EXPECT_TRUE(mapped.lock(4096, 4096));
+    EXPECT_TRUE(mapped.unlock(4096, 4096));
+    EXPECT_FALSE(mapped.lock(content.size(), 1));
+    ExpectContent(mapped, content);
+}
+
+TEST(MemoryMap, AdviseVgfSections) {
+    TempFolder tempFolder("memory_map_test");
+    const std::string filename = tempFolder.relative("model.vgf").string();
+
+    std::unique_ptr<Encoder> encoder = CreateEncoder(0);
+    encoder->AddModule(ModuleType::GRAPH, "module", "main");
+    ResourceRef resource = encoder->AddConstantResource(VK_FORMAT_R32_SFLOAT, {1024}, {});
+    const std::vector<float> values(1024, 1.0F);
+    encoder->AddConstant(resource, values.data(), values.size() * sizeof(float));
+    encoder->Finish();
+    ASSERT_TRUE(encoder->WriteToFile(filename));
+
+    //! [MemoryMapSample1 begin]
+    MemoryMap mapped(filename);
+    std::unique_ptr<HeaderDecoder> header = CreateHeaderDecoder(
+        mapped.ptr(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(mapped.size()));
+    AdviseVgfSections(mapped, *header, MemoryMapAdvice::WILLNEED, MemoryMapAdvice::SEQUENTIAL);
+    //! [MemoryMapSample1 end]
+
+    ASSERT_NE(header, nullptr);
+    EXPECT_TRUE(AdviseVgfSections(mapped, *header, MemoryMapAdvice::WILLNEED, MemoryMapAdvice::SEQUENTIAL));
+}
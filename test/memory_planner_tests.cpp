@@ -0,0 +1,273 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.hpp"
+#include "vgf/decoder.h"
+#include "vgf/decoder.hpp"
+#include "vgf/encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+using logging::utils::Logger;
+
+namespace {
+
+// VK_FORMAT_R32_SFLOAT, 4 bytes per element
+constexpr FormatType FLOAT32 = 100;
+
+/// A segment reading and writing intermediates given by their position in the resources passed to EncodeModel
+struct TestSegment {
+    std::vector<uint32_t> inputs;
+    std::vector<uint32_t> outputs;
+};
+
+struct TestResource {
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides = {};
+    std::optional<AliasGroupId> aliasGroupId = std::nullopt;
+    ResourceCategory category = ResourceCategory::INTERMEDIATE;
+};
+
+ResourceRef AddResource(Encoder &encoder, const TestResource &resource) {
+    switch (resource.category) {
+    case ResourceCategory::INPUT:
+        return encoder.AddInputResource(DescriptorType{}, FLOAT32, resource.shape, resource.strides,
+                                        resource.aliasGroupId);
+    case ResourceCategory::OUTPUT:
+        return encoder.AddOutputResource(DescriptorType{}, FLOAT32, resource.shape, resource.strides,
+                                         resource.aliasGroupId);
+    default:
+        return encoder.AddIntermediateResource(DescriptorType{}, FLOAT32, resource.shape, resource.strides,
+                                               resource.aliasGroupId);
+    }
+}
+
+std::string EncodeModel(const std::vector<TestResource> &resources, const std::vector<TestSegment> &segments) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(0);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "module", "main");
+    std::vector<BindingSlotRef> slots;
+    for (const TestResource &resource : resources) {
+        slots.push_back(encoder->AddBindingSlot(static_cast<uint32_t>(slots.size()), AddResource(*encoder, resource)));
+    }
+    for (size_t i = 0; i < segments.size(); ++i) {
+        std::vector<BindingSlotRef> inputs;
+        std::vector<BindingSlotRef> outputs;
+        for (const uint32_t resourceIdx : segments[i].inputs) {
+            inputs.push_back(slots[resourceIdx]);
+        }
+        for (const uint32_t resourceIdx : segments[i].outputs) {
+            outputs.push_back(slots[resourceIdx]);
+        }
+        encoder->AddSegmentInfo(module, "segment_" + std::to_string(i), {}, inputs, outputs);
+    }
+    return testutils::EncodeToString(*encoder);
+}
+
+std::optional<MemoryPlan> Plan(const std::string &data, const MemoryPlanOptions &options = {}) {
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    EXPECT_NE(model, nullptr);
+    return PlanIntermediateMemory(model->getModelSequenceTableDecoder(), model->getModelResourceTableDecoder(),
+                                  options);
+}
+
+/// Check that allocations live at the same time only share bytes when they share their storage
+void CheckNoOverlap(const MemoryPlan &plan) {
+    for (const IntermediateAllocation &allocation : plan.allocations) {
+        ASSERT_LE(allocation.offset + allocation.size, plan.peakBytes);
+        for (const IntermediateAllocation &other : plan.allocations) {
+            const bool sameStorage = allocation.offset == other.offset && allocation.size == other.size &&
+                                     allocation.firstSegment == other.firstSegment &&
+                                     allocation.lastSegment == other.lastSegment;
+            const bool liveTogether =
+                allocation.firstSegment <= other.lastSegment && other.firstSegment <= allocation.lastSegment;
+            const bool shareBytes =
+                allocation.offset < other.offset + other.size && other.offset < allocation.offset + allocation.size;
+            ASSERT_TRUE(sameStorage || !liveTogether || !shareBytes)
+                << "MRT entries " << allocation.mrtIndex << " and " << other.mrtIndex << " overlap";
+        }
+    }
+}
+
+} // namespace
+
+TEST(CppMemoryPlanner, ReusesMemoryAlongChain) {
+    // Segment i reads intermediate i and writes intermediate i + 1, so two buffers of 1 KiB are enough
+    const std::vector<TestResource> resources(5, TestResource{{1, 256}});
+    const std::string data = EncodeModel(resources, {{{0}, {1}}, {{1}, {2}}, {{2}, {3}}, {{3}, {4}}});
+
+    //! [MemoryPlanSample0 begin]
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    std::optional<MemoryPlan> plan =
+        PlanIntermediateMemory(model->getModelSequenceTableDecoder(), model->getModelResourceTableDecoder());
+    //! [MemoryPlanSample0 end]
+
+    ASSERT_TRUE(plan.has_value());
+    ASSERT_EQ(plan->allocations.size(), 5);
+    ASSERT_EQ(plan->peakBytes, 2048);
+    ASSERT_EQ(plan->totalBytes, 5 * 1024);
+    for (uint32_t i = 0; i < 5; ++i) {
+        ASSERT_EQ(plan->allocations[i].mrtIndex, i);
+        ASSERT_EQ(plan->allocations[i].size, 1024);
+    }
+    ASSERT_EQ(plan->allocations[0].firstSegment, 0);
+    ASSERT_EQ(plan->allocations[0].lastSegment, 0);
+    ASSERT_EQ(plan->allocations[2].firstSegment, 1);
+    ASSERT_EQ(plan->allocations[2].lastSegment, 2);
+    CheckNoOverlap(*plan);
+}
+
+TEST(CppMemoryPlanner, PlacesLargestFirst) {
+    // The large tensor is live throughout, the two small ones one after the other
+    const std::vector<TestResource> resources{{{16}}, {{1024}}, {{16}}};
+    const std::string data = EncodeModel(resources, {{{0, 1}, {}}, {{1}, {2}}});
+
+    MemoryPlanOptions options;
+    options.alignment = 64;
+    std::optional<MemoryPlan> plan = Plan(data, options);
+    ASSERT_TRUE(plan.has_value());
+    ASSERT_EQ(plan->allocations[1].offset, 0);
+    ASSERT_EQ(plan->allocations[0].offset, 4096);
+    ASSERT_EQ(plan->allocations[2].offset, 4096);
+    ASSERT_EQ(plan->peakBytes, 4096 + 64);
+    CheckNoOverlap(*plan);
+}
+
+TEST(CppMemoryPlanner, AliasGroupsShareStorage) {
+    const std::vector<TestResource> resources{{{8}, {}, 5}, {{64}}, {{32}, {}, 5}, {{64}}};
+    const std::string data = EncodeModel(resources, {{{0}, {1}}, {{1}, {3}}, {{3}, {2}}});
+
+    MemoryPlanOptions options;
+    options.alignment = 4;
+    std::optional<MemoryPlan> plan = Plan(data, options);
+    ASSERT_TRUE(plan.has_value());
+    const IntermediateAllocation &first = plan->allocations[0];
+    const IntermediateAllocation &second = plan->allocations[2];
+    ASSERT_EQ(first.offset, second.offset);
+    ASSERT_EQ(first.size, 128);
+    ASSERT_EQ(second.size, 128);
+    ASSERT_EQ(first.firstSegment, 0);
+    ASSERT_EQ(first.lastSegment, 2);
+    ASSERT_EQ(plan->totalBytes, 128 + 256 + 256);
+    CheckNoOverlap(*plan);
+}
+
+TEST(CppMemoryPlanner, SizesFromStrides) {
+    // The last element of a 2x3 tensor with a 64-byte row pitch starts at byte 72
+    const std::vector<TestResource> resources{{{2, 3}, {64, 4}}, {{0, 3}}};
+    const std::string data = EncodeModel(resources, {{{0}, {1}}});
+
+    MemoryPlanOptions options;
+    options.alignment = 1;
+    std::optional<MemoryPlan> plan = Plan(data, options);
+    ASSERT_TRUE(plan.has_value());
+    ASSERT_EQ(plan->allocations[0].size, 76);
+    ASSERT_EQ(plan->allocations[1].size, 0);
+    ASSERT_EQ(plan->peakBytes, 76);
+}
+
+TEST(CppMemoryPlanner, SkipsUnplannedResources) {
+    std::vector<TestResource> resources{{{4}}, {{4}}, {{4}}, {{4}}};
+    resources[0].category = ResourceCategory::INPUT;
+    resources[3].category = ResourceCategory::OUTPUT;
+    // Intermediate 2 is not referred to by any segment
+    const std::string data = EncodeModel(resources, {{{0}, {1}}, {{1}, {3}}});
+
+    std::optional<MemoryPlan> plan = Plan(data);
+    ASSERT_TRUE(plan.has_value());
+    ASSERT_EQ(plan->allocations.size(), 1);
+    ASSERT_EQ(plan->allocations[0].mrtIndex, 1);
+    ASSERT_EQ(plan->allocations[0].size, 256);
+    ASSERT_EQ(plan->peakBytes, 256);
+}
+
+TEST(CppMemoryPlanner, EmptyModel) {
+    std::optional<MemoryPlan> plan = Plan(EncodeModel({}, {}));
+    ASSERT_TRUE(plan.has_value());
+    ASSERT_TRUE(plan->allocations.empty());
+    ASSERT_EQ(plan->peakBytes, 0);
+}
+
+TEST(CppMemoryPlanner, RejectsUnshapedIntermediate) {
+    Logger logger;
+    const std::string data = EncodeModel({{{-1, 4}}}, {{{}, {0}}});
+
+    ASSERT_EQ(Plan(data), std::nullopt);
+    ASSERT_TRUE(logger.contains({"PlanIntermediateMemory", "intermediate 0"}));
+}
+
+TEST(CppMemoryPlanner, RejectsInvalidAlignment) {
+    Logger logger;
+    MemoryPlanOptions options;
+    options.alignment = 48;
+
+    ASSERT_EQ(Plan(EncodeModel({}, {}), options), std::nullopt);
+    ASSERT_TRUE(logger.contains({"PlanIntermediateMemory", "alignment 48"}));
+}
+
+TEST(CppMemoryPlanner, RandomModelsDoNotOverlap) {
+    std::mt19937 generator(1234);
+    for (int iteration = 0; iteration < 20; ++iteration) {
+        constexpr uint32_t numResources = 40;
+        std::vector<TestResource> resources;
+        for (uint32_t i = 0; i < numResources; ++i) {
+            TestResource resource{{std::uniform_int_distribution<int64_t>(1, 512)(generator)}};
+            if (generator() % 4 == 0) {
+                resource.aliasGroupId = static_cast<AliasGroupId>(generator() % 3);
+            }
+            resources.push_back(resource);
+        }
+        std::vector<TestSegment> segments(30);
+        for (TestSegment &segment : segments) {
+            segment.inputs.push_back(static_cast<uint32_t>(generator() % numResources));
+            segment.outputs.push_back(static_cast<uint32_t>(generator() % numResources));
+        }
+
+        std::optional<MemoryPlan> plan = Plan(EncodeModel(resources, segments));
+        ASSERT_TRUE(plan.has_value());
+        ASSERT_LE(plan->peakBytes, plan->totalBytes);
+        CheckNoOverlap(*plan);
+    }
+}
+
+TEST(CMemoryPlanner, PlansIntermediates) {
+    const std::vector<TestResource> resources(5, TestResource{{1, 256}});
+    const std::string data = EncodeModel(resources, {{{0}, {1}}, {{1}, {2}}, {{2}, {3}}, {{3}, {4}}});
+
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    const mlsdk_decoder_model *model =
+        mlsdk_decoder_create_model(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+
+    //! [CMemoryPlanSample0 begin]
+    const mlsdk_decoder_model_sequence_decoder *sequenceDecoder = mlsdk_decoder_model_get_model_sequence_decoder(model);
+    const mlsdk_decoder_model_resource_table_decoder *resourceDecoder =
+        mlsdk_decoder_model_get_model_resource_table_decoder(model);
+    std::vector<mlsdk_decoder_intermediate_allocation> allocations(
+        mlsdk_decoder_get_model_resource_table_num_entries(resourceDecoder));
+    size_t numAllocations = 0;
+    uint64_t peakBytes = 0;
+    bool planned = mlsdk_decoder_plan_intermediate_memory(sequenceDecoder, resourceDecoder, 256, allocations.data(),
+                                                          allocations.size(), &numAllocations, &peakBytes);
+    //! [CMemoryPlanSample0 end]
+    ASSERT_TRUE(planned);
+    ASSERT_EQ(numAllocations, 5);
+    ASSERT_EQ(peakBytes, 2048);
+    ASSERT_EQ(allocations[2].mrt_index, 2);
+    ASSERT_EQ(allocations[2].size, 1024);
+    ASSERT_EQ(allocations[2].first_segment, 1);
+    ASSERT_EQ(allocations[2].last_segment, 2);
+    ASSERT_NE(allocations[1].offset, allocations[2].offset);
+
+    ASSERT_TRUE(mlsdk_decoder_plan_intermediate_memory(sequenceDecoder, resourceDecoder, 256, nullptr, 0,
+                                                       &numAllocations, &peakBytes));
+    ASSERT_EQ(numAllocations, 5);
+    ASSERT_FALSE(mlsdk_decoder_plan_intermediate_memory(sequenceDecoder, resourceDecoder, 3, allocations.data(),
+                                                        allocations.size(), &numAllocations, &peakBytes));
+}
@@ -18,6 +18,7 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace mlsdk::vgflib;
@@ -30,6 +31,8 @@ constexpr DescriptorType VK_DESCRIPTOR_TYPE_STORAGE_IMAGE = 3;
 constexpr DescriptorType VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER = 1;
 constexpr FormatType VK_FORMAT_R4G4_UNORM_PACK8 = 1;
 constexpr FormatType VK_FORMAT_R4G4B4A4_UNORM_PACK16 = 12;
+constexpr FormatType VK_FORMAT_UNDEFINED = 0;
+constexpr FormatType VK_FORMAT_R32_SFLOAT = 100;
 
 constexpr bool DataViewTests() {
     static_assert(DataView<uint8_t>().empty(), "Default constructor should create an empty view");
@@ -48,6 +51,63 @@ constexpr bool DataViewTests() {
     return (dv[0] == i) && (dv.data() == &i);
 }
 
+struct LayoutResource {
+    FormatType format;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+};
+
+/// Resources covering the layout edge cases, with the layout expected for each one
+const std::vector<std::pair<LayoutResource, std::optional<TensorLayout>>> &LayoutCases() {
+    static const std::vector<std::pair<LayoutResource, std::optional<TensorLayout>>> cases = {
+        {{VK_FORMAT_R32_SFLOAT, {2, 3, 4}, {}}, TensorLayout{24, 4, 96, 96, true}},
+        {{VK_FORMAT_R32_SFLOAT, {2, 3, 4}, {48, 16, 4}}, TensorLayout{24, 4, 96, 96, true}},
+        {{VK_FORMAT_R32_SFLOAT, {2, 3, 4}, {64, 16, 4}}, TensorLayout{24, 4, 96, 112, false}},
+        {{VK_FORMAT_R32_SFLOAT, {2, 1, 4}, {16, 1000, 4}}, TensorLayout{8, 4, 32, 32, true}},
+        {{VK_FORMAT_R32_SFLOAT, {2, 0, 4}, {16, 16, 4}}, TensorLayout{0, 4, 0, 0, true}},
+        {{VK_FORMAT_R32_SFLOAT, {-1, 4}, {}}, std::nullopt},
+        {{VK_FORMAT_UNDEFINED, {4}, {}}, std::nullopt},
+        {{VK_FORMAT_R32_SFLOAT, {2, 3}, {4}}, std::nullopt},
+        {{VK_FORMAT_R32_SFLOAT, {2, 2}, {-8, 4}}, std::nullopt},
+        {{VK_FORMAT_R32_SFLOAT, {int64_t{1} << 62, 2}, {}}, std::nullopt},
+    };
+    return cases;
+}
+
+std::string EncodeLayoutCases() {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    for (const auto &[resource, layout] : LayoutCases()) {
+        encoder->AddIntermediateResource(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, resource.format, resource.shape,
+                                         resource.strides);
+    }
+    encoder->Finish();
+
+    std::stringstream buffer;
+    EXPECT_TRUE(encoder->WriteTo(buffer));
+    return buffer.str();
+}
+
+void ExpectLayoutCases(const ModelResourceTableDecoder &decoder) {
+    ASSERT_EQ(decoder.size(), LayoutCases().size());
+    for (uint32_t id = 0; id < decoder.size(); ++id) {
+        const std::optional<TensorLayout> &expected = LayoutCases()[id].second;
+        const std::optional<TensorLayout> layout = decoder.getTensorLayout(id);
+        ASSERT_EQ(layout.has_value(), expected.has_value()) << "entry " << id;
+        if (expected.has_value()) {
+            EXPECT_EQ(layout->elementCount, expected->elementCount) << "entry " << id;
+            EXPECT_EQ(layout->elementSize, expected->elementSize) << "entry " << id;
+            EXPECT_EQ(layout->packedByteSize, expected->packedByteSize) << "entry " << id;
+            EXPECT_EQ(layout->spanByteSize, expected->spanByteSize) << "entry " << id;
+            EXPECT_EQ(layout->contiguous, expected->contiguous) << "entry " << id;
+        }
+    }
+
+    Logger logger;
+    EXPECT_FALSE(decoder.getTensorLayout(static_cast<uint32_t>(decoder.size())).has_value());
+    EXPECT_FALSE(decoder.getTensorLayout(UINT32_MAX).has_value());
+    EXPECT_TRUE(logger.contains({"index", "out of range"}));
+}
+
 } // namespace
 
 TEST(DataView, Basic) {
@@ -330,6 +390,42 @@ TEST(CppModelResourceTable, AliasGroupRoundTripAndLateAssignment) {
     EXPECT_EQ(defaultHandle, nullptr);
 }
 
+TEST(CppModelResourceTable, TensorLayout) {
+    const std::string vgfData = EncodeLayoutCases();
+    std::unique_ptr<HeaderDecoder> headerDecoder = CreateHeaderDecoder(
+        vgfData.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(vgfData.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    const char *mrtData = vgfData.c_str() + headerDecoder->GetModelResourceTableOffset();
+    const uint64_t mrtSize = headerDecoder->GetModelResourceTableSize();
+
+    std::unique_ptr<ModelResourceTableDecoder> mrtDecoder = CreateModelResourceTableDecoder(mrtData, mrtSize);
+    ASSERT_NE(mrtDecoder, nullptr);
+
+    //! [TensorLayoutSample0 begin]
+    if (std::optional<TensorLayout> layout = mrtDecoder->getTensorLayout(2)) {
+        // Allocate layout->spanByteSize bytes, the tensor can be copied as a single block when layout->contiguous
+    }
+    //! [TensorLayoutSample0 end]
+
+    ExpectLayoutCases(*mrtDecoder);
+
+    std::unique_ptr<ModelResourceTableDecoder> lazyDecoder =
+        CreateModelResourceTableDecoder(mrtData, mrtSize, VerificationMode::LAZY);
+    ASSERT_NE(lazyDecoder, nullptr);
+    ExpectLayoutCases(*lazyDecoder);
+
+    std::vector<uint8_t> decoderMemory(ModelResourceTableDecoderSize());
+    ModelResourceTableDecoder *inPlaceDecoder =
+        CreateModelResourceTableDecoderInPlace(mrtData, mrtSize, decoderMemory.data());
+    ASSERT_NE(inPlaceDecoder, nullptr);
+    ExpectLayoutCases(*inPlaceDecoder);
+    inPlaceDecoder->~ModelResourceTableDecoder();
+
+    std::unique_ptr<VgfModel> model = CreateVgfModel(vgfData.data(), vgfData.size());
+    ASSERT_NE(model, nullptr);
+    ExpectLayoutCases(model->getModelResourceTableDecoder());
+}
+
 TEST(CppVerify, ModelResourceSizeWrapRejected) {
     Logger logger;
     const uint64_t resourceOffset = 46;
@@ -724,6 +820,98 @@ TEST(CModelResourceTable, AliasGroupRoundTripAndLateAssignment) {
     ASSERT_EQ(defaultHandle, nullptr);
 }
 
+TEST(CModelResourceTable, EntryInfos) {
+    std::vector<int64_t> shape1{0, 1, 2, 3};
+    std::vector<int64_t> shape2{8, 9};
+    constexpr mlsdk_encoder_alias_group_id SHARED_ALIAS_GROUP = 3;
+
+    mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
+    auto resource0 = mlsdk_encoder_add_input_resource_with_alias_group(
+        encoder, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_FORMAT_R4G4_UNORM_PACK8, shape1.data(), shape1.size(), nullptr,
+        0, SHARED_ALIAS_GROUP);
+    auto resource1 = mlsdk_encoder_add_constant_resource(encoder, VK_FORMAT_R4G4B4A4_UNORM_PACK16, shape2.data(),
+                                                         shape2.size(), nullptr, 0);
+
+    std::string data = testutils::FinishAndWriteCEncoder(encoder);
+
+    std::vector<uint8_t> headerDecoderMemory;
+    headerDecoderMemory.resize(mlsdk_decoder_header_decoder_mem_reqs());
+    mlsdk_decoder_header_decoder *headerDecoder =
+        mlsdk_decoder_create_header_decoder(data.c_str(), static_cast<uint64_t>(mlsdk_decoder_header_size()),
+                                            static_cast<uint64_t>(data.size()), headerDecoderMemory.data());
+    ASSERT_TRUE(mlsdk_decoder_is_header_valid(headerDecoder));
+
+    mlsdk_decoder_vgf_section_info section;
+    mlsdk_decoder_get_header_section_info(headerDecoder, mlsdk_decoder_section_resources, &section);
+
+    std::vector<uint8_t> resourceTableDecoderMemory;
+    resourceTableDecoderMemory.resize(mlsdk_decoder_model_resource_table_decoder_mem_reqs());
+    mlsdk_decoder_model_resource_table_decoder *resourceTableDecoder =
+        mlsdk_decoder_create_model_resource_table_decoder(data.c_str() + section.offset, section.size,
+                                                          resourceTableDecoderMemory.data());
+    ASSERT_NE(resourceTableDecoder, nullptr);
+
+    //! [MrtEntryInfosSample0 begin]
+    std::vector<mlsdk_decoder_mrt_entry_info> infos(
+        mlsdk_decoder_get_model_resource_table_num_entries(resourceTableDecoder));
+    size_t numInfos =
+        mlsdk_decoder_model_resource_table_get_entry_infos(resourceTableDecoder, infos.data(), infos.size());
+    //! [MrtEntryInfosSample0 end]
+    ASSERT_EQ(numInfos, 2);
+
+    const mlsdk_decoder_mrt_entry_info &info0 = infos[resource0.reference];
+    ASSERT_EQ(info0.vk_format, VK_FORMAT_R4G4_UNORM_PACK8);
+    ASSERT_EQ(info0.category, mlsdk_decoder_mrt_category_input);
+    ASSERT_TRUE(info0.has_descriptor_type);
+    ASSERT_EQ(info0.descriptor_type, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
+    ASSERT_TRUE(info0.has_alias_group_id);
+    ASSERT_EQ(info0.alias_group_id, SHARED_ALIAS_GROUP);
+    ASSERT_EQ(info0.rank, shape1.size());
+
+    const mlsdk_decoder_mrt_entry_info &info1 = infos[resource1.reference];
+    ASSERT_EQ(info1.vk_format, VK_FORMAT_R4G4B4A4_UNORM_PACK16);
+    ASSERT_EQ(info1.category, mlsdk_decoder_mrt_category_constant);
+    ASSERT_FALSE(info1.has_descriptor_type);
+    ASSERT_FALSE(info1.has_alias_group_id);
+    ASSERT_EQ(info1.rank, shape2.size());
+
+    mlsdk_decoder_mrt_entry_info partial;
+    ASSERT_EQ(mlsdk_decoder_model_resource_table_get_entry_infos(resourceTableDecoder, &partial, 1), 1);
+    ASSERT_EQ(partial.vk_format, info0.vk_format);
+    ASSERT_EQ(mlsdk_decoder_model_resource_table_get_entry_infos(resourceTableDecoder, nullptr, 0), 0);
+}
+
+TEST(CModelResourceTable, TensorLayout) {
+    const std::string data = EncodeLayoutCases();
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    const mlsdk_decoder_model *model =
+        mlsdk_decoder_create_model(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+    const mlsdk_decoder_model_resource_table_decoder *resourceTableDecoder =
+        mlsdk_decoder_model_get_model_resource_table_decoder(model);
+
+    //! [CTensorLayoutSample0 begin]
+    mlsdk_decoder_tensor_layout layout;
+    if (mlsdk_decoder_model_resource_table_get_tensor_layout(resourceTableDecoder, 2, &layout)) {
+        // Allocate layout.span_byte_size bytes, the tensor can be copied as a single block when layout.contiguous
+    }
+    //! [CTensorLayoutSample0 end]
+
+    ASSERT_TRUE(mlsdk_decoder_model_resource_table_get_tensor_layout(resourceTableDecoder, 2, &layout));
+    EXPECT_EQ(layout.element_count, 24);
+    EXPECT_EQ(layout.element_size, 4);
+    EXPECT_EQ(layout.packed_byte_size, 96);
+    EXPECT_EQ(layout.span_byte_size, 112);
+    EXPECT_FALSE(layout.contiguous);
+
+    ASSERT_TRUE(mlsdk_decoder_model_resource_table_get_tensor_layout(resourceTableDecoder, 3, &layout));
+    EXPECT_EQ(layout.span_byte_size, 32);
+    EXPECT_TRUE(layout.contiguous);
+
+    EXPECT_FALSE(mlsdk_decoder_model_resource_table_get_tensor_layout(resourceTableDecoder, 5, &layout));
+    EXPECT_FALSE(mlsdk_decoder_model_resource_table_get_tensor_layout(resourceTableDecoder, 9, &layout));
+}
+
 TEST(CVerify, ModelResourceSizeWrapRejected) {
     Logger logger;
     const uint64_t resourceOffset = 46;
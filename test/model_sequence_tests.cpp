@@ -399,6 +399,49 @@ TEST(CppModelSequenceTable, PushConstantRange) {
     ASSERT_TRUE(seqTableDecoder->getPushConstRangeSize(handle, pushConstRange.reference) == 3);
 }
 
+namespace {
+
+std::string EncodeSegmentChain(uint32_t numSegments, bool parallelFinish) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    encoder->SetParallelFinish(parallelFinish);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "chain_module", "main");
+
+    std::vector<BindingSlotRef> bindings;
+    for (uint32_t i = 0; i <= numSegments; ++i) {
+        ResourceRef resource = encoder->AddIntermediateResource(DescriptorType{}, FormatType{}, {1, 8, 8, 4}, {});
+        bindings.push_back(encoder->AddBindingSlot(i, resource));
+    }
+    for (uint32_t i = 0; i < numSegments; ++i) {
+        std::vector<BindingSlotRef> inputs{bindings[i]};
+        std::vector<BindingSlotRef> outputs{bindings[i + 1]};
+        DescriptorSetInfoRef descriptor = encoder->AddDescriptorSetInfo({bindings[i], bindings[i + 1]});
+        encoder->AddSegmentInfo(module, "segment_" + std::to_string(i), {descriptor}, inputs, outputs);
+    }
+    encoder->AddModelSequenceInputsOutputs({bindings.front()}, {"input"}, {bindings.back()}, {"output"});
+    encoder->Finish();
+
+    std::stringstream buffer;
+    EXPECT_TRUE(encoder->WriteTo(buffer));
+    return buffer.str();
+}
+
+} // namespace
+
+TEST(CppModelSequenceTable, ParallelFinishMatchesSerial) {
+    const std::string serial = EncodeSegmentChain(500, false);
+    const std::string parallel = EncodeSegmentChain(500, true);
+    ASSERT_EQ(serial, parallel);
+
+    std::unique_ptr<HeaderDecoder> headerDecoder = CreateHeaderDecoder(
+        parallel.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(parallel.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    std::unique_ptr<ModelSequenceTableDecoder> seqTableDecoder = CreateModelSequenceTableDecoder(
+        parallel.c_str() + headerDecoder->GetModelSequenceTableOffset(), headerDecoder->GetModelSequenceTableSize());
+    ASSERT_NE(seqTableDecoder, nullptr);
+    ASSERT_EQ(seqTableDecoder->modelSequenceTableSize(), 500);
+    ASSERT_EQ(seqTableDecoder->getSegmentName(499), "segment_499");
+}
+
 TEST(CppVerify, ModelSequenceSizeWrapRejected) {
     Logger logger;
     const uint64_t sequenceOffset = 32;
@@ -973,6 +1016,99 @@ TEST(CModelSequenceTable, PushConstantRange) {
     ASSERT_TRUE(rangeSize == 3);
 }
 
+TEST(CModelSequenceTable, BatchGetters) {
+    mlsdk_encoder *encoder = mlsdk_encoder_create(pretendVulkanHeaderVersion);
+    mlsdk_encoder_module_ref module0 = mlsdk_encoder_add_spirv_module(encoder, mlsdk_encoder_module_type_compute,
+                                                                      "module_0", "entry_point", nullptr, 0);
+    mlsdk_encoder_module_ref module1 = mlsdk_encoder_add_spirv_module(encoder, mlsdk_encoder_module_type_graph,
+                                                                      "module_1", "entry_point", nullptr, 0);
+
+    std::vector<mlsdk_encoder_binding_slot_ref> descBindings = {mlsdk_encoder_add_binding_slot(encoder, 0, {7}),
+                                                                mlsdk_encoder_add_binding_slot(encoder, 1, {8}),
+                                                                mlsdk_encoder_add_binding_slot(encoder, 2, {9})};
+    mlsdk_encoder_descriptor_set_info_ref descInfo =
+        mlsdk_encoder_add_descriptor_set_info(encoder, descBindings.data(), descBindings.size(), 0);
+    std::vector<mlsdk_encoder_binding_slot_ref> inputBindings = {descBindings[0]};
+    std::vector<mlsdk_encoder_binding_slot_ref> outputBindings = {descBindings[1], descBindings[2]};
+    std::vector<mlsdk_encoder_constant_ref> constants = {{0}, {1}};
+    std::array<uint32_t, 3> dispatchShape = {4, 5, 6};
+    mlsdk_encoder_push_const_range_ref pushConstRange = mlsdk_encoder_add_push_const_range(encoder, 1, 0, 16);
+
+    mlsdk_encoder_add_segment_info(encoder, module0, "segment_0", &descInfo, 1, inputBindings.data(),
+                                   inputBindings.size(), outputBindings.data(), outputBindings.size(),
+                                   constants.data(), constants.size(), dispatchShape.data(), &pushConstRange, 1);
+    mlsdk_encoder_add_segment_info(encoder, module1, "segment_1", nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0,
+                                   nullptr, nullptr, 0);
+
+    std::string data = testutils::FinishAndWriteCEncoder(encoder);
+    ASSERT_TRUE(data.size() >= mlsdk_decoder_header_size());
+
+    std::vector<uint8_t> headerDecoderMemory;
+    headerDecoderMemory.resize(mlsdk_decoder_header_decoder_mem_reqs());
+    mlsdk_decoder_header_decoder *headerDecoder =
+        mlsdk_decoder_create_header_decoder(data.c_str(), static_cast<uint64_t>(mlsdk_decoder_header_size()),
+                                            static_cast<uint64_t>(data.size()), headerDecoderMemory.data());
+    ASSERT_TRUE(mlsdk_decoder_is_header_valid(headerDecoder));
+
+    mlsdk_decoder_vgf_section_info modelSequenceSection;
+    mlsdk_decoder_get_header_section_info(headerDecoder, mlsdk_decoder_section_model_sequence, &modelSequenceSection);
+
+    std::vector<uint8_t> modelSequenceDecoderMemory;
+    modelSequenceDecoderMemory.resize(mlsdk_decoder_model_sequence_decoder_mem_reqs());
+    mlsdk_decoder_model_sequence_decoder *modelSequenceDecoder = mlsdk_decoder_create_model_sequence_decoder(
+        data.c_str() + modelSequenceSection.offset, modelSequenceSection.size, modelSequenceDecoderMemory.data());
+    ASSERT_NE(modelSequenceDecoder, nullptr);
+
+    //! [SegmentSummariesSample0 begin]
+    std::vector<mlsdk_decoder_segment_summary> summaries(
+        mlsdk_decoder_get_model_sequence_table_size(modelSequenceDecoder));
+    size_t numSegments =
+        mlsdk_decoder_model_sequence_get_segment_summaries(modelSequenceDecoder, summaries.data(), summaries.size());
+    //! [SegmentSummariesSample0 end]
+    ASSERT_EQ(numSegments, 2);
+
+    ASSERT_EQ(summaries[0].type, mlsdk_decoder_module_type_compute);
+    ASSERT_EQ(summaries[0].module_index, module0.reference);
+    ASSERT_EQ(summaries[0].num_descriptor_set_infos, 1);
+    ASSERT_EQ(summaries[0].num_inputs, 1);
+    ASSERT_EQ(summaries[0].num_outputs, 2);
+    ASSERT_EQ(summaries[0].num_constants, 2);
+    ASSERT_EQ(summaries[0].num_push_constant_ranges, 1);
+    ASSERT_EQ(summaries[0].dispatch_shape.data[0], 4);
+    ASSERT_EQ(summaries[0].dispatch_shape.data[1], 5);
+    ASSERT_EQ(summaries[0].dispatch_shape.data[2], 6);
+
+    ASSERT_EQ(summaries[1].type, mlsdk_decoder_module_type_graph);
+    ASSERT_EQ(summaries[1].module_index, module1.reference);
+    ASSERT_EQ(summaries[1].num_descriptor_set_infos, 0);
+    ASSERT_EQ(summaries[1].num_inputs, 0);
+    ASSERT_EQ(summaries[1].num_outputs, 0);
+    ASSERT_EQ(summaries[1].num_constants, 0);
+    ASSERT_EQ(summaries[1].num_push_constant_ranges, 0);
+    ASSERT_EQ(summaries[1].dispatch_shape.data[0], 0);
+
+    mlsdk_decoder_segment_summary partial;
+    ASSERT_EQ(mlsdk_decoder_model_sequence_get_segment_summaries(modelSequenceDecoder, &partial, 1), 1);
+    ASSERT_EQ(partial.module_index, module0.reference);
+
+    //! [BindingSlotInfosSample0 begin]
+    mlsdk_decoder_binding_slots_handle handle =
+        mlsdk_decoder_model_sequence_get_segment_descriptor_binding_slot(modelSequenceDecoder, 0, 0);
+    std::vector<mlsdk_decoder_binding_slot_info> slots(mlsdk_decoder_binding_slot_size(modelSequenceDecoder, handle));
+    size_t numSlots = mlsdk_decoder_binding_slot_get_infos(modelSequenceDecoder, handle, slots.data(), slots.size());
+    //! [BindingSlotInfosSample0 end]
+    ASSERT_EQ(numSlots, 3);
+    for (uint32_t i = 0; i < numSlots; ++i) {
+        ASSERT_EQ(slots[i].binding, mlsdk_decoder_binding_slot_binding_id(modelSequenceDecoder, handle, i));
+        ASSERT_EQ(slots[i].mrt_index, mlsdk_decoder_binding_slot_mrt_index(modelSequenceDecoder, handle, i));
+    }
+    ASSERT_EQ(slots[2].binding, 2);
+    ASSERT_EQ(slots[2].mrt_index, 9);
+
+    ASSERT_EQ(mlsdk_decoder_binding_slot_get_infos(modelSequenceDecoder, handle, slots.data(), 2), 2);
+    ASSERT_EQ(mlsdk_decoder_binding_slot_get_infos(modelSequenceDecoder, handle, nullptr, 0), 0);
+}
+
 TEST(CVerify, ModelSequenceSizeWrapRejected) {
     Logger logger;
     const uint64_t sequenceOffset = 32;
@@ -0,0 +1,498 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.hpp"
+#include "vgf/decoder.h"
+#include "vgf/decoder.hpp"
+#include "vgf/encoder.hpp"
+#include "vgf/types.hpp"
+
+#include "header.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+using testutils::ToVector;
+using logging::utils::Logger;
+
+const uint16_t pretendVulkanHeaderVersion = 123;
+
+namespace {
+
+std::string EncodeModel() {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    ModuleRef module = encoder->AddModule(ModuleType::COMPUTE, "test_module", "main", {0x07230203, 1, 2, 3});
+
+    ResourceRef input = encoder->AddInputResource(DescriptorType{}, FormatType{}, {1, 4}, {});
+    ResourceRef output = encoder->AddOutputResource(DescriptorType{}, FormatType{}, {1, 4}, {});
+    ResourceRef weights = encoder->AddConstantResource(FormatType{}, {4}, {});
+
+    const std::vector<uint8_t> weightsData{1, 2, 3, 4};
+    ConstantRef constant = encoder->AddConstant(weights, weightsData.data(), weightsData.size());
+
+    BindingSlotRef inputSlot = encoder->AddBindingSlot(0, input);
+    BindingSlotRef outputSlot = encoder->AddBindingSlot(1, output);
+    DescriptorSetInfoRef descriptor = encoder->AddDescriptorSetInfo({inputSlot, outputSlot});
+    encoder->AddSegmentInfo(module, "test_segment", {descriptor}, {inputSlot}, {outputSlot}, {constant});
+    encoder->AddModelSequenceInputsOutputs({inputSlot}, {"input"}, {outputSlot}, {"output"});
+    return testutils::EncodeToString(*encoder);
+}
+
+void CheckModel(const VgfModel &model) {
+    ASSERT_TRUE(model.getHeaderDecoder().IsValid());
+    ASSERT_EQ(model.getHeaderDecoder().GetEncoderVulkanHeadersVersion(), pretendVulkanHeaderVersion);
+
+    ASSERT_EQ(model.getModuleTableDecoder().size(), 1);
+    ASSERT_EQ(model.getModuleTableDecoder().getModuleName(0), "test_module");
+    ASSERT_EQ(model.getModuleTableDecoder().getSPIRVModuleCode(0).size(), 4);
+
+    ASSERT_EQ(model.getModelSequenceTableDecoder().modelSequenceTableSize(), 1);
+    ASSERT_EQ(model.getModelSequenceTableDecoder().getSegmentName(0), "test_segment");
+
+    ASSERT_EQ(model.getModelResourceTableDecoder().size(), 3);
+    ASSERT_EQ(model.getModelResourceTableDecoder().getCategory(2), ResourceCategory::CONSTANT);
+
+    ASSERT_EQ(model.getConstantDecoder().size(), 1);
+    ASSERT_EQ(model.getConstantDecoder().getConstantMrtIndex(0), 2);
+    const std::vector<uint8_t> weightsData{1, 2, 3, 4};
+    ASSERT_EQ(model.getConstantDecoder().getConstant(0), DataView<uint8_t>(weightsData.data(), weightsData.size()));
+}
+
+/// Encode a model with numSegments segments, each with its own module and graph input and output
+std::string EncodeNamedModel(uint32_t numSegments) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    std::vector<BindingSlotRef> inputs;
+    std::vector<BindingSlotRef> outputs;
+    std::vector<std::string> inputNames;
+    std::vector<std::string> outputNames;
+    for (uint32_t i = 0; i < numSegments; ++i) {
+        const std::string suffix = std::to_string(i);
+        ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "module_" + suffix, "main");
+        BindingSlotRef input =
+            encoder->AddBindingSlot(0, encoder->AddInputResource(DescriptorType{}, FormatType{}, {1, 4}, {}));
+        BindingSlotRef output =
+            encoder->AddBindingSlot(1, encoder->AddOutputResource(DescriptorType{}, FormatType{}, {1, 4}, {}));
+        DescriptorSetInfoRef descriptor = encoder->AddDescriptorSetInfo({input, output});
+        encoder->AddSegmentInfo(module, "segment_" + suffix, {descriptor}, {input}, {output});
+        inputs.push_back(input);
+        outputs.push_back(output);
+        inputNames.push_back("input_" + suffix);
+        outputNames.push_back("output_" + suffix);
+    }
+    // A duplicated name resolves to its first occurrence
+    inputs.push_back(inputs.front());
+    inputNames.push_back(inputNames.front());
+    encoder->AddModelSequenceInputsOutputs(inputs, inputNames, outputs, outputNames);
+    return testutils::EncodeToString(*encoder);
+}
+
+void CheckNameIndex(const NameIndex &index, uint32_t numSegments) {
+    for (uint32_t i = 0; i < numSegments; ++i) {
+        const std::string suffix = std::to_string(i);
+        ASSERT_EQ(index.findInputByName("input_" + suffix), i);
+        ASSERT_EQ(index.findOutputByName("output_" + suffix), i);
+        ASSERT_EQ(index.findModuleByName("module_" + suffix), i);
+        ASSERT_EQ(index.findSegmentByName("segment_" + suffix), i);
+    }
+    ASSERT_EQ(index.findInputByName("input_0"), 0);
+    ASSERT_EQ(index.findInputByName("output_0"), std::nullopt);
+    ASSERT_EQ(index.findOutputByName("input_0"), std::nullopt);
+    ASSERT_EQ(index.findModuleByName("segment_0"), std::nullopt);
+    ASSERT_EQ(index.findSegmentByName(""), std::nullopt);
+    ASSERT_EQ(index.findSegmentByName("segment_" + std::to_string(numSegments)), std::nullopt);
+}
+
+/// Encode three segments passing aliased intermediates along, the first segment writing its output through two slots
+std::string EncodeResourceModel() {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "module", "main");
+
+    ResourceRef input = encoder->AddInputResource(DescriptorType{}, FormatType{}, {1, 4}, {}, 7);
+    ResourceRef first = encoder->AddIntermediateResource(DescriptorType{}, FormatType{}, {1, 4}, {}, 3);
+    ResourceRef second = encoder->AddIntermediateResource(DescriptorType{}, FormatType{}, {1, 4}, {}, 7);
+    ResourceRef output = encoder->AddOutputResource(DescriptorType{}, FormatType{}, {1, 4}, {});
+    ResourceRef weights = encoder->AddConstantResource(FormatType{}, {4}, {});
+    ResourceRef bias = encoder->AddConstantResource(FormatType{}, {4}, {});
+
+    const std::vector<uint8_t> constantData{1, 2, 3, 4};
+    ConstantRef weights0 = encoder->AddConstant(weights, constantData.data(), constantData.size());
+    ConstantRef bias0 = encoder->AddConstant(bias, constantData.data(), constantData.size());
+    ConstantRef weights1 = encoder->AddConstant(weights, constantData.data(), constantData.size());
+
+    BindingSlotRef inputSlot = encoder->AddBindingSlot(0, input);
+    BindingSlotRef firstSlot = encoder->AddBindingSlot(1, first);
+    BindingSlotRef firstAgainSlot = encoder->AddBindingSlot(2, first);
+    BindingSlotRef secondSlot = encoder->AddBindingSlot(1, second);
+    BindingSlotRef outputSlot = encoder->AddBindingSlot(2, output);
+
+    encoder->AddSegmentInfo(module, "segment_0", {encoder->AddDescriptorSetInfo({inputSlot, firstSlot})}, {inputSlot},
+                            {firstSlot, firstAgainSlot}, {weights0});
+    encoder->AddSegmentInfo(module, "segment_1", {encoder->AddDescriptorSetInfo({firstSlot, secondSlot})}, {firstSlot},
+                            {secondSlot}, {bias0, weights1});
+    encoder->AddSegmentInfo(module, "segment_2", {encoder->AddDescriptorSetInfo({firstSlot, secondSlot, outputSlot})},
+                            {firstSlot, secondSlot}, {outputSlot});
+    encoder->AddModelSequenceInputsOutputs({inputSlot}, {"input"}, {outputSlot}, {"output"});
+    return testutils::EncodeToString(*encoder);
+}
+
+using Indexes = std::vector<uint32_t>;
+
+} // namespace
+
+TEST(CppModel, DecodesAllSections) {
+    const std::string data = EncodeModel();
+
+    //! [ModelDecodingSample0 begin]
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(model, nullptr);
+    const ModelSequenceTableDecoder &sequenceDecoder = model->getModelSequenceTableDecoder();
+    //! [ModelDecodingSample0 end]
+    ASSERT_EQ(sequenceDecoder.modelSequenceTableSize(), 1);
+    CheckModel(*model);
+}
+
+TEST(CppModel, DecodesAllSectionsInPlace) {
+    const std::string data = EncodeModel();
+
+    std::vector<uint8_t> modelMemory(VgfModelSize());
+    VgfModel *model = CreateVgfModelInPlace(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+    CheckModel(*model);
+    model->~VgfModel();
+}
+
+TEST(CppModel, TruncatedFileRejected) {
+    Logger logger;
+    const std::string data = EncodeModel();
+
+    ASSERT_EQ(CreateVgfModel(data.c_str(), HeaderSize() - 1), nullptr);
+    ASSERT_TRUE(logger.contains({"smaller than the header size"}));
+    ASSERT_EQ(CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size() - 1)), nullptr);
+    ASSERT_TRUE(logger.contains({"section bounds invalid"}));
+}
+
+TEST(CppModel, CorruptSectionRejected) {
+    Logger logger;
+    std::string data = EncodeModel();
+
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    std::memset(data.data() + headerDecoder->GetModelResourceTableOffset(), 0xFF,
+                headerDecoder->GetModelResourceTableSize());
+
+    std::vector<uint8_t> modelMemory(VgfModelSize());
+    ASSERT_EQ(CreateVgfModelInPlace(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data()), nullptr);
+    ASSERT_TRUE(logger.contains({"VerifyModelResourceTable", "verification failed"}));
+}
+
+TEST(CppModel, LazyDecodeMatchesFull) {
+    const std::string data = EncodeModel();
+
+    std::unique_ptr<VgfModel> model =
+        CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), VerificationMode::LAZY);
+    ASSERT_NE(model, nullptr);
+    CheckModel(*model);
+}
+
+TEST(CppModel, LazyDefersEntryVerification) {
+    Logger logger;
+    std::string data = EncodeModel();
+
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    const size_t nameOffset = data.find("test_module", headerDecoder->GetModuleTableOffset());
+    ASSERT_NE(nameOffset, std::string::npos);
+    // Point the module name past the end of the buffer
+    const uint32_t badLength = 0xFFFFFFF0;
+    std::memcpy(data.data() + nameOffset - sizeof(badLength), &badLength, sizeof(badLength));
+
+    ASSERT_EQ(CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size())), nullptr);
+    ASSERT_TRUE(logger.contains({"VerifyModuleTable", "verification failed"}));
+
+    std::unique_ptr<VgfModel> model =
+        CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), VerificationMode::LAZY);
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(model->getModelSequenceTableDecoder().getSegmentName(0), "test_segment");
+    ASSERT_EQ(model->getModuleTableDecoder().size(), 1);
+    ASSERT_EQ(model->getModuleTableDecoder().getModuleName(0), "");
+    ASSERT_TRUE(model->getModuleTableDecoder().getSPIRVModuleCode(0).empty());
+    ASSERT_TRUE(logger.contains({"VerifyModule", "verification failed at index 0"}));
+}
+
+TEST(CppModel, ParallelVerificationDecodesAllSections) {
+    const std::string data = EncodeModel();
+
+    VgfModelOptions options;
+    options.parallelVerification = true;
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), options);
+    ASSERT_NE(model, nullptr);
+    CheckModel(*model);
+}
+
+TEST(CppModel, ParallelVerificationUsesExecutor) {
+    const std::string data = EncodeModel();
+
+    size_t numTasks = 0;
+    VgfModelOptions options;
+    options.parallelVerification = true;
+    options.executor = [&numTasks](const std::vector<std::function<void()>> &tasks) {
+        std::vector<std::thread> threads;
+        for (const auto &task : tasks) {
+            threads.emplace_back(task);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        numTasks += tasks.size();
+    };
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), options);
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(numTasks, 4);
+    CheckModel(*model);
+}
+
+TEST(CppModel, ParallelVerificationRejectsCorruptSection) {
+    Logger logger;
+    std::string data = EncodeModel();
+
+    std::unique_ptr<HeaderDecoder> headerDecoder =
+        CreateHeaderDecoder(data.c_str(), static_cast<uint64_t>(HeaderSize()), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(headerDecoder, nullptr);
+    std::memset(data.data() + headerDecoder->GetModuleTableOffset(), 0xFF, headerDecoder->GetModuleTableSize());
+
+    VgfModelOptions options;
+    options.parallelVerification = true;
+    ASSERT_EQ(CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), options), nullptr);
+    ASSERT_TRUE(logger.contains({"VerifyModuleTable", "verification failed"}));
+}
+
+TEST(CppNameIndex, FindsNames) {
+    constexpr uint32_t numSegments = 100;
+    const std::string data = EncodeNamedModel(numSegments);
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(model->getNameIndex(), nullptr);
+
+    std::unique_ptr<NameIndex> index =
+        CreateNameIndex(model->getModuleTableDecoder(), model->getModelSequenceTableDecoder());
+    ASSERT_NE(index, nullptr);
+    CheckNameIndex(*index, numSegments);
+}
+
+TEST(CppNameIndex, FindsNamesInPlace) {
+    constexpr uint32_t numSegments = 3;
+    const std::string data = EncodeNamedModel(numSegments);
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(model, nullptr);
+
+    const ModuleTableDecoder &moduleTable = model->getModuleTableDecoder();
+    const ModelSequenceTableDecoder &modelSequenceTable = model->getModelSequenceTableDecoder();
+    std::vector<uint64_t> indexMemory((NameIndexSize(moduleTable, modelSequenceTable) + 7) / 8);
+    NameIndex *index = CreateNameIndexInPlace(moduleTable, modelSequenceTable, indexMemory.data());
+    ASSERT_NE(index, nullptr);
+    CheckNameIndex(*index, numSegments);
+    index->~NameIndex();
+}
+
+TEST(CppNameIndex, EmptyModel) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(pretendVulkanHeaderVersion);
+    const std::string data = testutils::EncodeToString(*encoder);
+    ASSERT_FALSE(data.empty());
+
+    VgfModelOptions options;
+    options.buildNameIndex = true;
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), options);
+    ASSERT_NE(model, nullptr);
+    ASSERT_NE(model->getNameIndex(), nullptr);
+    ASSERT_EQ(model->getNameIndex()->findInputByName("input"), std::nullopt);
+    ASSERT_EQ(model->getNameIndex()->findSegmentByName("segment"), std::nullopt);
+}
+
+TEST(CppResourceIndex, ReverseLookups) {
+    const std::string data = EncodeResourceModel();
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(model, nullptr);
+
+    //! [ResourceIndexSample0 begin]
+    std::unique_ptr<ResourceIndex> index = CreateResourceIndex(
+        model->getModelSequenceTableDecoder(), model->getModelResourceTableDecoder(), model->getConstantDecoder());
+    DataView<uint32_t> weights = index->getConstants(4);
+    DataView<uint32_t> readers = index->getConsumerSegments(1);
+    //! [ResourceIndexSample0 end]
+
+    ASSERT_EQ(ToVector(weights), (Indexes{0, 2}));
+    ASSERT_EQ(ToVector(index->getConstants(5)), (Indexes{1}));
+    ASSERT_TRUE(index->getConstants(0).empty());
+
+    ASSERT_EQ(ToVector(readers), (Indexes{1, 2}));
+    ASSERT_EQ(ToVector(index->getProducerSegments(1)), (Indexes{0}));
+    ASSERT_EQ(ToVector(index->getProducerSegments(2)), (Indexes{1}));
+    ASSERT_EQ(ToVector(index->getConsumerSegments(2)), (Indexes{2}));
+    ASSERT_EQ(ToVector(index->getConsumerSegments(0)), (Indexes{0}));
+    ASSERT_TRUE(index->getProducerSegments(0).empty());
+    ASSERT_TRUE(index->getConsumerSegments(3).empty());
+    ASSERT_EQ(ToVector(index->getBindingSegments(1)), (Indexes{0, 1, 2}));
+    ASSERT_EQ(ToVector(index->getBindingSegments(3)), (Indexes{2}));
+    ASSERT_TRUE(index->getBindingSegments(4).empty());
+
+    ASSERT_EQ(ToVector(index->getAliasGroupIds()), (Indexes{3, 7}));
+    ASSERT_EQ(ToVector(index->getAliasGroupMembers(3)), (Indexes{1}));
+    ASSERT_EQ(ToVector(index->getAliasGroupMembers(7)), (Indexes{0, 2}));
+    ASSERT_TRUE(index->getAliasGroupMembers(5).empty());
+    ASSERT_TRUE(index->getAliasGroupMembers(8).empty());
+
+    ASSERT_TRUE(index->getConstants(6).empty());
+    ASSERT_TRUE(index->getProducerSegments(6).empty());
+    ASSERT_TRUE(index->getConsumerSegments(6).empty());
+    ASSERT_TRUE(index->getBindingSegments(6).empty());
+}
+
+TEST(CppResourceIndex, OutlivesDecoders) {
+    const std::string data = EncodeResourceModel();
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(model, nullptr);
+    std::unique_ptr<ResourceIndex> index = CreateResourceIndex(
+        model->getModelSequenceTableDecoder(), model->getModelResourceTableDecoder(), model->getConstantDecoder());
+    model.reset();
+
+    ASSERT_EQ(ToVector(index->getConstants(4)), (Indexes{0, 2}));
+    ASSERT_EQ(ToVector(index->getAliasGroupMembers(7)), (Indexes{0, 2}));
+}
+
+TEST(CppModel, BuildsNameIndex) {
+    constexpr uint32_t numSegments = 10;
+    const std::string data = EncodeNamedModel(numSegments);
+
+    //! [NameIndexSample0 begin]
+    VgfModelOptions options;
+    options.buildNameIndex = true;
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), options);
+    ASSERT_NE(model, nullptr);
+    std::optional<uint32_t> inputIdx = model->getNameIndex()->findInputByName("input_3");
+    //! [NameIndexSample0 end]
+
+    ASSERT_EQ(inputIdx, 3);
+    CheckNameIndex(*model->getNameIndex(), numSegments);
+}
+
+TEST(CModel, DecodesAllSections) {
+    const std::string data = EncodeModel();
+
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    const mlsdk_decoder_model *model =
+        mlsdk_decoder_create_model(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+
+    mlsdk_vk_header_version vkHeaderVersion;
+    mlsdk_decoder_get_encoder_vk_header_version(mlsdk_decoder_model_get_header_decoder(model), &vkHeaderVersion);
+    ASSERT_EQ(vkHeaderVersion, pretendVulkanHeaderVersion);
+
+    const mlsdk_decoder_module_table_decoder *moduleDecoder = mlsdk_decoder_model_get_module_table_decoder(model);
+    ASSERT_EQ(mlsdk_decoder_get_module_table_num_entries(moduleDecoder), 1);
+    ASSERT_STREQ(mlsdk_decoder_get_module_name(moduleDecoder, 0), "test_module");
+
+    const mlsdk_decoder_model_sequence_decoder *sequenceDecoder = mlsdk_decoder_model_get_model_sequence_decoder(model);
+    ASSERT_EQ(mlsdk_decoder_model_sequence_get_segment_name(sequenceDecoder, 0), std::string("test_segment"));
+
+    const mlsdk_decoder_model_resource_table_decoder *resourceDecoder =
+        mlsdk_decoder_model_get_model_resource_table_decoder(model);
+    ASSERT_EQ(mlsdk_decoder_get_model_resource_table_num_entries(resourceDecoder), 3);
+
+    const mlsdk_decoder_constant_table_decoder *constantDecoder = mlsdk_decoder_model_get_constant_table_decoder(model);
+    ASSERT_EQ(mlsdk_decoder_get_constant_table_num_entries(constantDecoder), 1);
+    mlsdk_decoder_constant_data constantData;
+    mlsdk_decoder_constant_table_get_data(constantDecoder, 0, &constantData);
+    ASSERT_EQ(constantData.size, 4);
+    ASSERT_EQ(constantData.data[3], 4);
+}
+
+TEST(CModel, CorruptFileRejected) {
+    std::string data = EncodeModel();
+    data[0] = 'X';
+
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    ASSERT_EQ(mlsdk_decoder_create_model(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data()),
+              nullptr);
+}
+
+TEST(CModel, NameIndex) {
+    const std::string data = EncodeNamedModel(5);
+
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    const mlsdk_decoder_model *model =
+        mlsdk_decoder_create_model(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+
+    //! [CNameIndexSample0 begin]
+    const mlsdk_decoder_module_table_decoder *moduleDecoder = mlsdk_decoder_model_get_module_table_decoder(model);
+    const mlsdk_decoder_model_sequence_decoder *sequenceDecoder = mlsdk_decoder_model_get_model_sequence_decoder(model);
+    std::vector<uint8_t> nameIndexMemory(mlsdk_decoder_name_index_mem_reqs(moduleDecoder, sequenceDecoder));
+    const mlsdk_decoder_name_index *nameIndex =
+        mlsdk_decoder_create_name_index(moduleDecoder, sequenceDecoder, nameIndexMemory.data());
+
+    uint32_t inputIdx = 0;
+    bool found = mlsdk_decoder_name_index_find_input_by_name(nameIndex, "input_2", &inputIdx);
+    //! [CNameIndexSample0 end]
+    ASSERT_NE(nameIndex, nullptr);
+    ASSERT_TRUE(found);
+    ASSERT_EQ(inputIdx, 2);
+
+    uint32_t idx = 0;
+    ASSERT_TRUE(mlsdk_decoder_name_index_find_output_by_name(nameIndex, "output_4", &idx));
+    ASSERT_EQ(idx, 4);
+    ASSERT_TRUE(mlsdk_decoder_name_index_find_module_by_name(nameIndex, "module_1", &idx));
+    ASSERT_EQ(idx, 1);
+    ASSERT_TRUE(mlsdk_decoder_name_index_find_segment_by_name(nameIndex, "segment_0", &idx));
+    ASSERT_EQ(idx, 0);
+    ASSERT_FALSE(mlsdk_decoder_name_index_find_segment_by_name(nameIndex, "segment_5", &idx));
+    ASSERT_FALSE(mlsdk_decoder_name_index_find_input_by_name(nameIndex, "module_1", &idx));
+}
+
+TEST(CModel, ResourceIndex) {
+    const std::string data = EncodeResourceModel();
+
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    const mlsdk_decoder_model *model =
+        mlsdk_decoder_create_model(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+
+    //! [CResourceIndexSample0 begin]
+    mlsdk_decoder_resource_index *resourceIndex =
+        mlsdk_decoder_create_resource_index(mlsdk_decoder_model_get_model_sequence_decoder(model),
+                                            mlsdk_decoder_model_get_model_resource_table_decoder(model),
+                                            mlsdk_decoder_model_get_constant_table_decoder(model));
+
+    mlsdk_decoder_index_list producers;
+    mlsdk_decoder_resource_index_get_producer_segments(resourceIndex, 2, &producers);
+    //! [CResourceIndexSample0 end]
+    ASSERT_NE(resourceIndex, nullptr);
+    ASSERT_EQ(Indexes(producers.data, producers.data + producers.size), (Indexes{1}));
+
+    mlsdk_decoder_index_list list;
+    mlsdk_decoder_resource_index_get_constants(resourceIndex, 4, &list);
+    ASSERT_EQ(Indexes(list.data, list.data + list.size), (Indexes{0, 2}));
+    mlsdk_decoder_resource_index_get_consumer_segments(resourceIndex, 1, &list);
+    ASSERT_EQ(Indexes(list.data, list.data + list.size), (Indexes{1, 2}));
+    mlsdk_decoder_resource_index_get_binding_segments(resourceIndex, 3, &list);
+    ASSERT_EQ(Indexes(list.data, list.data + list.size), (Indexes{2}));
+    mlsdk_decoder_resource_index_get_alias_group_ids(resourceIndex, &list);
+    ASSERT_EQ(Indexes(list.data, list.data + list.size), (Indexes{3, 7}));
+    mlsdk_decoder_resource_index_get_alias_group_members(resourceIndex, 7, &list);
+    ASSERT_EQ(Indexes(list.data, list.data + list.size), (Indexes{0, 2}));
+    mlsdk_decoder_resource_index_get_constants(resourceIndex, 6, &list);
+    ASSERT_EQ(list.size, 0);
+
+    //! [CResourceIndexSample1 begin]
+    mlsdk_decoder_destroy_resource_index(resourceIndex);
+    //! [CResourceIndexSample1 end]
+}
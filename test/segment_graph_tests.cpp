@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.hpp"
+#include "vgf/decoder.h"
+#include "vgf/decoder.hpp"
+#include "vgf/encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+using testutils::ToVector;
+
+namespace {
+
+using Indexes = std::vector<uint32_t>;
+
+/// A segment binding resources given by their index in the model resource table
+struct TestSegment {
+    Indexes inputs;
+    Indexes outputs;
+    Indexes descriptors = {};
+};
+
+std::string EncodeModel(uint32_t numResources, const std::vector<TestSegment> &segments) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(0);
+    ModuleRef module = encoder->AddModule(ModuleType::GRAPH, "module", "main");
+    std::vector<BindingSlotRef> slots;
+    for (uint32_t i = 0; i < numResources; ++i) {
+        ResourceRef resource = encoder->AddIntermediateResource(DescriptorType{}, FormatType{}, {1, 4}, {});
+        slots.push_back(encoder->AddBindingSlot(i, resource));
+    }
+    const auto toSlots = [&](const Indexes &indexes) {
+        std::vector<BindingSlotRef> refs;
+        for (const uint32_t idx : indexes) {
+            refs.push_back(slots[idx]);
+        }
+        return refs;
+    };
+    for (size_t i = 0; i < segments.size(); ++i) {
+        std::vector<DescriptorSetInfoRef> descriptors;
+        if (!segments[i].descriptors.empty()) {
+            descriptors.push_back(encoder->AddDescriptorSetInfo(toSlots(segments[i].descriptors)));
+        }
+        encoder->AddSegmentInfo(module, "segment_" + std::to_string(i), descriptors, toSlots(segments[i].inputs),
+                                toSlots(segments[i].outputs));
+    }
+    return testutils::EncodeToString(*encoder);
+}
+
+std::unique_ptr<SegmentGraph> CreateGraph(const std::string &data) {
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    EXPECT_NE(model, nullptr);
+    return CreateSegmentGraph(model->getModelSequenceTableDecoder());
+}
+
+Indexes ToVector(const mlsdk_decoder_index_list &list) { return {list.data, list.data + list.size}; }
+
+/// Two branches reading the graph input and joining, next to a segment only reading the input
+std::string EncodeDiamond() {
+    return EncodeModel(6, {{{0}, {1}}, {{0}, {2}}, {{1}, {3}}, {{2, 3}, {4}}, {{0}, {5}}});
+}
+
+} // namespace
+
+TEST(CppSegmentGraph, Diamond) {
+    const std::string data = EncodeDiamond();
+    std::unique_ptr<VgfModel> model = CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()));
+    ASSERT_NE(model, nullptr);
+
+    //! [SegmentGraphSample0 begin]
+    std::unique_ptr<SegmentGraph> graph = CreateSegmentGraph(model->getModelSequenceTableDecoder());
+    for (uint32_t level = 0; level < graph->getNumLevels(); ++level) {
+        for (uint32_t segmentIdx : graph->getLevelSegments(level)) {
+            // Every segment of the level can be submitted once the previous level completed
+            (void)segmentIdx;
+        }
+    }
+    //! [SegmentGraphSample0 end]
+
+    ASSERT_EQ(graph->size(), 5);
+    ASSERT_TRUE(graph->getPredecessors(0).empty());
+    ASSERT_TRUE(graph->getPredecessors(1).empty());
+    ASSERT_EQ(ToVector(graph->getPredecessors(2)), (Indexes{0}));
+    ASSERT_EQ(ToVector(graph->getPredecessors(3)), (Indexes{1, 2}));
+    ASSERT_TRUE(graph->getPredecessors(4).empty());
+    ASSERT_EQ(ToVector(graph->getSuccessors(0)), (Indexes{2}));
+    ASSERT_EQ(ToVector(graph->getSuccessors(1)), (Indexes{3}));
+    ASSERT_EQ(ToVector(graph->getSuccessors(2)), (Indexes{3}));
+    ASSERT_TRUE(graph->getSuccessors(3).empty());
+
+    ASSERT_EQ(graph->getNumLevels(), 3);
+    ASSERT_EQ(graph->getLevel(3), 2);
+    ASSERT_EQ(ToVector(graph->getLevelSegments(0)), (Indexes{0, 1, 4}));
+    ASSERT_EQ(ToVector(graph->getLevelSegments(1)), (Indexes{2}));
+    ASSERT_EQ(ToVector(graph->getLevelSegments(2)), (Indexes{3}));
+    ASSERT_TRUE(graph->getLevelSegments(3).empty());
+    ASSERT_EQ(ToVector(graph->getCriticalPath()), (Indexes{0, 2, 3}));
+
+    ASSERT_TRUE(graph->getPredecessors(5).empty());
+    ASSERT_TRUE(graph->getSuccessors(5).empty());
+}
+
+TEST(CppSegmentGraph, WriteAfterRead) {
+    // Segment 1 overwrites the resource segment 0 reads, and segment 2 reads the new value
+    std::unique_ptr<SegmentGraph> graph = CreateGraph(EncodeModel(2, {{{0}, {1}}, {{}, {0}}, {{0}, {}}}));
+
+    ASSERT_EQ(ToVector(graph->getPredecessors(1)), (Indexes{0}));
+    ASSERT_EQ(ToVector(graph->getPredecessors(2)), (Indexes{1}));
+    ASSERT_EQ(ToVector(graph->getCriticalPath()), (Indexes{0, 1, 2}));
+}
+
+TEST(CppSegmentGraph, WriteAfterWrite) {
+    std::unique_ptr<SegmentGraph> graph = CreateGraph(EncodeModel(1, {{{}, {0}}, {{}, {0}}}));
+
+    ASSERT_EQ(ToVector(graph->getPredecessors(1)), (Indexes{0}));
+}
+
+TEST(CppSegmentGraph, DescriptorBindings) {
+    // Resources bound only through descriptor sets are written, descriptor bindings of an input are only read
+    std::unique_ptr<SegmentGraph> graph =
+        CreateGraph(EncodeModel(2, {{{}, {}, {0}}, {{}, {}, {0}}, {{1}, {}, {1}}, {{1}, {}, {1}}}));
+
+    ASSERT_EQ(ToVector(graph->getPredecessors(1)), (Indexes{0}));
+    ASSERT_TRUE(graph->getPredecessors(3).empty());
+    ASSERT_EQ(ToVector(graph->getLevelSegments(0)), (Indexes{0, 2, 3}));
+}
+
+TEST(CppSegmentGraph, EmptyModel) {
+    std::unique_ptr<SegmentGraph> graph = CreateGraph(EncodeModel(0, {}));
+
+    ASSERT_EQ(graph->size(), 0);
+    ASSERT_EQ(graph->getNumLevels(), 0);
+    ASSERT_TRUE(graph->getCriticalPath().empty());
+    ASSERT_TRUE(graph->getLevelSegments(0).empty());
+}
+
+TEST(CSegmentGraph, Diamond) {
+    const std::string data = EncodeDiamond();
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    const mlsdk_decoder_model *model =
+        mlsdk_decoder_create_model(data.c_str(), static_cast<uint64_t>(data.size()), modelMemory.data());
+    ASSERT_NE(model, nullptr);
+
+    //! [CSegmentGraphSample0 begin]
+    mlsdk_decoder_segment_graph *graph =
+        mlsdk_decoder_create_segment_graph(mlsdk_decoder_model_get_model_sequence_decoder(model));
+
+    mlsdk_decoder_index_list levelSegments;
+    for (uint32_t level = 0; level < mlsdk_decoder_segment_graph_get_num_levels(graph); ++level) {
+        mlsdk_decoder_segment_graph_get_level_segments(graph, level, &levelSegments);
+        // Every segment of the level can be submitted once the previous level completed
+    }
+
+    mlsdk_decoder_destroy_segment_graph(graph);
+    //! [CSegmentGraphSample0 end]
+
+    graph = mlsdk_decoder_create_segment_graph(mlsdk_decoder_model_get_model_sequence_decoder(model));
+    ASSERT_NE(graph, nullptr);
+    mlsdk_decoder_index_list list;
+    mlsdk_decoder_segment_graph_get_predecessors(graph, 3, &list);
+    ASSERT_EQ(ToVector(list), (Indexes{1, 2}));
+    mlsdk_decoder_segment_graph_get_successors(graph, 0, &list);
+    ASSERT_EQ(ToVector(list), (Indexes{2}));
+    ASSERT_EQ(mlsdk_decoder_segment_graph_get_level(graph, 2), 1);
+    ASSERT_EQ(mlsdk_decoder_segment_graph_get_num_levels(graph), 3);
+    mlsdk_decoder_segment_graph_get_level_segments(graph, 0, &list);
+    ASSERT_EQ(ToVector(list), (Indexes{0, 1, 4}));
+    mlsdk_decoder_segment_graph_get_critical_path(graph, &list);
+    ASSERT_EQ(ToVector(list), (Indexes{0, 2, 3}));
+    mlsdk_decoder_destroy_segment_graph(graph);
+}
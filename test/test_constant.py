@@ -4,6 +4,7 @@
 # SPDX-License-Identifier: Apache-2.0
 #
 import io
+import os
 
 import numpy as np
 import pytest
@@ -97,6 +98,139 @@ def test_encode_decode_non_Sparse_constant():
     assert not constantDecoder.isSparseConstant(constantRef.reference)
 
 
+def test_encode_decode_borrowed_constant():
+
+    encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
+
+    resourceRef = vgf.ResourceRef(42)
+    constant = np.arange(11, dtype=np.uint8)
+
+    constantRef = encoder.AddConstant(resourceRef, constant, borrow=True)
+    del constant
+
+    encoder.Finish()
+
+    stream = io.BytesIO()
+    assert encoder.WriteTo(stream)
+
+    buffer = stream.getbuffer()
+
+    headerDecoder = vgf.CreateHeaderDecoder(buffer, vgf.HeaderSize(), buffer.nbytes)
+    assert headerDecoder is not None
+
+    constantDecoder = vgf.CreateConstantDecoder(
+        buffer[headerDecoder.GetConstantsOffset() :],
+        headerDecoder.GetConstantsSize(),
+    )
+    assert constantDecoder is not None
+
+    assert constantDecoder.size() == 1
+    assert constantDecoder.getConstant(constantRef.reference) == memoryview(
+        np.arange(11, dtype=np.uint8)
+    )
+    assert not constantDecoder.isSparseConstant(constantRef.reference)
+
+
+def test_encode_decode_aligned_constant():
+
+    encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
+
+    constant = np.arange(3, dtype=np.uint8)
+    encoder.AddConstant(vgf.ResourceRef(0), constant)
+    encoder.SetConstantAlignment(4096)
+    constantRef = encoder.AddConstant(vgf.ResourceRef(1), constant)
+
+    encoder.Finish()
+
+    stream = io.BytesIO()
+    assert encoder.WriteTo(stream)
+
+    buffer = stream.getbuffer()
+
+    headerDecoder = vgf.CreateHeaderDecoder(buffer, vgf.HeaderSize(), buffer.nbytes)
+    assert headerDecoder is not None
+
+    constantDecoder = vgf.CreateConstantDecoder(
+        buffer[headerDecoder.GetConstantsOffset() :],
+        headerDecoder.GetConstantsSize(),
+    )
+    assert constantDecoder is not None
+
+    assert constantDecoder.size() == 2
+    assert constantDecoder.getConstantAlignment(0) == 8
+    assert constantDecoder.getConstantAlignment(constantRef.reference) == 4096
+    assert constantDecoder.isConstantAligned(
+        constantRef.reference, headerDecoder.GetConstantsOffset(), 4096
+    )
+    assert constantDecoder.getConstant(constantRef.reference) == memoryview(constant)
+
+
+def _encode_large_constant():
+    encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
+    # Larger than the chunk size used to write to IO streams
+    constant = np.arange(3 * 1024 * 1024 + 5, dtype=np.uint8)
+    encoder.AddConstant(vgf.ResourceRef(0), constant)
+    encoder.Finish()
+    return encoder
+
+
+def test_write_to_targets(tmp_path):
+
+    encoder = _encode_large_constant()
+    stream = io.BytesIO()
+    assert encoder.WriteTo(stream)
+    expected = stream.getvalue()
+
+    encoder = _encode_large_constant()
+    assert encoder.GetEncodedSize() == len(expected)
+    path = tmp_path / "model.vgf"
+    assert encoder.WriteTo(path)
+    assert path.read_bytes() == expected
+
+    encoder = _encode_large_constant()
+    assert encoder.WriteTo(str(path))
+    assert path.read_bytes() == expected
+
+    encoder = _encode_large_constant()
+    fd = os.open(tmp_path / "model_fd.vgf", os.O_WRONLY | os.O_CREAT | os.O_TRUNC)
+    try:
+        assert encoder.WriteTo(fd)
+    finally:
+        os.close(fd)
+    assert (tmp_path / "model_fd.vgf").read_bytes() == expected
+
+    encoder = _encode_large_constant()
+    buffer = bytearray(len(expected))
+    assert encoder.WriteTo(buffer)
+    assert buffer == expected
+
+    encoder = _encode_large_constant()
+    assert not encoder.WriteTo(bytearray(len(expected) - 1))
+
+    encoder = _encode_large_constant()
+    view = encoder.EncodeToMemoryView()
+    assert view.nbytes == len(expected)
+    assert view.tobytes() == expected
+
+
+def test_write_to_raises_io_errors():
+
+    class FailingStream(io.RawIOBase):
+        def writable(self):
+            return True
+
+        def write(self, data):
+            raise OSError("disk full")
+
+    encoder = _encode_large_constant()
+    with pytest.raises(OSError, match="disk full"):
+        encoder.WriteTo(FailingStream())
+
+    encoder = _encode_large_constant()
+    with pytest.raises(TypeError):
+        encoder.WriteTo(1.5)
+
+
 def test_encode_decode_empty_constant_section():
 
     encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
@@ -107,3 +107,28 @@ def test_encode_fails_to_write(tmp_path):
 
     with pytest.raises(io.UnsupportedOperation):
         encoder.WriteTo(vgfStream)
+
+
+def test_section_integrity():
+
+    encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
+    encoder.SetSectionChecksums(True)
+    encoder.Finish()
+
+    stream = io.BytesIO()
+    assert encoder.WriteTo(stream)
+    buffer = bytearray(stream.getvalue())
+
+    assert vgf.CheckIntegrity(buffer, len(buffer)) == vgf.IntegrityStatus.Valid
+
+    headerDecoder = vgf.CreateHeaderDecoder(buffer, vgf.HeaderSize(), len(buffer))
+    assert headerDecoder is not None
+    buffer[headerDecoder.GetModuleTableOffset()] ^= 0x01
+    assert (
+        vgf.CheckSectionIntegrity(buffer, len(buffer), vgf.SectionName.Modules)
+        == vgf.IntegrityStatus.Corrupted
+    )
+    assert (
+        vgf.CheckSectionIntegrity(buffer, len(buffer), vgf.SectionName.Constants)
+        == vgf.IntegrityStatus.Valid
+    )
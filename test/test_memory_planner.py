@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+# SPDX-License-Identifier: Apache-2.0
+#
+import io
+
+import numpy as np
+import pytest
+import vgfpy as vgf
+
+"""Tests for the VGF intermediate memory planner."""
+
+pretendVulkanHeaderVersion = 123
+
+VK_FORMAT_R32_SFLOAT = 100
+
+pytestmark = pytest.mark.memory_planner_test
+
+
+def encode_chain(numSegments, shape):
+    """Encode segments where segment i reads intermediate i and writes intermediate i + 1."""
+    encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
+    module = encoder.AddModule(vgf.ModuleType.Graph, "test_module", "entry_point")
+
+    slots = []
+    for i in range(numSegments + 1):
+        resource = encoder.AddIntermediateResource(
+            0, VK_FORMAT_R32_SFLOAT, np.array(shape, dtype=np.int64), []
+        )
+        slots.append(encoder.AddBindingSlot(i, resource))
+    for i in range(numSegments):
+        encoder.AddSegmentInfo(
+            module, f"segment_{i}", inputs=[slots[i]], outputs=[slots[i + 1]]
+        )
+    encoder.Finish()
+
+    stream = io.BytesIO()
+    assert encoder.WriteTo(stream)
+    return stream.getbuffer()
+
+
+def create_decoders(buffer):
+    headerDecoder = vgf.CreateHeaderDecoder(buffer, vgf.HeaderSize(), buffer.nbytes)
+    assert headerDecoder is not None
+
+    seqTableDecoder = vgf.CreateModelSequenceTableDecoder(
+        buffer[headerDecoder.GetModelSequenceTableOffset() :],
+        headerDecoder.GetModelSequenceTableSize(),
+    )
+    mrtDecoder = vgf.CreateModelResourceTableDecoder(
+        buffer[headerDecoder.GetModelResourceTableOffset() :],
+        headerDecoder.GetModelResourceTableSize(),
+    )
+    assert seqTableDecoder is not None
+    assert mrtDecoder is not None
+    return seqTableDecoder, mrtDecoder
+
+
+def test_plan_intermediate_memory_chain():
+    buffer = encode_chain(4, [1, 256])
+    seqTableDecoder, mrtDecoder = create_decoders(buffer)
+
+    plan = vgf.PlanIntermediateMemory(seqTableDecoder, mrtDecoder)
+    assert plan is not None
+    assert plan.peakBytes == 2048
+    assert plan.totalBytes == 5 * 1024
+    assert [allocation.mrtIndex for allocation in plan.allocations] == [0, 1, 2, 3, 4]
+    assert all(allocation.size == 1024 for allocation in plan.allocations)
+
+    allocation = plan.allocations[2]
+    assert allocation.firstSegment == 1
+    assert allocation.lastSegment == 2
+    assert allocation.offset != plan.allocations[1].offset
+    assert allocation.offset != plan.allocations[3].offset
+
+
+def test_plan_intermediate_memory_alignment():
+    buffer = encode_chain(1, [3])
+    seqTableDecoder, mrtDecoder = create_decoders(buffer)
+
+    options = vgf.MemoryPlanOptions()
+    options.alignment = 16
+    plan = vgf.PlanIntermediateMemory(seqTableDecoder, mrtDecoder, options)
+    assert plan is not None
+    assert [allocation.size for allocation in plan.allocations] == [16, 16]
+    assert plan.peakBytes == 32
+
+    options.alignment = 3
+    assert vgf.PlanIntermediateMemory(seqTableDecoder, mrtDecoder, options) is None
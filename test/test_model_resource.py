@@ -314,3 +314,55 @@ def test_encode_decode_model_resource_table_alias_group_fields():
     assert mrtDecoder.getAliasGroupId(default_resource.reference) is None
     default_handle = mrtDecoder.getSamplerConfigHandle(default_resource.reference)
     assert default_handle is None
+
+
+def test_model_resource_table_tensor_layout():
+
+    encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
+
+    VK_DESCRIPTOR_TYPE_STORAGE_IMAGE = 3
+    VK_FORMAT_UNDEFINED = 0
+    VK_FORMAT_R32_SFLOAT = 100
+
+    shape = np.array([2, 3, 4], dtype=np.int64)
+    strides = np.array([64, 16, 4], dtype=np.int64)
+
+    packed = encoder.AddIntermediateResource(
+        VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_FORMAT_R32_SFLOAT, shape, []
+    )
+    padded = encoder.AddIntermediateResource(
+        VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_FORMAT_R32_SFLOAT, shape, strides
+    )
+    unknown = encoder.AddIntermediateResource(
+        VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+        VK_FORMAT_UNDEFINED,
+        np.array([4], dtype=np.int64),
+        [],
+    )
+    encoder.Finish()
+
+    stream = io.BytesIO()
+    assert encoder.WriteTo(stream)
+    buffer = stream.getbuffer()
+
+    headerDecoder = vgf.CreateHeaderDecoder(buffer, vgf.HeaderSize(), buffer.nbytes)
+    assert headerDecoder is not None
+    mrtDecoder = vgf.CreateModelResourceTableDecoder(
+        buffer[headerDecoder.GetModelResourceTableOffset() :],
+        headerDecoder.GetModelResourceTableSize(),
+    )
+    assert mrtDecoder is not None
+
+    layout = mrtDecoder.getTensorLayout(packed.reference)
+    assert layout.elementCount == 24
+    assert layout.elementSize == 4
+    assert layout.packedByteSize == 96
+    assert layout.spanByteSize == 96
+    assert layout.contiguous
+
+    layout = mrtDecoder.getTensorLayout(padded.reference)
+    assert layout.packedByteSize == 96
+    assert layout.spanByteSize == 112
+    assert not layout.contiguous
+
+    assert mrtDecoder.getTensorLayout(unknown.reference) is None
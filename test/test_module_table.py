@@ -243,3 +243,35 @@ def test_encode_decode_module_table_single_hlsl_module():
         == "[numthreads(1,1,1)] void main(){}"
     )
     assert moduleDecoder.getSPIRVModuleCode(module.reference) is None
+
+
+def test_decode_module_table_lazy_and_cached():
+
+    code = np.array([1, 2, 3, 4], dtype=np.uint32)
+
+    encoder = vgf.CreateEncoder(pretendVulkanHeaderVersion)
+    encoder.AddModule(vgf.ModuleType.Graph, "test", "main", code)
+    encoder.Finish()
+
+    stream = io.BytesIO()
+    assert encoder.WriteTo(stream)
+    buffer = stream.getbuffer()
+
+    headerDecoder = vgf.CreateHeaderDecoder(buffer, vgf.HeaderSize(), buffer.nbytes)
+    section = buffer[headerDecoder.GetModuleTableOffset() :]
+    size = headerDecoder.GetModuleTableSize()
+
+    moduleDecoder = vgf.CreateModuleTableDecoder(section, size, vgf.VerificationMode.Lazy)
+    assert moduleDecoder.getModuleName(0) == "test"
+
+    options = vgf.VerificationCacheOptions()
+    options.enabled = True
+    try:
+        assert vgf.ConfigureVerificationCache(options)
+        assert vgf.CreateModuleTableDecoder(section, size) is not None
+        assert vgf.CreateModuleTableDecoder(section, size) is not None
+        stats = vgf.GetVerificationCacheStats()
+        assert stats.hits == 1
+        assert stats.misses == 1
+    finally:
+        vgf.ConfigureVerificationCache(vgf.VerificationCacheOptions())
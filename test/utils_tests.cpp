@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include <vector>
 
 using namespace mlsdk::vgflib;
 
@@ -113,3 +114,26 @@ TEST(BinarySection, AppendAlignedByteRangeRejectsInvalidLayout) {
     EXPECT_FALSE(appendAlignedByteRange(1, 8, payloadSize).has_value());
     EXPECT_EQ(payloadSize, std::numeric_limits<uint64_t>::max());
 }
+
+TEST(Hash, HashBytes) {
+    std::vector<uint8_t> data(100);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    const std::vector<uint8_t> copy = data;
+
+    // Every length exercises a different mix of stripes, words and tail bytes
+    for (uint64_t size = 0; size <= data.size(); ++size) {
+        EXPECT_EQ(hashBytes(data.data(), size), hashBytes(copy.data(), size));
+        if (size > 0) {
+            EXPECT_NE(hashBytes(data.data(), size), hashBytes(data.data(), size - 1));
+        }
+    }
+
+    std::vector<uint8_t> changed = data;
+    changed[37] ^= 1;
+    EXPECT_NE(hashBytes(data.data(), data.size()), hashBytes(changed.data(), changed.size()));
+
+    const std::vector<uint8_t> zeros(64, 0);
+    EXPECT_NE(hashBytes(zeros.data(), 32), hashBytes(zeros.data(), 64));
+}
@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common.hpp"
+#include "vgf/decoder.h"
+#include "vgf/decoder.hpp"
+#include "vgf/encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mlsdk::vgflib;
+using logging::utils::Logger;
+
+namespace {
+
+// Module table, model sequence table, model resource table and constants
+constexpr uint64_t NUM_SECTIONS = 4;
+
+std::string EncodeModel(uint32_t spirvWord) {
+    std::unique_ptr<Encoder> encoder = CreateEncoder(0);
+    ModuleRef module = encoder->AddModule(ModuleType::COMPUTE, "test_module", "main", {0x07230203, spirvWord});
+    ResourceRef weights = encoder->AddConstantResource(FormatType{}, {4}, {});
+    const std::vector<uint8_t> weightsData{1, 2, 3, 4};
+    ConstantRef constant = encoder->AddConstant(weights, weightsData.data(), weightsData.size());
+    encoder->AddSegmentInfo(module, "test_segment", {}, {}, {}, {constant});
+    encoder->Finish();
+
+    std::stringstream buffer;
+    EXPECT_TRUE(encoder->WriteTo(buffer));
+    return buffer.str();
+}
+
+VerificationCacheOptions Enabled(const std::string &sidecarPath = "") {
+    VerificationCacheOptions options;
+    options.enabled = true;
+    options.sidecarPath = sidecarPath;
+    return options;
+}
+
+bool Open(const std::string &data, VerificationMode mode = VerificationMode::FULL) {
+    return CreateVgfModel(data.c_str(), static_cast<uint64_t>(data.size()), mode) != nullptr;
+}
+
+class VerificationCache : public ::testing::Test {
+  protected:
+    void TearDown() override { ConfigureVerificationCache({}); }
+};
+
+} // namespace
+
+TEST_F(VerificationCache, DisabledByDefault) {
+    ASSERT_TRUE(Open(EncodeModel(1)));
+    ASSERT_EQ(GetVerificationCacheStats().hits, 0);
+    ASSERT_EQ(GetVerificationCacheStats().misses, 0);
+}
+
+TEST_F(VerificationCache, ReopenHits) {
+    ASSERT_TRUE(ConfigureVerificationCache(Enabled()));
+    const std::string data = EncodeModel(1);
+
+    ASSERT_TRUE(Open(data));
+    ASSERT_EQ(GetVerificationCacheStats().hits, 0);
+    ASSERT_EQ(GetVerificationCacheStats().misses, NUM_SECTIONS);
+
+    ASSERT_TRUE(Open(data));
+    ASSERT_EQ(GetVerificationCacheStats().hits, NUM_SECTIONS);
+    ASSERT_EQ(GetVerificationCacheStats().misses, NUM_SECTIONS);
+}
+
+TEST_F(VerificationCache, ChangedSectionMisses) {
+    ASSERT_TRUE(ConfigureVerificationCache(Enabled()));
+
+    ASSERT_TRUE(Open(EncodeModel(1)));
+    ASSERT_TRUE(Open(EncodeModel(2)));
+    // Only the module table differs
+    ASSERT_EQ(GetVerificationCacheStats().hits, NUM_SECTIONS - 1);
+    ASSERT_EQ(GetVerificationCacheStats().misses, NUM_SECTIONS + 1);
+}
+
+TEST_F(VerificationCache, InvalidateDropsDigests) {
+    ASSERT_TRUE(ConfigureVerificationCache(Enabled()));
+    const std::string data = EncodeModel(1);
+
+    ASSERT_TRUE(Open(data));
+    InvalidateVerificationCache();
+    ASSERT_TRUE(Open(data));
+    ASSERT_EQ(GetVerificationCacheStats().hits, 0);
+    ASSERT_EQ(GetVerificationCacheStats().misses, 2 * NUM_SECTIONS);
+}
+
+TEST_F(VerificationCache, LazyModeBypassesCache) {
+    ASSERT_TRUE(ConfigureVerificationCache(Enabled()));
+    const std::string data = EncodeModel(1);
+
+    ASSERT_TRUE(Open(data, VerificationMode::LAZY));
+    // Only the constants section is verified fully
+    ASSERT_EQ(GetVerificationCacheStats().misses, 1);
+}
+
+TEST_F(VerificationCache, SidecarPersistsDigests) {
+    TempFolder tempFolder("vgf_verification_cache");
+    const std::string sidecarPath = tempFolder.relative("model.vgf.verified").string();
+    const std::string data = EncodeModel(1);
+
+    ASSERT_TRUE(ConfigureVerificationCache(Enabled(sidecarPath)));
+    ASSERT_TRUE(Open(data));
+    ASSERT_EQ(GetVerificationCacheStats().misses, NUM_SECTIONS);
+
+    // Reconfiguring drops the in-memory digests, they are reloaded from the sidecar
+    ASSERT_TRUE(ConfigureVerificationCache(Enabled(sidecarPath)));
+    ASSERT_TRUE(Open(data));
+    ASSERT_EQ(GetVerificationCacheStats().hits, NUM_SECTIONS);
+    ASSERT_EQ(GetVerificationCacheStats().misses, 0);
+
+    InvalidateVerificationCache();
+    ASSERT_TRUE(ConfigureVerificationCache(Enabled(sidecarPath)));
+    ASSERT_TRUE(Open(data));
+    ASSERT_EQ(GetVerificationCacheStats().hits, 0);
+}
+
+TEST_F(VerificationCache, InvalidSidecarRejected) {
+    Logger logger;
+    TempFolder tempFolder("vgf_verification_cache");
+    const std::string sidecarPath = tempFolder.relative("model.vgf.verified").string();
+    std::ofstream(sidecarPath) << "not a sidecar";
+
+    ASSERT_FALSE(ConfigureVerificationCache(Enabled(sidecarPath)));
+    ASSERT_TRUE(logger.contains({"is not a verification cache sidecar"}));
+
+    // The cache still works in memory
+    const std::string data = EncodeModel(1);
+    ASSERT_TRUE(Open(data));
+    ASSERT_TRUE(Open(data));
+    ASSERT_EQ(GetVerificationCacheStats().hits, NUM_SECTIONS);
+}
+
+TEST_F(VerificationCache, CApi) {
+    ASSERT_TRUE(mlsdk_decoder_configure_verification_cache(true, nullptr));
+    const std::string data = EncodeModel(1);
+
+    const auto size = static_cast<uint64_t>(data.size());
+    std::vector<uint8_t> modelMemory(mlsdk_decoder_model_mem_reqs());
+    ASSERT_NE(mlsdk_decoder_create_model(data.c_str(), size, modelMemory.data()), nullptr);
+    ASSERT_NE(mlsdk_decoder_create_model(data.c_str(), size, modelMemory.data()), nullptr);
+
+    mlsdk_decoder_verification_cache_stats stats;
+    mlsdk_decoder_get_verification_cache_stats(&stats);
+    ASSERT_EQ(stats.hits, NUM_SECTIONS);
+    ASSERT_EQ(stats.misses, NUM_SECTIONS);
+
+    mlsdk_decoder_invalidate_verification_cache();
+    ASSERT_NE(mlsdk_decoder_create_model(data.c_str(), size, modelMemory.data()), nullptr);
+    mlsdk_decoder_get_verification_cache_stats(&stats);
+    ASSERT_EQ(stats.misses, 2 * NUM_SECTIONS);
+}
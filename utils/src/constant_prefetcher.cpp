@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: Copyright 2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "vgf-utils/constant_prefetcher.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mlsdk::vgfutils {
+
+namespace {
+
+constexpr uint32_t NOT_USED = std::numeric_limits<uint32_t>::max();
+
+/// Appends the ranges sorted by offset, merging those less than maxGap bytes apart
+void AppendMerged(std::vector<MappedRange> &ranges, std::vector<MappedRange> &out, size_t maxGap) {
+    std::sort(ranges.begin(), ranges.end(),
+              [](const MappedRange &lhs, const MappedRange &rhs) { return lhs.offset < rhs.offset; });
+    const size_t first = out.size();
+    for (const MappedRange &range : ranges) {
+        if (out.size() > first && range.offset <= out.back().offset + out.back().size + maxGap) {
+            MappedRange &last = out.back();
+            last.size = std::max(last.offset + last.size, range.offset + range.size) - last.offset;
+        } else {
+            out.push_back(range);
+        }
+    }
+}
+
+} // namespace
+
+ConstantPrefetcher::ConstantPrefetcher(const MemoryMap &mapped,
+                                       const vgflib::ModelSequenceTableDecoder &modelSequenceTable,
+                                       const vgflib::ConstantDecoder &constants)
+    : mapped_(mapped) {
+    const auto base = reinterpret_cast<uintptr_t>(mapped.ptr());
+    const auto rangeOf = [&](uint32_t constantIdx) {
+        const vgflib::DataView<uint8_t> data = constants.getConstant(constantIdx);
+        const auto begin = reinterpret_cast<uintptr_t>(data.begin());
+        if (begin < base || begin - base > mapped.size() || data.size() > mapped.size() - (begin - base)) {
+            throw std::runtime_error("constant " + std::to_string(constantIdx) + " is not within the mapped file");
+        }
+        return MappedRange{begin - base, data.size()};
+    };
+
+    const uint32_t numSegments = static_cast<uint32_t>(modelSequenceTable.modelSequenceTableSize());
+    const size_t numConstants = constants.size();
+    const size_t pageSize = MemoryMap::pageSize();
+
+    // Prefetch ranges of each segment, merged up to a page apart since advice applies to whole pages
+    std::vector<uint32_t> lastUses(numConstants, NOT_USED);
+    std::vector<MappedRange> segmentRanges;
+    prefetchRows_.reserve(numSegments + 1);
+    prefetchRows_.push_back(0);
+    for (uint32_t segmentIdx = 0; segmentIdx < numSegments; ++segmentIdx) {
+        segmentRanges.clear();
+        for (const uint32_t constantIdx : modelSequenceTable.getSegmentConstantIndexes(segmentIdx)) {
+            if (constantIdx >= numConstants) {
+                continue;
+            }
+            lastUses[constantIdx] = segmentIdx;
+            const MappedRange range = rangeOf(constantIdx);
+            if (range.size != 0) {
+                segmentRanges.push_back(range);
+            }
+        }
+        AppendMerged(segmentRanges, prefetchRanges_, pageSize);
+        prefetchRows_.push_back(static_cast<uint32_t>(prefetchRanges_.size()));
+    }
+
+    // Constants sharing a payload are evicted after the last use of any of them
+    std::vector<std::pair<size_t, uint32_t>> payloads;
+    for (uint32_t constantIdx = 0; constantIdx < numConstants; ++constantIdx) {
+        if (lastUses[constantIdx] != NOT_USED) {
+            payloads.emplace_back(rangeOf(constantIdx).offset, constantIdx);
+        }
+    }
+    std::sort(payloads.begin(), payloads.end());
+    for (size_t i = 1; i < payloads.size(); ++i) {
+        if (payloads[i].first == payloads[i - 1].first) {
+            uint32_t &previous = lastUses[payloads[i - 1].second];
+            lastUses[payloads[i].second] = std::max(lastUses[payloads[i].second], previous);
+            previous = NOT_USED;
+        }
+    }
+
+    // Eviction ranges of each segment, from the constants it uses last
+    std::vector<std::vector<uint32_t>> lastUsed(numSegments);
+    for (uint32_t constantIdx = 0; constantIdx < numConstants; ++constantIdx) {
+        if (lastUses[constantIdx] != NOT_USED) {
+            lastUsed[lastUses[constantIdx]].push_back(constantIdx);
+        }
+    }
+    std::vector<MappedRange> merged;
+    evictionRows_.reserve(numSegments + 1);
+    evictionRows_.push_back(0);
+    for (uint32_t segmentIdx = 0; segmentIdx < numSegments; ++segmentIdx) {
+        segmentRanges.clear();
+        for (const uint32_t constantIdx : lastUsed[segmentIdx]) {
+            segmentRanges.push_back(rangeOf(constantIdx));
+        }
+        merged.clear();
+        AppendMerged(segmentRanges, merged, 0);
+        // Only whole pages are dropped, the last page of the file counts as whole
+        for (const MappedRange &range : merged) {
+            const size_t begin = (range.offset + pageSize - 1) / pageSize * pageSize;
+            const size_t rangeEnd = range.offset + range.size;
+            const size_t end = rangeEnd == mapped.size() ? rangeEnd : rangeEnd / pageSize * pageSize;
+            if (end > begin) {
+                evictionRanges_.push_back({begin, end - begin});
+            }
+        }
+        evictionRows_.push_back(static_cast<uint32_t>(evictionRanges_.size()));
+    }
+}
+
+vgflib::DataView<MappedRange> ConstantPrefetcher::getSegmentRanges(uint32_t segmentIdx) const {
+    if (segmentIdx >= size()) {
+        return {};
+    }
+    const uint32_t first = prefetchRows_[segmentIdx];
+    return {prefetchRanges_.data() + first, prefetchRows_[segmentIdx + 1] - first};
+}
+
+vgflib::DataView<MappedRange> ConstantPrefetcher::getEvictionRanges(uint32_t segmentIdx) const {
+    if (segmentIdx >= size()) {
+        return {};
+    }
+    const uint32_t first = evictionRows_[segmentIdx];
+    return {evictionRanges_.data() + first, evictionRows_[segmentIdx + 1] - first};
+}
+
+bool ConstantPrefetcher::prefetch(uint32_t segmentIdx, uint32_t numSegments) const {
+    bool advised = true;
+    for (uint32_t idx = segmentIdx; idx < size() && idx - segmentIdx < numSegments; ++idx) {
+        for (const MappedRange &range : getSegmentRanges(idx)) {
+            advised = mapped_.advise(range.offset, range.size, MemoryMapAdvice::WILLNEED) && advised;
+        }
+    }
+    return advised;
+}
+
+bool ConstantPrefetcher::evict(uint32_t segmentIdx, MemoryMapAdvice advice) const {
+    bool advised = true;
+    for (const MappedRange &range : getEvictionRanges(segmentIdx)) {
+        advised = mapped_.advise(range.offset, range.size, advice) && advised;
+    }
+    return advised;
+}
+
+} // namespace mlsdk::vgfutils
@@ -1,9 +1,11 @@
 /*
- * SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+ * SPDX-FileCopyrightText: Copyright 2025-2026 Arm Limited and/or its affiliates <open-source-office@arm.com>
  * SPDX-License-Identifier: Apache-2.0
  */
 #include "vgf-utils/memory_map.hpp"
 
+#include "vgf/decoder.hpp"
+
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -17,9 +19,71 @@
 #    include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <optional>
 #include <stdexcept>
 
-MemoryMap::MemoryMap(const std::string &filename) {
+namespace {
+
+struct PageRange {
+    void *addr;
+    size_t size;
+};
+
+/// Widens [offset, offset + size) to page boundaries, clamped to the mapping starting at the page aligned base
+std::optional<PageRange> ToPageRange(void *base, size_t mappedSize, size_t offset, size_t size) {
+    if (offset >= mappedSize) {
+        return std::nullopt;
+    }
+    const size_t end = offset + std::min(size, mappedSize - offset);
+    const size_t begin = offset - offset % MemoryMap::pageSize();
+    return PageRange{static_cast<char *>(base) + begin, end - begin};
+}
+
+#if defined(_WIN32) || !defined(MAP_POPULATE)
+/// Reads one byte of every page so that the whole range is faulted in
+void TouchPages(const void *addr, size_t size) {
+    const auto *bytes = static_cast<const volatile char *>(addr);
+    const size_t pageSize = MemoryMap::pageSize();
+    for (size_t offset = 0; offset < size; offset += pageSize) {
+        (void)bytes[offset];
+    }
+}
+#endif
+
+#ifndef _WIN32
+std::optional<int> ToMadvise(MemoryMapAdvice advice) {
+    switch (advice) {
+    case MemoryMapAdvice::NORMAL:
+        return MADV_NORMAL;
+    case MemoryMapAdvice::SEQUENTIAL:
+        return MADV_SEQUENTIAL;
+    case MemoryMapAdvice::RANDOM:
+        return MADV_RANDOM;
+    case MemoryMapAdvice::WILLNEED:
+        return MADV_WILLNEED;
+    case MemoryMapAdvice::HUGEPAGE:
+#    ifdef MADV_HUGEPAGE
+        return MADV_HUGEPAGE;
+#    else
+        return std::nullopt;
+#    endif
+    case MemoryMapAdvice::COLD:
+#    ifdef MADV_COLD
+        return MADV_COLD;
+#    else
+        return std::nullopt;
+#    endif
+    case MemoryMapAdvice::DONTNEED:
+        return MADV_DONTNEED;
+    }
+    return std::nullopt;
+}
+#endif
+
+} // namespace
+
+MemoryMap::MemoryMap(const std::string &filename, const MemoryMapOptions &options) {
 #ifdef _WIN32
     HANDLE hFile = CreateFile(filename.c_str(), GENERIC_READ, 0, nullptr, OPEN_EXISTING,
                               FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
@@ -34,6 +98,7 @@ MemoryMap::MemoryMap(const std::string &filename) {
     }
     size_ = static_cast<size_t>(fileSize.QuadPart);
 
+    // File views always share the pages of the file cache, so options.shared needs no handling
     HANDLE hMap = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
     if (hMap == INVALID_HANDLE_VALUE) {
         throw std::runtime_error("Failed to create file mapping for file " + filename);
@@ -44,6 +109,9 @@ MemoryMap::MemoryMap(const std::string &filename) {
     if (addr_ == nullptr) {
         throw std::runtime_error("MapViewOfFile failed for file " + filename);
     }
+    if (options.populate) {
+        TouchPages(addr_, size_);
+    }
 #else
     fd_ = open(filename.c_str(), O_RDONLY);
     if (fd_ < 0) {
@@ -55,14 +123,46 @@ MemoryMap::MemoryMap(const std::string &filename) {
     }
     size_ = size_t(st.st_size);
 
-    addr_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    int flags = options.shared ? MAP_SHARED : MAP_PRIVATE;
+#    ifdef MAP_POPULATE
+    if (options.populate) {
+        flags |= MAP_POPULATE;
+    }
+#    endif
+    addr_ = mmap(nullptr, size_, PROT_READ, flags, fd_, 0);
     if (addr_ == MAP_FAILED) {
         throw std::runtime_error("Failed to memory map the file " + filename);
     }
+#    ifndef MAP_POPULATE
+    if (options.populate) {
+        TouchPages(addr_, size_);
+    }
+#    endif
 #endif
+
+    // Hints are best effort, a platform without the advice still maps the file
+    if (options.advice != MemoryMapAdvice::NORMAL) {
+        advise(0, size_, options.advice);
+    }
+    if (options.lock && !lock(0, size_)) {
+        unmap();
+        throw std::runtime_error("Failed to lock the memory mapping of the file " + filename);
+    }
 }
 
-MemoryMap::~MemoryMap() {
+MemoryMap::~MemoryMap() { unmap(); }
+
+size_t MemoryMap::pageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+void MemoryMap::unmap() {
 #ifdef _WIN32
     UnmapViewOfFile(addr_);
     CloseHandle(reinterpret_cast<HANDLE>(hMap_));
@@ -71,6 +171,7 @@ MemoryMap::~MemoryMap() {
     if (fd_ > 0) {
         munmap(addr_, size_);
         close(fd_);
+        fd_ = -1;
     }
 #endif
 }
@@ -82,3 +183,67 @@ const void *MemoryMap::ptr(const size_t offset) const {
     }
     return reinterpret_cast<const void *>(static_cast<char *>(addr_) + offset);
 }
+
+bool MemoryMap::advise(size_t offset, size_t size, MemoryMapAdvice advice) const {
+    const std::optional<PageRange> range = ToPageRange(addr_, size_, offset, size);
+    if (!range.has_value()) {
+        return false;
+    }
+#ifdef _WIN32
+    // Without madvise, only the default access pattern and prefetching by touching the pages are available
+    if (advice == MemoryMapAdvice::WILLNEED) {
+        TouchPages(range->addr, range->size);
+    }
+    return advice == MemoryMapAdvice::NORMAL || advice == MemoryMapAdvice::WILLNEED;
+#else
+    const std::optional<int> madvice = ToMadvise(advice);
+    return madvice.has_value() && madvise(range->addr, range->size, *madvice) == 0;
+#endif
+}
+
+bool MemoryMap::lock(size_t offset, size_t size) const {
+    const std::optional<PageRange> range = ToPageRange(addr_, size_, offset, size);
+    if (!range.has_value()) {
+        return false;
+    }
+#ifdef _WIN32
+    return VirtualLock(range->addr, range->size) != 0;
+#else
+    return mlock(range->addr, range->size) == 0;
+#endif
+}
+
+bool MemoryMap::unlock(size_t offset, size_t size) const {
+    const std::optional<PageRange> range = ToPageRange(addr_, size_, offset, size);
+    if (!range.has_value()) {
+        return false;
+    }
+#ifdef _WIN32
+    return VirtualUnlock(range->addr, range->size) != 0;
+#else
+    return munlock(range->addr, range->size) == 0;
+#endif
+}
+
+bool AdviseVgfSections(const MemoryMap &mapped, const mlsdk::vgflib::HeaderDecoder &header,
+                       MemoryMapAdvice tablesAdvice, MemoryMapAdvice constantsAdvice) {
+    const struct {
+        uint64_t offset;
+        uint64_t size;
+        MemoryMapAdvice advice;
+    } sections[] = {
+        {header.GetModuleTableOffset(), header.GetModuleTableSize(), tablesAdvice},
+        {header.GetModelSequenceTableOffset(), header.GetModelSequenceTableSize(), tablesAdvice},
+        {header.GetModelResourceTableOffset(), header.GetModelResourceTableSize(), tablesAdvice},
+        {header.GetConstantsOffset(), header.GetConstantsSize(), constantsAdvice},
+    };
+    bool advised = true;
+    for (const auto &section : sections) {
+        if (section.size != 0) {
+            advised = mapped.advise(static_cast<size_t>(section.offset), static_cast<size_t>(section.size),
+                                    section.advice) &&
+                      advised;
+        }
+    }
+    return advised;
+}